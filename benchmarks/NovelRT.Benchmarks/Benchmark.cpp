@@ -0,0 +1,24 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include "Benchmark.h"
+
+namespace NovelRT::Benchmarks {
+  BenchmarkState::BenchmarkState(int64_t argument, uint64_t iterations) noexcept :
+    _argument(argument),
+    _iterations(iterations),
+    _completedIterations(0),
+    _itemsPerIteration(0),
+    _start(),
+    _elapsed(0) {
+  }
+
+  std::vector<Benchmark>& getBenchmarks() {
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+  }
+
+  bool registerBenchmark(const std::string& name, BenchmarkFunction function, std::vector<int64_t> arguments) {
+    getBenchmarks().push_back(Benchmark{name, function, std::move(arguments)});
+    return true;
+  }
+}
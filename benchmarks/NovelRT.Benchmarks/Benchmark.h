@@ -0,0 +1,98 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_BENCHMARKS_BENCHMARK_H
+#define NOVELRT_BENCHMARKS_BENCHMARK_H
+
+#include <NovelRT.h>
+
+namespace NovelRT::Benchmarks {
+  /**
+   * Times one run of a benchmark. The benchmark sets itself up, then loops while keepRunning() returns true. Only the loop is timed.
+   */
+  class BenchmarkState {
+  private:
+    int64_t _argument;
+    uint64_t _iterations;
+    uint64_t _completedIterations;
+    uint64_t _itemsPerIteration;
+    std::chrono::steady_clock::time_point _start;
+    std::chrono::nanoseconds _elapsed;
+
+  public:
+    BenchmarkState(int64_t argument, uint64_t iterations) noexcept;
+
+    inline bool keepRunning() {
+      if (_completedIterations == _iterations) {
+        _elapsed = std::chrono::steady_clock::now() - _start;
+        return false;
+      }
+
+      if (_completedIterations++ == 0) {
+        _start = std::chrono::steady_clock::now();
+      }
+
+      return true;
+    }
+
+    /**
+     * Gets the argument this run was registered with, such as the number of objects to work on.
+     */
+    inline int64_t getArgument() const noexcept {
+      return _argument;
+    }
+
+    /**
+     * Sets how many items one iteration processes, so the time per item can be reported.
+     */
+    inline void setItemsPerIteration(uint64_t value) noexcept {
+      _itemsPerIteration = value;
+    }
+
+    inline uint64_t getItemsPerIteration() const noexcept {
+      return _itemsPerIteration;
+    }
+
+    inline uint64_t getIterations() const noexcept {
+      return _iterations;
+    }
+
+    inline std::chrono::nanoseconds getElapsed() const noexcept {
+      return _elapsed;
+    }
+  };
+
+  typedef void (*BenchmarkFunction)(BenchmarkState&);
+
+  struct Benchmark {
+    std::string name;
+    BenchmarkFunction function;
+    std::vector<int64_t> arguments;
+  };
+
+  std::vector<Benchmark>& getBenchmarks();
+  bool registerBenchmark(const std::string& name, BenchmarkFunction function, std::vector<int64_t> arguments);
+
+  /**
+   * Stops the optimiser from discarding a result that is otherwise never read.
+   */
+  template<typename T>
+  inline void doNotOptimise(const T& value) {
+#if defined(_MSC_VER)
+    static const void* volatile sink;
+    sink = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "g"(&value) : "memory");
+#endif
+  }
+}
+
+/**
+ * Defines and registers a benchmark, run once for each of the arguments given.
+ */
+#define NOVELRT_BENCHMARK(name, ...) \
+  static void name(NovelRT::Benchmarks::BenchmarkState& state); \
+  [[maybe_unused]] static bool name##IsRegistered = NovelRT::Benchmarks::registerBenchmark(#name, name, { __VA_ARGS__ }); \
+  static void name(NovelRT::Benchmarks::BenchmarkState& state)
+
+#endif //NOVELRT_BENCHMARKS_BENCHMARK_H
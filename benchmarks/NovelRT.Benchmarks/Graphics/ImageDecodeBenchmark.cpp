@@ -0,0 +1,224 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include "Benchmark.h"
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+using namespace NovelRT::Benchmarks;
+
+//Character sprites are mostly transparent space around a shaded figure, with flat areas, soft edges and some fine detail.
+//Backgrounds are opaque, so they are stored as RGB and go through the RGB to RGBA expansion.
+
+namespace {
+  const uint32_t SpriteWidth = 256;
+  const uint32_t SpriteHeight = 512;
+  const uint32_t BackgroundWidth = 1280;
+  const uint32_t BackgroundHeight = 720;
+
+  RgbaImage createSprite(uint32_t seed) {
+    RgbaImage image(SpriteWidth, SpriteHeight);
+    auto noise = seed * 2654435761u + 1;
+    auto centreX = SpriteWidth * 0.5f;
+    auto radiusX = SpriteWidth * (0.3f + static_cast<float>(seed % 7) * 0.02f);
+
+    for (uint32_t y = 0; y < SpriteHeight; y++) {
+      for (uint32_t x = 0; x < SpriteWidth; x++) {
+        auto pixel = image.getPixel(x, y);
+        auto distance = std::fabs(static_cast<float>(x) - centreX) / radiusX;
+        if (y < SpriteHeight / 8 || distance > 1.0f) continue;
+
+        noise = noise * 1103515245u + 12345u;
+        auto isHair = y < SpriteHeight / 4;
+        auto shade = static_cast<uint8_t>(220.0f - distance * 80.0f);
+        pixel[0] = isHair ? static_cast<uint8_t>(60 + ((noise >> 24) & 15)) : shade;
+        pixel[1] = isHair ? static_cast<uint8_t>(40 + ((noise >> 20) & 15)) : static_cast<uint8_t>(shade * 3 / 4);
+        pixel[2] = isHair ? 30 : static_cast<uint8_t>(100 + (seed * 17) % 100);
+        pixel[3] = distance > 0.95f ? static_cast<uint8_t>((1.0f - distance) * 20.0f * 255.0f) : 255;
+      }
+    }
+
+    return image;
+  }
+
+  RgbaImage createBackground(uint32_t seed) {
+    RgbaImage image(BackgroundWidth, BackgroundHeight);
+    auto noise = seed * 2654435761u + 1;
+
+    for (uint32_t y = 0; y < BackgroundHeight; y++) {
+      for (uint32_t x = 0; x < BackgroundWidth; x++) {
+        noise = noise * 1103515245u + 12345u;
+        auto pixel = image.getPixel(x, y);
+        pixel[0] = static_cast<uint8_t>(x * 200 / BackgroundWidth + ((noise >> 28) & 3));
+        pixel[1] = static_cast<uint8_t>(y * 200 / BackgroundHeight + ((noise >> 26) & 3));
+        pixel[2] = static_cast<uint8_t>(120 + seed * 10);
+        pixel[3] = 255;
+      }
+    }
+
+    return image;
+  }
+
+  void writeRgbPng(const std::string& file, const RgbaImage& image) {
+    std::vector<uint8_t> rows;
+    rows.reserve(static_cast<size_t>(image.width) * image.height * 3);
+    for (size_t i = 0; i < image.pixels.size(); i += RgbaImage::BytesPerPixel) {
+      rows.insert(rows.end(), image.pixels.begin() + static_cast<std::ptrdiff_t>(i), image.pixels.begin() + static_cast<std::ptrdiff_t>(i + 3));
+    }
+
+    std::vector<png_bytep> rowPointers(image.height);
+    for (uint32_t y = 0; y < image.height; y++) {
+      rowPointers[y] = rows.data() + static_cast<size_t>(y) * image.width * 3;
+    }
+
+    auto cFile = fopen(file.c_str(), "wb");
+    auto png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+    auto info = png_create_info_struct(png);
+    png_init_io(png, cFile);
+    png_set_IHDR(png, info, image.width, image.height, 8, PNG_COLOR_TYPE_RGB, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_write_info(png, info);
+    png_write_image(png, rowPointers.data());
+    png_write_end(png, nullptr);
+    png_destroy_write_struct(&png, &info);
+    fclose(cFile);
+  }
+
+  //Writing hundreds of PNGs takes far longer than reading them, so each set is only written once per process.
+  const std::vector<std::string>& getSpriteFiles(const std::string& extension, size_t count) {
+    static std::map<std::string, std::vector<std::string>> filesByExtension;
+    auto& files = filesByExtension[extension];
+
+    for (auto i = static_cast<uint32_t>(files.size()); i < count; i++) {
+      auto file = (std::filesystem::temp_directory_path() / ("NovelRTImageDecodeBenchmark_sprite" + std::to_string(i) + extension)).string();
+      if (extension == ".qoi") {
+        QoiCodec::encodeFile(file, createSprite(i));
+      }
+      else {
+        PngCodec::encodeFile(file, createSprite(i));
+      }
+
+      files.push_back(file);
+    }
+
+    return files;
+  }
+
+  const std::vector<std::string>& getRgbBackgroundFiles(size_t count) {
+    static std::vector<std::string> files;
+
+    for (auto i = static_cast<uint32_t>(files.size()); i < count; i++) {
+      auto file = (std::filesystem::temp_directory_path() / ("NovelRTImageDecodeBenchmark_background" + std::to_string(i) + ".png")).string();
+      writeRgbPng(file, createBackground(i));
+      files.push_back(file);
+    }
+
+    return files;
+  }
+
+  //How PngCodec read files before it did its own pixel conversion: libpng's transforms expanded every row to RGBA as it was read.
+  void decodeWithLibpngTransforms(const std::string& file, RgbaImage& image) {
+    auto cFile = fopen(file.c_str(), "rb");
+    auto png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+    auto info = png_create_info_struct(png);
+    png_init_io(png, cFile);
+    png_read_info(png, info);
+
+    auto colourType = png_get_color_type(png, info);
+    if (png_get_bit_depth(png, info) == 16) png_set_strip_16(png);
+    if (colourType == PNG_COLOR_TYPE_PALETTE) png_set_palette_to_rgb(png);
+    if (png_get_valid(png, info, PNG_INFO_tRNS)) png_set_tRNS_to_alpha(png);
+    if (colourType == PNG_COLOR_TYPE_RGB || colourType == PNG_COLOR_TYPE_GRAY || colourType == PNG_COLOR_TYPE_PALETTE) {
+      png_set_filler(png, 0xFF, PNG_FILLER_AFTER);
+    }
+    if (colourType == PNG_COLOR_TYPE_GRAY || colourType == PNG_COLOR_TYPE_GRAY_ALPHA) png_set_gray_to_rgb(png);
+    png_set_interlace_handling(png);
+    png_read_update_info(png, info);
+
+    image.width = png_get_image_width(png, info);
+    image.height = png_get_image_height(png, info);
+    image.pixels.resize(static_cast<size_t>(image.width) * image.height * RgbaImage::BytesPerPixel);
+    std::vector<png_bytep> rowPointers(image.height);
+    for (uint32_t y = 0; y < image.height; y++) {
+      rowPointers[y] = image.getPixel(0, y);
+    }
+
+    png_read_image(png, rowPointers.data());
+    png_read_end(png, info);
+    png_destroy_read_struct(&png, &info, nullptr);
+    fclose(cFile);
+  }
+}
+
+NOVELRT_BENCHMARK(PngSpriteDecode, 300) {
+  auto& files = getSpriteFiles(".png", static_cast<size_t>(state.getArgument()));
+  RgbaImage image;
+
+  state.setItemsPerIteration(files.size());
+  while (state.keepRunning()) {
+    for (const auto& file : files) {
+      PngCodec::decodeFile(file, image);
+      doNotOptimise(image.pixels.data());
+    }
+  }
+}
+
+NOVELRT_BENCHMARK(QoiSpriteDecode, 300) {
+  auto& files = getSpriteFiles(".qoi", static_cast<size_t>(state.getArgument()));
+  RgbaImage image;
+
+  state.setItemsPerIteration(files.size());
+  while (state.keepRunning()) {
+    for (const auto& file : files) {
+      QoiCodec::decodeFile(file, image);
+      doNotOptimise(image.pixels.data());
+    }
+  }
+}
+
+NOVELRT_BENCHMARK(LibpngTransformRgbBackgroundDecode, 20) {
+  auto& files = getRgbBackgroundFiles(static_cast<size_t>(state.getArgument()));
+  RgbaImage image;
+
+  state.setItemsPerIteration(files.size());
+  while (state.keepRunning()) {
+    for (const auto& file : files) {
+      decodeWithLibpngTransforms(file, image);
+      doNotOptimise(image.pixels.data());
+    }
+  }
+}
+
+NOVELRT_BENCHMARK(PngCodecRgbBackgroundDecode, 20) {
+  auto& files = getRgbBackgroundFiles(static_cast<size_t>(state.getArgument()));
+  RgbaImage image;
+
+  state.setItemsPerIteration(files.size());
+  while (state.keepRunning()) {
+    for (const auto& file : files) {
+      PngCodec::decodeFile(file, image);
+      doNotOptimise(image.pixels.data());
+    }
+  }
+}
+
+NOVELRT_BENCHMARK(RgbToRgbaConversion, 1280 * 720) {
+  auto pixelCount = static_cast<size_t>(state.getArgument());
+  std::vector<uint8_t> source(pixelCount * 3, 77);
+  std::vector<uint8_t> destination(pixelCount * 4);
+
+  state.setItemsPerIteration(pixelCount);
+  while (state.keepRunning()) {
+    PixelConverter::rgbToRgba(source.data(), destination.data(), pixelCount);
+    doNotOptimise(destination.data());
+  }
+}
+
+NOVELRT_BENCHMARK(PremultiplyAlphaConversion, 1280 * 720) {
+  auto pixelCount = static_cast<size_t>(state.getArgument());
+  std::vector<uint8_t> pixels(pixelCount * 4, 200);
+
+  state.setItemsPerIteration(pixelCount);
+  while (state.keepRunning()) {
+    PixelConverter::premultiplyAlpha(pixels.data(), pixelCount);
+    doNotOptimise(pixels.data());
+  }
+}
@@ -0,0 +1,94 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include "Benchmark.h"
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+using namespace NovelRT::Benchmarks;
+
+//Particles live far longer than the benchmarks run, so every iteration moves the same number of them.
+
+namespace {
+  const float FrameSeconds = 1.0f / 60.0f;
+
+  ParticleEmitterSettings createSettings(size_t count) {
+    ParticleEmitterSettings settings;
+    settings.maxParticles = static_cast<uint32_t>(count);
+    settings.minLifetime = 10000.0f;
+    settings.maxLifetime = 10000.0f;
+    settings.spawnAreaSize = Maths::GeoVector2F(1920.0f, 1080.0f);
+    settings.minVelocity = Maths::GeoVector2F(-20.0f, 50.0f);
+    settings.maxVelocity = Maths::GeoVector2F(20.0f, 150.0f);
+    settings.acceleration = Maths::GeoVector2F(0.0f, 9.8f);
+    settings.minAngularVelocity = -90.0f;
+    settings.maxAngularVelocity = 90.0f;
+    settings.speedOverLifetime = ParticleCurve<float>({ { 0.0f, 1.0f }, { 1.0f, 0.0f } });
+    settings.colourOverLifetime = ParticleCurve<Maths::GeoVector4F>({ { 0.0f, Maths::GeoVector4F(1.0f, 1.0f, 1.0f, 1.0f) }, { 1.0f, Maths::GeoVector4F(1.0f, 1.0f, 1.0f, 0.0f) } });
+    return settings;
+  }
+
+  //How particles are usually simulated without an emitter: one struct per particle, with the curves evaluated for each one.
+  struct ParticleObject {
+    Maths::GeoVector2F position;
+    Maths::GeoVector2F velocity;
+    float rotation;
+    float angularVelocity;
+    float age;
+    float lifetime;
+  };
+}
+
+NOVELRT_BENCHMARK(ParticleObjectUpdate, 1000, 10000, 100000) {
+  auto count = static_cast<size_t>(state.getArgument());
+  auto settings = createSettings(count);
+  auto emitter = ParticleEmitter(nullptr, settings);
+  emitter.burst(static_cast<uint32_t>(count), Maths::GeoVector2F(960.0f, 540.0f));
+
+  std::vector<SpriteInstanceData> instances(count);
+  emitter.writeInstances(instances.data(), 0.0f);
+  std::vector<ParticleObject> particles;
+  for (const auto& instance : instances) {
+    particles.push_back(ParticleObject{Maths::GeoVector2F(instance.transform.w.x, instance.transform.w.y), settings.maxVelocity, 0.0f, settings.maxAngularVelocity, 0.0f, settings.maxLifetime});
+  }
+
+  state.setItemsPerIteration(count);
+  while (state.keepRunning()) {
+    for (auto& particle : particles) {
+      particle.age += FrameSeconds;
+      auto speed = settings.speedOverLifetime.evaluate(particle.age / particle.lifetime);
+      particle.velocity = particle.velocity + (settings.acceleration * FrameSeconds);
+      particle.position = particle.position + (particle.velocity * (speed * FrameSeconds));
+      particle.rotation += particle.angularVelocity * FrameSeconds;
+    }
+
+    doNotOptimise(particles.front());
+  }
+}
+
+NOVELRT_BENCHMARK(ParticleEmitterUpdate, 1000, 10000, 100000) {
+  auto count = static_cast<size_t>(state.getArgument());
+  auto emitter = ParticleEmitter(nullptr, createSettings(count));
+  emitter.setEmitting(false);
+  emitter.burst(static_cast<uint32_t>(count), Maths::GeoVector2F(960.0f, 540.0f));
+
+  state.setItemsPerIteration(count);
+  while (state.keepRunning()) {
+    emitter.update(FrameSeconds, Maths::GeoVector2F(960.0f, 540.0f));
+    doNotOptimise(emitter.getBounds());
+  }
+}
+
+NOVELRT_BENCHMARK(ParticleEmitterWriteInstances, 1000, 10000, 100000) {
+  auto count = static_cast<size_t>(state.getArgument());
+  auto emitter = ParticleEmitter(nullptr, createSettings(count));
+  emitter.setEmitting(false);
+  emitter.burst(static_cast<uint32_t>(count), Maths::GeoVector2F(960.0f, 540.0f));
+  emitter.update(FrameSeconds, Maths::GeoVector2F(960.0f, 540.0f));
+
+  std::vector<SpriteInstanceData> instances(count);
+  state.setItemsPerIteration(count);
+  while (state.keepRunning()) {
+    emitter.writeInstances(instances.data(), 0.0f);
+    doNotOptimise(instances.back());
+  }
+}
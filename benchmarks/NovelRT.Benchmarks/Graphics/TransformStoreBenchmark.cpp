@@ -0,0 +1,94 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include "Benchmark.h"
+#include <random>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+using namespace NovelRT::Benchmarks;
+
+//Every object moves every frame in both benchmarks, which is the worst case for both paths.
+
+namespace {
+  //How RenderObject built its model matrix before TransformStore: each object owns a Lazy matrix bound to a member function,
+  //which rebuilds it through glm the next time it is read after being reset.
+  class PerObjectTransform {
+  public:
+    Transform transform;
+    float layer;
+    Utilities::Lazy<Maths::GeoMatrix4x4F> modelMatrix;
+
+    PerObjectTransform(Transform objectTransform, float objectLayer) :
+      transform(objectTransform),
+      layer(objectLayer),
+      modelMatrix(std::function<Maths::GeoMatrix4x4F()>(std::bind(&PerObjectTransform::generateViewData, this))) {
+    }
+
+    Maths::GeoMatrix4x4F generateViewData() {
+      auto position = glm::vec2(transform.position.x, transform.position.y);
+      auto defaultIdentity = Maths::GeoMatrix4x4F::getDefaultIdentity();
+      auto resultMatrix = *reinterpret_cast<glm::mat4*>(&defaultIdentity);
+      resultMatrix = glm::translate(resultMatrix, glm::vec3(position, layer));
+      resultMatrix = glm::rotate(resultMatrix, glm::radians(transform.rotation), glm::vec3(0.0f, 0.0f, 1.0f));
+      resultMatrix = glm::scale(resultMatrix, glm::vec3(transform.scale.x, transform.scale.y, 1.0f));
+      return *reinterpret_cast<Maths::GeoMatrix4x4F*>(&resultMatrix);
+    }
+  };
+
+  std::vector<std::pair<Transform, float>> createTransforms(size_t count) {
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> x(0.0f, 1920.0f);
+    std::uniform_real_distribution<float> y(0.0f, 1080.0f);
+    std::uniform_real_distribution<float> rotation(-180.0f, 180.0f);
+    std::uniform_real_distribution<float> scale(10.0f, 200.0f);
+    std::uniform_int_distribution<int32_t> layer(0, 10);
+
+    std::vector<std::pair<Transform, float>> transforms;
+    transforms.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+      transforms.emplace_back(Transform(Maths::GeoVector2F(x(random), y(random)), rotation(random), Maths::GeoVector2F(scale(random), scale(random))),
+        static_cast<float>(layer(random)));
+    }
+
+    return transforms;
+  }
+}
+
+NOVELRT_BENCHMARK(PerObjectModelMatrices, 1000, 10000, 100000) {
+  auto count = static_cast<size_t>(state.getArgument());
+  std::vector<std::unique_ptr<PerObjectTransform>> objects;
+  for (const auto& [transform, layer] : createTransforms(count)) {
+    objects.push_back(std::make_unique<PerObjectTransform>(transform, layer));
+  }
+
+  state.setItemsPerIteration(count);
+  while (state.keepRunning()) {
+    for (auto& object : objects) {
+      object->transform.rotation += 1.0f;
+      object->modelMatrix.reset();
+      doNotOptimise(object->modelMatrix.getActual());
+    }
+  }
+}
+
+NOVELRT_BENCHMARK(TransformStoreModelMatrices, 1000, 10000, 100000) {
+  auto count = static_cast<size_t>(state.getArgument());
+  auto transforms = createTransforms(count);
+  TransformStore store;
+  std::vector<uint32_t> handles;
+  for (size_t i = 0; i < count; i++) {
+    handles.push_back(store.allocate());
+  }
+
+  state.setItemsPerIteration(count);
+  while (state.keepRunning()) {
+    for (size_t i = 0; i < count; i++) {
+      auto& [transform, layer] = transforms[i];
+      transform.rotation += 1.0f;
+      store.set(handles[i], transform.position, transform.rotation, transform.scale, layer);
+    }
+
+    store.update();
+    doNotOptimise(store.getModelMatrix(handles[0]));
+  }
+}
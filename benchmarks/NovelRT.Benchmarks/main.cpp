@@ -0,0 +1,48 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include "Benchmark.h"
+
+//Runs every registered benchmark, or only those whose name contains the filter given as the first argument.
+//Each run doubles its iteration count until it takes at least MinimumRunTime, so the reported times are not dominated by timer noise.
+
+using namespace NovelRT::Benchmarks;
+
+static const std::chrono::milliseconds MinimumRunTime(200);
+
+int main(int argc, char* argv[])
+{
+  std::string filter = argc > 1 ? argv[1] : "";
+
+  std::cout << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(12) << "Iterations" << std::setw(16) << "us/iteration"
+    << std::setw(14) << "ns/item" << std::endl;
+
+  for (const auto& benchmark : getBenchmarks()) {
+    if (benchmark.name.find(filter) == std::string::npos) continue;
+
+    for (auto argument : benchmark.arguments) {
+      uint64_t iterations = 1;
+      while (true) {
+        BenchmarkState state(argument, iterations);
+        benchmark.function(state);
+
+        if (state.getElapsed() < MinimumRunTime && iterations < (uint64_t(1) << 40)) {
+          iterations *= 2;
+          continue;
+        }
+
+        auto nanosecondsPerIteration = static_cast<double>(state.getElapsed().count()) / static_cast<double>(state.getIterations());
+        std::cout << std::left << std::setw(48) << (benchmark.name + "/" + std::to_string(argument)) << std::right << std::setw(12) << iterations
+          << std::setw(16) << std::fixed << std::setprecision(2) << nanosecondsPerIteration / 1000.0;
+
+        if (state.getItemsPerIteration() != 0) {
+          std::cout << std::setw(14) << nanosecondsPerIteration / static_cast<double>(state.getItemsPerIteration());
+        }
+
+        std::cout << std::endl;
+        break;
+      }
+    }
+  }
+
+  return 0;
+}
@@ -13,24 +13,35 @@
 #define __STDC_WANT_LIB_EXT1__ 1
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <cstdint>
+#include <cstring>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <functional>
+#include <iomanip>
 #include <iostream>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <queue>
 #include <set>
 #include <sstream>
 #include <stack>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <typeinfo>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #if defined(_WIN32) || defined(_WIN64)
@@ -136,10 +147,41 @@ namespace NovelRT::Graphics {
   typedef class Texture Texture;
   typedef class BasicFillRect BasicFillRect;
   typedef class Camera Camera;
+  typedef class Canvas2D Canvas2D;
+  typedef class DistanceFieldGenerator DistanceFieldGenerator;
+  typedef class Etc2Encoder Etc2Encoder;
+  typedef class FontLibrary FontLibrary;
+  typedef class ImageDecodeWorkerPool ImageDecodeWorkerPool;
   typedef class ImageRect ImageRect;
+  typedef class MaxRectsPacker MaxRectsPacker;
+  typedef class ParticleEmitter ParticleEmitter;
+  typedef class ParticleSystem ParticleSystem;
+  typedef class PixelConverter PixelConverter;
+  typedef class PngCodec PngCodec;
+  typedef class QoiCodec QoiCodec;
+  typedef class RenderCommandList RenderCommandList;
   typedef class RenderingService RenderingService;
+  typedef class RenderLayer RenderLayer;
   typedef class RenderObject RenderObject;
+  typedef class RenderQueue RenderQueue;
+  typedef class RenderWorkerPool RenderWorkerPool;
+  typedef class ScreenTransition ScreenTransition;
+  typedef class ShaderProgramCache ShaderProgramCache;
+  typedef class ShapeBatch ShapeBatch;
+  typedef class SpatialIndex SpatialIndex;
+  typedef class SkylinePacker SkylinePacker;
+  typedef class SpriteAtlas SpriteAtlas;
+  typedef class SpriteAtlasBuilder SpriteAtlasBuilder;
+  typedef class SpriteBatch SpriteBatch;
+  typedef class SpriteBatchBackend SpriteBatchBackend;
+  typedef class OpenGLSpriteBatchBackend OpenGLSpriteBatchBackend;
+  typedef class RecordingSpriteBatchBackend RecordingSpriteBatchBackend;
+  typedef class GeometryCache GeometryCache;
+  typedef class GLStateCache GLStateCache;
   typedef class TextRect TextRect;
+  typedef class TextureContainer TextureContainer;
+  typedef class TextureLoader TextureLoader;
+  typedef class TransformStore TransformStore;
 }
 /**
  * Contains bindings for Ink.
@@ -178,6 +220,7 @@ namespace NovelRT::Timing {
  * Contains windowing features.
  */
 namespace NovelRT::Windowing {
+  typedef class HeadlessContext HeadlessContext;
   typedef class WindowingService WindowingService;
 }
 
@@ -185,6 +228,11 @@ namespace NovelRT::Windowing {
 #include "NovelRT/Input/KeyCode.h"
 #include "NovelRT/Input/KeyState.h"
 #include "NovelRT/Graphics/CameraFrameState.h"
+#include "NovelRT/Graphics/RenderCommandType.h"
+#include "NovelRT/Graphics/RenderPass.h"
+#include "NovelRT/Graphics/ScreenTransitionEffect.h"
+#include "NovelRT/Graphics/ScreenTransitionState.h"
+#include "NovelRT/Graphics/TextureAlphaMode.h"
 
 //value types
 #include "NovelRT/Atom.h"
@@ -192,9 +240,10 @@ namespace NovelRT::Windowing {
 #include "NovelRT/Utilities/Event.h" //these have to exist up here due to include order issues
 #include "NovelRT/Utilities/Lazy.h"
 #include "NovelRT/Utilities/Misc.h"
+#include "NovelRT/Utilities/MemoryMappedFile.h"
+#include "NovelRT/Utilities/ResourceCache.h"
 
 #include "NovelRT/Animation/AnimatorPlayState.h"
-#include "NovelRT/Animation/SpriteAnimatorFrame.h"
 #include "NovelRT/Maths/GeoVector2F.h"
 #include "NovelRT/Maths/GeoVector3F.h"
 #include "NovelRT/Maths/GeoVector4F.h"
@@ -205,6 +254,12 @@ namespace NovelRT::Windowing {
 #include "NovelRT/Transform.h"
 #include "NovelRT/Graphics/GraphicsCharacterRenderData.h"
 #include "NovelRT/Graphics/ImageData.h"
+#include "NovelRT/Graphics/RgbaImage.h"
+#include "NovelRT/Graphics/SpriteAtlasRegion.h"
+#include "NovelRT/Graphics/TextureRegion.h"
+#include "NovelRT/Graphics/TextureContainerFormat.h"
+#include "NovelRT/Graphics/TextureContainerLevel.h"
+#include "NovelRT/Animation/SpriteAnimatorFrame.h"
 #include "NovelRT/Graphics/ShaderProgram.h"
 #include "NovelRT/Graphics/RGBAConfig.h"
 
@@ -235,10 +290,48 @@ namespace NovelRT::Windowing {
 
 //Graphics types
 #include "NovelRT/Graphics/Camera.h"
+#include "NovelRT/Graphics/GLStateCache.h"
+#include "NovelRT/Graphics/RenderWorkerPool.h"
+#include "NovelRT/Graphics/PixelConverter.h"
+#include "NovelRT/Graphics/PngCodec.h"
+#include "NovelRT/Graphics/QoiCodec.h"
+#include "NovelRT/Graphics/Etc2Encoder.h"
+#include "NovelRT/Graphics/TextureContainer.h"
 #include "NovelRT/Graphics/Texture.h"
+#include "NovelRT/Graphics/ImageDecodeWorkerPool.h"
+#include "NovelRT/Graphics/TextureLoader.h"
+#include "NovelRT/Graphics/ShaderProgramCache.h"
+#include "NovelRT/Graphics/SkylinePacker.h"
+#include "NovelRT/Graphics/MaxRectsPacker.h"
+#include "NovelRT/Graphics/SpriteAtlasBuilder.h"
+#include "NovelRT/Graphics/SpriteAtlas.h"
+#include "NovelRT/Graphics/DistanceFieldGenerator.h"
+#include "NovelRT/Graphics/FontLibrary.h"
+#include "NovelRT/Graphics/FontRenderMode.h"
 #include "NovelRT/Graphics/FontSet.h"
+#include "NovelRT/Graphics/GeometryCache.h"
+#include "NovelRT/Graphics/SpriteInstanceData.h"
+#include "NovelRT/Graphics/SpriteBatchGroup.h"
+#include "NovelRT/Graphics/SpriteBatchBackend.h"
+#include "NovelRT/Graphics/OpenGLSpriteBatchBackend.h"
+#include "NovelRT/Graphics/RecordingSpriteBatchBackend.h"
+#include "NovelRT/Graphics/SpriteBatch.h"
+#include "NovelRT/Graphics/ShapeVertex.h"
+#include "NovelRT/Graphics/ShapeBatch.h"
+#include "NovelRT/Graphics/RenderCommand.h"
+#include "NovelRT/Graphics/RenderCommandList.h"
+#include "NovelRT/Graphics/ParticleCurve.h"
+#include "NovelRT/Graphics/ParticleEmitterSettings.h"
+#include "NovelRT/Graphics/ParticleEmitter.h"
+#include "NovelRT/Graphics/TransformStore.h"
 #include "NovelRT/Graphics/RenderObject.h"
+#include "NovelRT/Graphics/SpatialIndex.h"
+#include "NovelRT/Graphics/RenderQueue.h"
+#include "NovelRT/Graphics/RenderLayer.h"
+#include "NovelRT/Graphics/ScreenTransition.h"
 #include "NovelRT/Graphics/BasicFillRect.h"
+#include "NovelRT/Graphics/Canvas2D.h"
+#include "NovelRT/Graphics/ParticleSystem.h"
 #include "NovelRT/Graphics/GraphicsCharacterRenderDataHelper.h"
 #include "NovelRT/Graphics/ImageRect.h"
 #include "NovelRT/Graphics/TextRect.h"
@@ -257,6 +350,7 @@ namespace NovelRT::Windowing {
 #include "NovelRT/DebugService.h"
 #include "NovelRT/DotNet/RuntimeService.h"
 #include "NovelRT/Input/InteractionService.h"
+#include "NovelRT/Windowing/HeadlessContext.h"
 #include "NovelRT/Windowing/WindowingService.h"
 #include "NovelRT/Graphics/RenderingService.h"
 
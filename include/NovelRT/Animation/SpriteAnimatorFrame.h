@@ -14,18 +14,29 @@ namespace NovelRT::Animation {
     Utilities::Event<> FrameExit;
 
   private:
-    std::shared_ptr<Graphics::Texture> _texture;
+    Graphics::TextureRegion _region;
     Timing::Timestamp _duration;
 
   public:
     SpriteAnimatorFrame() : _duration(Timing::Timestamp::zero()) {}
 
     inline const std::shared_ptr<Graphics::Texture>& texture() const noexcept {
-      return _texture;
+      return _region.texture;
     }
 
     inline std::shared_ptr<Graphics::Texture>& texture() noexcept {
-      return _texture;
+      return _region.texture;
+    }
+
+    /**
+     * The part of the texture shown during this frame. Frames cut from the same SpriteAtlas share a texture, so moving between them only changes texture coordinates.
+     */
+    inline const Graphics::TextureRegion& region() const noexcept {
+      return _region;
+    }
+
+    inline Graphics::TextureRegion& region() noexcept {
+      return _region;
     }
 
     inline const Timing::Timestamp& duration() const noexcept {
@@ -30,6 +30,21 @@ namespace NovelRT {
       return _framesPerSecond;
     }
     void setFramesPerSecond(uint32_t value);
+
+    /**
+     * Gets how many GL state changes the renderer sent to the driver during the last frame.
+     */
+    uint32_t getIssuedGLStateChanges() const;
+
+    /**
+     * Gets how many GL state changes the renderer skipped during the last frame because they were already current.
+     */
+    uint32_t getElidedGLStateChanges() const;
+
+    /**
+     * Gets how many frames the renderer has skipped so far because nothing on screen had changed.
+     */
+    uint64_t getSkippedFrames() const;
   };
 }
 
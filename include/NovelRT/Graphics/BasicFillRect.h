@@ -8,22 +8,28 @@
 #endif
 
 namespace NovelRT::Graphics {
+  /**
+   * A rectangle filled with a single colour. Each one is drawn as two triangles through the renderer's ShapeBatch, so runs of them
+   * share a buffer upload and a draw call.
+   */
   class BasicFillRect : public RenderObject {
 
   private:
     RGBAConfig _colourConfig;
-    Utilities::Lazy<GLuint> _colourBuffer;
-    std::vector<GLfloat> _colourData;
+    std::array<uint8_t, 4> _colourData;
 
   protected:
     void configureObjectBuffers() final;
     void drawObject() final;
+    void recordCommands(RenderCommandList& commands) final;
+    bool isTranslucent() const noexcept final;
 
   public:
     BasicFillRect(Transform transform,
       int32_t layer,
       std::shared_ptr<Camera> camera,
       ShaderProgram shaderProgram,
+      std::shared_ptr<RenderingService> renderer,
       RGBAConfig fillColour);
 
     RGBAConfig getColourConfig() const;
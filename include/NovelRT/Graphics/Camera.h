@@ -49,6 +49,11 @@ namespace NovelRT::Graphics {
       return _cameraUboMatrix.getActual();
     }
 
+    /**
+     * Gets the world space region that this camera can see, found by projecting the corners of the view volume back into the world.
+     */
+    Maths::GeoBounds getVisibleBounds();
+
     inline CameraFrameState getFrameState() const {
       return _cameraFrameState;
     }
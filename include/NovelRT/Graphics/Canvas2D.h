@@ -0,0 +1,117 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_CANVAS2D_H
+#define NOVELRT_GRAPHICS_CANVAS2D_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Draws untextured shapes, such as separators, highlight boxes and debug outlines, without needing an object for each one.
+   * Shapes are given in world space, are turned into triangles as they are drawn, and stay on the canvas until it is cleared.
+   * The whole canvas is drawn at its layer through the renderer's ShapeBatch, where it shares a buffer upload and a draw call
+   * with the shapes drawn next to it.
+   *
+   * Canvases always draw in the translucent pass, so every shape covers the shapes drawn on the canvas before it, whatever its colour.
+   */
+  class Canvas2D : public RenderObject {
+  private:
+    std::vector<ShapeVertex> _vertices;
+    Maths::GeoVector2F _minimum;
+    Maths::GeoVector2F _maximum;
+
+    void addTriangle(Maths::GeoVector2F first, Maths::GeoVector2F second, Maths::GeoVector2F third, std::array<uint8_t, 4> colour);
+    void addQuad(Maths::GeoVector2F first, Maths::GeoVector2F second, Maths::GeoVector2F third, Maths::GeoVector2F fourth, std::array<uint8_t, 4> colour);
+    void addFan(Maths::GeoVector2F centre, const std::vector<Maths::GeoVector2F>& outline, std::array<uint8_t, 4> colour);
+
+  protected:
+    void configureObjectBuffers() final;
+    void drawObject() final;
+    void recordCommands(RenderCommandList& commands) final;
+    bool isTranslucent() const noexcept final;
+    Maths::GeoBounds getCullingBounds() const final;
+
+  public:
+    Canvas2D(int32_t layer, ShaderProgram shaderProgram, std::shared_ptr<Camera> camera, std::shared_ptr<RenderingService> renderer);
+
+    /**
+     * Gets how many straight segments a curve of this radius is drawn with, so that it never strays from the true curve by more
+     * than a quarter of a unit.
+     *
+     * @param radius The radius of the curve.
+     * @param angle How far the curve turns, in radians.
+     */
+    static uint32_t getCurveSegmentCount(float radius, float angle) noexcept;
+
+    /**
+     * Draws a filled rectangle.
+     *
+     * @param position The centre of the rectangle.
+     * @param size The width and height of the rectangle.
+     * @param colour The colour to fill it with.
+     */
+    void drawRect(Maths::GeoVector2F position, Maths::GeoVector2F size, RGBAConfig colour);
+
+    /**
+     * Draws a filled rectangle with rounded corners.
+     *
+     * @param position The centre of the rectangle.
+     * @param size The width and height of the rectangle.
+     * @param cornerRadius The radius of each corner. This is limited to half of the shorter side.
+     * @param colour The colour to fill it with.
+     */
+    void drawRoundedRect(Maths::GeoVector2F position, Maths::GeoVector2F size, float cornerRadius, RGBAConfig colour);
+
+    /**
+     * Draws a filled circle.
+     *
+     * @param centre The centre of the circle.
+     * @param radius The radius of the circle.
+     * @param colour The colour to fill it with.
+     */
+    void drawCircle(Maths::GeoVector2F centre, float radius, RGBAConfig colour);
+
+    /**
+     * Draws a straight line with square ends.
+     *
+     * @param start Where the line starts.
+     * @param end Where the line ends.
+     * @param thickness How thick the line is.
+     * @param colour The colour of the line.
+     */
+    void drawLine(Maths::GeoVector2F start, Maths::GeoVector2F end, float thickness, RGBAConfig colour);
+
+    /**
+     * Draws a line through a list of points, with mitred joins between its segments. Very sharp joins are cut short, so that they
+     * do not spike out far past the points.
+     *
+     * @param points The points the line passes through, in order. Repeated points are skipped.
+     * @param thickness How thick the line is.
+     * @param colour The colour of the line.
+     * @param isClosed Whether the line joins the last point back up with the first.
+     */
+    void drawPolyline(const std::vector<Maths::GeoVector2F>& points, float thickness, RGBAConfig colour, bool isClosed = false);
+
+    /**
+     * Removes every shape from the canvas. Clearing and drawing shapes both count as changes that stop an idle frame from being
+     * skipped, so shapes that stay the same are best left on the canvas rather than redrawn every frame.
+     */
+    void clear() noexcept;
+
+    inline const std::vector<ShapeVertex>& getVertices() const noexcept {
+      return _vertices;
+    }
+
+    /**
+     * Gets the smallest axis aligned box that contains every shape on the canvas.
+     */
+    inline Maths::GeoBounds getBounds() const noexcept {
+      if (_vertices.empty()) return Maths::GeoBounds(Maths::GeoVector2F::zero(), Maths::GeoVector2F::zero(), 0.0f);
+      return Maths::GeoBounds((_minimum + _maximum) / 2.0f, _maximum - _minimum, 0.0f);
+    }
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_CANVAS2D_H
@@ -0,0 +1,32 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_DISTANCEFIELDGENERATOR_H
+#define NOVELRT_GRAPHICS_DISTANCEFIELDGENERATOR_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Turns an anti-aliased coverage bitmap into a signed distance field. Each output byte stores the distance to the nearest
+   * edge, mapped so that 128 lies on the edge, larger values lie inside the shape and 0 or 255 lie spread pixels or more away.
+   * The anti-aliasing is used to place the edge between pixels, so the field is accurate to well under a pixel.
+   */
+  class DistanceFieldGenerator {
+  public:
+    /**
+     * Generates a distance field for a bitmap.
+     *
+     * @param coverage width * height bytes of coverage, with no row padding.
+     * @param width The width of the bitmap, in pixels.
+     * @param height The height of the bitmap, in pixels.
+     * @param spread The furthest distance from an edge that the field measures, in pixels. The field is padded by this much
+     * on every side, so that it has room to fade out around the shape.
+     * @returns (width + spread * 2) * (height + spread * 2) bytes of distance field.
+     */
+    static std::vector<uint8_t> generate(const uint8_t* coverage, uint32_t width, uint32_t height, uint32_t spread);
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_DISTANCEFIELDGENERATOR_H
@@ -0,0 +1,59 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_ETC2ENCODER_H
+#define NOVELRT_GRAPHICS_ETC2ENCODER_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Compresses RGBA images into ETC2, which every GLES 3.0 device can sample without decompressing. Only the individual and
+   * differential modes that ETC2 inherits from ETC1 are produced, which keeps the encoder small and fast at some cost in quality
+   * on hard colour edges. Like PngCodec, nothing here touches OpenGL, so it is safe to use from tools.
+   */
+  class Etc2Encoder {
+  public:
+    static const uint32_t BlockDimension = 4;
+    static const size_t Rgb8BlockSize = 8;
+    static const size_t Rgba8BlockSize = 16;
+
+    /**
+     * Encodes one 4x4 block of RGBA pixels as a GL_COMPRESSED_RGB8_ETC2 block. Alpha is ignored.
+     *
+     * @param pixels The top left pixel of the block.
+     * @param rowStride The distance in bytes from one row of pixels to the next.
+     * @param block Receives the Rgb8BlockSize bytes of the block.
+     */
+    static void encodeRgb8Block(const uint8_t* pixels, size_t rowStride, uint8_t* block) noexcept;
+
+    /**
+     * Encodes the alpha of one 4x4 block of RGBA pixels as the EAC half of a GL_COMPRESSED_RGBA8_ETC2_EAC block.
+     *
+     * @param pixels The top left pixel of the block.
+     * @param rowStride The distance in bytes from one row of pixels to the next.
+     * @param block Receives the 8 bytes of the alpha block.
+     */
+    static void encodeAlphaBlock(const uint8_t* pixels, size_t rowStride, uint8_t* block) noexcept;
+
+    /**
+     * Encodes a whole image as GL_COMPRESSED_RGB8_ETC2. Images that are not a multiple of 4 pixels in size are padded by
+     * repeating their last row and column.
+     */
+    static std::vector<uint8_t> encodeRgb8(const RgbaImage& image);
+
+    /**
+     * Encodes a whole image as GL_COMPRESSED_RGBA8_ETC2_EAC. Images that are not a multiple of 4 pixels in size are padded by
+     * repeating their last row and column.
+     */
+    static std::vector<uint8_t> encodeRgba8(const RgbaImage& image);
+
+    /**
+     * Gets the number of bytes an encoded image of the given size takes up. This is the imageSize that glCompressedTexImage2D expects.
+     */
+    static size_t getEncodedSize(uint32_t width, uint32_t height, bool hasAlpha) noexcept;
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_ETC2ENCODER_H
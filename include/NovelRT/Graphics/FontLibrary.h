@@ -0,0 +1,84 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_FONTLIBRARY_H
+#define NOVELRT_GRAPHICS_FONTLIBRARY_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * A glyph bitmap rasterised by FreeType, copied out of the face so it can outlive it.
+   */
+  struct RasterisedGlyph {
+    char32_t codepoint = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    int32_t bearingX = 0;
+    int32_t bearingY = 0;
+    int32_t advance = 0;
+    std::vector<uint8_t> pixels; // width * height bytes of coverage, with no row padding
+    bool isSuccessful = false;
+  };
+
+  /**
+   * Owns the FreeType library shared by every FontSet. Each font file is memory mapped once, however many sizes or faces are
+   * created from it, and stays mapped for as long as a face still uses it.
+   */
+  class FontLibrary : public std::enable_shared_from_this<FontLibrary> {
+  public:
+    static const size_t MaximumRasteriserCount = 4;
+
+  private:
+    FT_Library _library;
+    std::mutex _libraryMutex;
+    Utilities::ResourceCache<std::string, Utilities::MemoryMappedFile> _mappedFiles;
+    LoggingService _logger;
+
+    std::shared_ptr<Utilities::MemoryMappedFile> getMappedFile(const std::string& file);
+
+  public:
+    /**
+     * Creates the library.
+     *
+     * @exception Exceptions::InitialisationFailureException Thrown when FreeType cannot be initialised.
+     */
+    FontLibrary();
+    FontLibrary(const FontLibrary&) = delete;
+    FontLibrary& operator=(const FontLibrary&) = delete;
+
+    /**
+     * Creates a new face for a font file, reading it from the file's shared memory mapping. Faces must only be used by one
+     * thread at a time, but any thread may create or release one.
+     *
+     * @param file The font file.
+     * @param pixelSize The height in pixels to rasterise glyphs at.
+     * @returns The face. Releasing the last reference closes the face.
+     * @exception Exceptions::FileNotFoundException Thrown when the file cannot be opened.
+     * @exception Exceptions::IOException Thrown when FreeType cannot read a face from the file.
+     */
+    std::shared_ptr<FT_FaceRec_> createFace(const std::string& file, uint32_t pixelSize);
+
+    /**
+     * Rasterises a set of codepoints on worker threads, each with its own face, and returns the bitmaps in the same order as
+     * the codepoints. No GL calls are made, so the caller is free to upload the results however it likes.
+     *
+     * @param distanceFieldSpread When not 0, each bitmap is turned into a signed distance field this many pixels wider on every
+     * side, with its bearings moved to match. The conversion runs on the worker threads too.
+     */
+    std::vector<RasterisedGlyph> rasteriseGlyphs(const std::string& file, uint32_t pixelSize, const std::vector<char32_t>& codepoints,
+      uint32_t distanceFieldSpread = 0);
+
+    /**
+     * Rasterises one codepoint with an existing face, optionally as a signed distance field.
+     *
+     * @returns Whether the face could render the codepoint.
+     */
+    static bool tryRasteriseGlyph(FT_Face face, char32_t codepoint, RasterisedGlyph& glyph, uint32_t distanceFieldSpread = 0);
+
+    ~FontLibrary();
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_FONTLIBRARY_H
@@ -0,0 +1,17 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_FONTRENDERMODE_H
+#define NOVELRT_GRAPHICS_FONTRENDERMODE_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  enum class FontRenderMode {
+    Bitmap, // Glyphs are rasterised at exactly the requested size, with one FontSet per size.
+    DistanceField // Glyphs are stored as signed distance fields, with one FontSet drawing every size, outlines and drop shadows.
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_FONTRENDERMODE_H
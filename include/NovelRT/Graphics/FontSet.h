@@ -8,55 +8,97 @@
 #include "NovelRT/Exceptions/CharacterNotFoundException.h"
 
 namespace NovelRT::Graphics {
+  /**
+   * Rasterises the glyphs of a font at one size into a small number of atlas textures. The ASCII range is rasterised up
+   * front on the FontLibrary's worker threads and uploaded in one go; every other glyph is added the first time it is asked for.
+   * A FontSet loaded as a distance field stores its glyphs at DistanceFieldBaseSize and can be drawn at any size.
+   */
   class FontSet : public std::enable_shared_from_this<FontSet> {
     friend class ImageRect;
     friend class TextRect;
     friend class RenderingService;
+  public:
+    static const uint32_t DistanceFieldBaseSize = 48;
+    static const uint32_t DistanceFieldSpread = 6;
+
   private:
+    static const uint32_t AtlasPageSize = 1024;
+    static const uint32_t GlyphPadding = 1;
+    static const char32_t AsciiCharacterCount = 128;
+
     std::shared_ptr<RenderingService> _renderer;
     Atom _id;
     float _fontSize;
-    std::vector<GraphicsCharacterRenderData> _characters;
+    FontRenderMode _renderMode;
     LoggingService _logger; //not proud of this
     std::string _fontFile;
-    std::map<GLchar, GraphicsCharacterRenderData> _fontCharacters;
-
-
-
-    inline const std::vector<GraphicsCharacterRenderData>& getCharacterRenderDataInternal() const noexcept {
-      return _characters;
-    }
+    std::shared_ptr<FT_FaceRec_> _face;
+    std::vector<std::shared_ptr<Texture>> _atlasPages;
+    std::vector<GLubyte> _stagingPixels;
+    std::unique_ptr<SkylinePacker> _atlasPacker;
+    std::array<GraphicsCharacterRenderData, AsciiCharacterCount> _asciiCharacters;
+    std::unordered_map<char32_t, GraphicsCharacterRenderData> _extendedCharacters;
+
+    void loadGlyphs(const std::string& file, float fontSize);
+    void addAtlasPage();
+    void flushAtlasPage();
+    bool tryPackGlyph(const RasterisedGlyph& glyph, GraphicsCharacterRenderData& character);
 
     inline Atom getId() const noexcept {
       return _id;
     }
 
-    inline GraphicsCharacterRenderData getCharacterBasedonGLchar(char c) const {
-      auto match = _fontCharacters.find(c);
-      if (match == _fontCharacters.end()) {
-        match = _fontCharacters.begin();
-      }
+    inline uint32_t getDistanceFieldSpread() const noexcept {
+      return _renderMode == FontRenderMode::DistanceField ? DistanceFieldSpread : 0;
+    }
 
-      if (match == _fontCharacters.end()) {
-        throw Exceptions::CharacterNotFoundException(c);
-      }
+    /**
+     * Gets the glyph for a codepoint, rasterising it first if this is the first time it has been asked for.
+     * Codepoints the font cannot provide fall back to the glyph for codepoint 0, which is usually the font's missing glyph box.
+     */
+    const GraphicsCharacterRenderData& getCharacter(char32_t codepoint);
 
-      return match->second;
-    }
+    /**
+     * Gets the horizontal adjustment in pixels to apply between two codepoints. Fonts without kerning data always return 0.
+     */
+    int32_t getKerning(char32_t left, char32_t right) const;
 
   public:
     FontSet(std::shared_ptr<RenderingService> renderer, Atom id) noexcept;
 
     void loadFontAsTextureSet(const std::string& file, float fontSize);
 
+    /**
+     * Loads a font as signed distance fields rasterised at DistanceFieldBaseSize. Text drawn with it stays sharp at any size,
+     * and can have outlines and drop shadows. It must be drawn with the distance field font shader.
+     *
+     * @param file The font file.
+     * @exception Exceptions::InvalidOperationException Thrown when this FontSet has already been loaded.
+     */
+    void loadFontAsDistanceField(const std::string& file);
+
     inline std::string getFontFile() const noexcept {
       return _fontFile;
     }
 
+    /**
+     * Gets the pixel size the glyphs were rasterised at. For distance field fonts this is always DistanceFieldBaseSize.
+     */
     inline float getFontSize() const noexcept {
       return _fontSize;
     }
 
+    inline FontRenderMode getRenderMode() const noexcept {
+      return _renderMode;
+    }
+
+    /**
+     * Gets the number of atlas textures this FontSet has created so far.
+     */
+    inline size_t getAtlasPageCount() const noexcept {
+      return _atlasPages.size();
+    }
+
     ~FontSet();
   };
 }
@@ -0,0 +1,119 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_GLSTATECACHE_H
+#define NOVELRT_GRAPHICS_GLSTATECACHE_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Remembers the GL bindings the engine has made and skips any call that would set state that is already current.
+   * Everything that binds programs, vertex arrays, textures or buffers must go through here, otherwise the cache goes stale.
+   * Code that has to touch GL directly should call invalidate() afterwards.
+   */
+  class GLStateCache {
+  private:
+    static const GLuint UnknownBinding = std::numeric_limits<GLuint>::max();
+
+    GLuint _program;
+    GLuint _vertexArray;
+    GLuint _texture2D;
+    GLuint _arrayBuffer;
+    GLuint _uniformBuffer;
+    GLuint _pixelUnpackBuffer;
+    GLenum _blendSourceFactor;
+    GLenum _blendDestinationFactor;
+    GLenum _blendSourceAlphaFactor;
+    GLenum _blendDestinationAlphaFactor;
+    GLuint _depthMask;
+    std::unordered_map<GLenum, bool> _capabilities;
+    uint32_t _issuedCallCount;
+    uint32_t _elidedCallCount;
+    uint32_t _lastFrameIssuedCallCount;
+    uint32_t _lastFrameElidedCallCount;
+
+    GLuint* getBufferBinding(GLenum target) noexcept;
+    void setCapability(GLenum capability, bool isEnabled);
+
+  public:
+    GLStateCache() noexcept;
+    GLStateCache(const GLStateCache&) = delete;
+    GLStateCache& operator=(const GLStateCache&) = delete;
+
+    void useProgram(GLuint program);
+    void bindVertexArray(GLuint vertexArray);
+
+    /**
+     * Binds a texture to GL_TEXTURE_2D on texture unit 0, the only unit the engine caches. ScreenTransition binds its extra inputs
+     * to the units above it directly, and always leaves unit 0 active.
+     */
+    void bindTexture2D(GLuint texture);
+
+    /**
+     * Binds a buffer. GL_ARRAY_BUFFER, GL_UNIFORM_BUFFER and GL_PIXEL_UNPACK_BUFFER are cached. Every other target is passed
+     * straight through; GL_ELEMENT_ARRAY_BUFFER in particular belongs to the bound vertex array rather than the context.
+     */
+    void bindBuffer(GLenum target, GLuint buffer);
+
+    inline void enable(GLenum capability) {
+      setCapability(capability, true);
+    }
+
+    inline void disable(GLenum capability) {
+      setCapability(capability, false);
+    }
+
+    void blendFunc(GLenum sourceFactor, GLenum destinationFactor);
+    void blendFuncSeparate(GLenum sourceFactor, GLenum destinationFactor, GLenum sourceAlphaFactor, GLenum destinationAlphaFactor);
+    void depthMask(GLboolean isEnabled);
+
+    /**
+     * Must be called after deleting a program. A deleted program stays in use until another one replaces it, so the next
+     * useProgram call is always issued.
+     */
+    void onProgramDeleted(GLuint program) noexcept;
+
+    /**
+     * Must be called after deleting a vertex array. GL falls back to vertex array 0 if the deleted one was bound.
+     */
+    void onVertexArrayDeleted(GLuint vertexArray) noexcept;
+
+    /**
+     * Must be called after deleting a texture. GL unbinds a deleted texture from every unit it was bound to.
+     */
+    void onTextureDeleted(GLuint texture) noexcept;
+
+    /**
+     * Must be called after deleting a buffer. GL unbinds a deleted buffer from every target it was bound to.
+     */
+    void onBufferDeleted(GLuint buffer) noexcept;
+
+    /**
+     * Forgets everything, so that the next call of each kind is issued no matter what it sets.
+     */
+    void invalidate() noexcept;
+
+    /**
+     * Stores this frame's call counts where the getters below can read them, then starts counting the next frame.
+     */
+    void endFrame() noexcept;
+
+    /**
+     * Gets how many state changes reached the driver during the last frame.
+     */
+    inline uint32_t getLastFrameIssuedCallCount() const noexcept {
+      return _lastFrameIssuedCallCount;
+    }
+
+    /**
+     * Gets how many state changes were skipped during the last frame because the state was already current.
+     */
+    inline uint32_t getLastFrameElidedCallCount() const noexcept {
+      return _lastFrameElidedCallCount;
+    }
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_GLSTATECACHE_H
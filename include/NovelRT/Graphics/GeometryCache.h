@@ -0,0 +1,56 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_GEOMETRYCACHE_H
+#define NOVELRT_GRAPHICS_GEOMETRYCACHE_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Owns the geometry shared by every RenderObject. Each RenderObject is a unit quad centred on the origin that its model
+   * matrix stretches into place, so one indexed quad in VRAM is enough for the whole scene.
+   */
+  class GeometryCache {
+  private:
+    std::shared_ptr<GLStateCache> _glState;
+    Utilities::Lazy<GLuint> _unitQuadVertexBuffer;
+    Utilities::Lazy<GLuint> _unitQuadIndexBuffer;
+    Utilities::Lazy<GLuint> _unitQuadVertexArray;
+
+  public:
+    static const GLuint VertexPositionLocation = 0;
+    static const GLsizei UnitQuadIndexCount = 6;
+
+    /**
+     * The four corners of the unit quad as x, y, z triples, in the order top left, top right, bottom right, bottom left.
+     */
+    static const std::array<GLfloat, 12> UnitQuadVertices;
+
+    /**
+     * Two triangles over UnitQuadVertices, wound the same way as the original six-vertex quad.
+     */
+    static const std::array<GLushort, UnitQuadIndexCount> UnitQuadIndices;
+
+    GeometryCache(std::shared_ptr<GLStateCache> glState) noexcept;
+    GeometryCache(const GeometryCache&) = delete;
+    GeometryCache& operator=(const GeometryCache&) = delete;
+
+    /**
+     * Attaches the shared quad vertices to VertexPositionLocation and the shared index buffer to the vertex array object that is
+     * currently bound. Use this when building a vertex array object that needs additional attributes, such as per-instance data.
+     */
+    void attachUnitQuadToBoundVertexArray();
+
+    /**
+     * Gets a vertex array object that contains only the unit quad. Bind it and call glDrawElements with UnitQuadIndexCount and
+     * GL_UNSIGNED_SHORT to draw a single quad. Creating it on the first call leaves it bound.
+     */
+    GLuint getUnitQuadVertexArray();
+
+    ~GeometryCache();
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_GEOMETRYCACHE_H
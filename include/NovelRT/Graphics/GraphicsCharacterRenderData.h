@@ -10,12 +10,13 @@
 namespace NovelRT::Graphics {
   struct GraphicsCharacterRenderData {
   public:
-    std::shared_ptr<Texture> texture;  // ID handle of the glyph texture
+    std::shared_ptr<Texture> texture;  // The atlas page the glyph was rasterised into
     uint32_t sizeX;       // Size of glyph
     uint32_t sizeY;       // Size of glyph
     int32_t bearingX;    // Offset from baseline to left/top of glyph
     int32_t bearingY;    // Offset from baseline to left/top of glyph
     int32_t advance;    // Offset to advance to next glyph
+    Maths::GeoVector4F uvRect;  // Origin (x, y) and size (z, w) of the glyph within its atlas page
   };
 }
 
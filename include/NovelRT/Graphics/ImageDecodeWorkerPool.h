@@ -0,0 +1,96 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_IMAGEDECODEWORKERPOOL_H
+#define NOVELRT_GRAPHICS_IMAGEDECODEWORKERPOOL_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Decodes image files on a small pool of worker threads. Finished images are collected by whoever owns the pool, and their
+   * pixel buffers can be handed back afterwards so that the next decode does not have to allocate a fresh one.
+   * Nothing here touches OpenGL. The workers are only started once the first request comes in.
+   */
+  class ImageDecodeWorkerPool {
+  public:
+    struct Result {
+      uint64_t requestId;
+      std::string file;
+      RgbaImage image;
+      TextureAlphaMode alphaMode;
+      bool isSuccessful;
+    };
+
+  private:
+    struct Request {
+      uint64_t requestId;
+      std::string file;
+    };
+
+    size_t _workerCount;
+    size_t _maxPooledImages;
+    std::vector<std::thread> _workers;
+    mutable std::mutex _mutex;
+    std::condition_variable _requestAvailable;
+    std::deque<Request> _requests;
+    std::deque<Result> _results;
+    std::vector<RgbaImage> _imagePool;
+    size_t _resultBytes;
+    size_t _activeDecodeCount;
+    bool _isStopping;
+
+    void runWorker();
+
+  public:
+    /**
+     * @param workerCount The number of threads to decode on.
+     * @param maxPooledImages The most pixel buffers to keep around for reuse. Anything recycled beyond this is freed.
+     */
+    explicit ImageDecodeWorkerPool(size_t workerCount, size_t maxPooledImages = 4) noexcept;
+    ImageDecodeWorkerPool(const ImageDecodeWorkerPool&) = delete;
+    ImageDecodeWorkerPool& operator=(const ImageDecodeWorkerPool&) = delete;
+
+    /**
+     * Queues a PNG or QOI file to be decoded. Files ending in .qoi are read as QOI, and everything else as PNG.
+     *
+     * @param requestId An identifier that is handed back with the result.
+     * @param file The path of the image file.
+     */
+    void request(uint64_t requestId, const std::string& file);
+
+    /**
+     * Takes the oldest finished decode, if there is one and its pixels fit in the given number of bytes.
+     * Failed decodes are always taken, as they carry no pixels.
+     *
+     * @param result Receives the finished decode.
+     * @param maxBytes The largest image, in bytes, the caller is willing to take right now.
+     * @returns Whether a result was taken.
+     */
+    bool tryTakeResult(Result& result, size_t maxBytes = std::numeric_limits<size_t>::max());
+
+    /**
+     * Hands a pixel buffer back so that a later decode can reuse its memory.
+     */
+    void recycle(RgbaImage image);
+
+    /**
+     * Gets the number of bytes of decoded pixels that are waiting to be taken.
+     */
+    size_t getResultBytes() const;
+
+    /**
+     * Gets the number of files that are queued or being decoded.
+     */
+    size_t getPendingRequestCount() const;
+
+    inline size_t getWorkerCount() const noexcept {
+      return _workerCount;
+    }
+
+    ~ImageDecodeWorkerPool();
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_IMAGEDECODEWORKERPOOL_H
@@ -11,23 +11,30 @@ namespace NovelRT::Graphics {
   class ImageRect : public RenderObject {
 
   private:
-    std::vector<GLfloat> _uvCoordinates;
     std::shared_ptr<Texture> _texture;
-    Utilities::Lazy<GLuint> _uvBuffer;
-    Utilities::Lazy<GLuint> _colourTintBuffer;
     RGBAConfig _colourTint;
-    std::vector<GLfloat> _colourTintData;
+    Maths::GeoVector4F _uvRect;
+    Maths::GeoVector4F _contentRect;
+    SpriteInstanceData _instanceData;
+    bool _isInstanceTransformDirty;
     LoggingService _logger;
 
+    Maths::GeoMatrix4x4F getInstanceTransform();
+    GLuint getSpriteShaderProgramId() const noexcept;
+
   protected:
     void configureObjectBuffers() final;
     void drawObject() final;
+    void recordCommands(RenderCommandList& commands) final;
+    bool isTranslucent() const noexcept final;
+    GLuint getSortTextureId() noexcept final;
 
   public:
     ImageRect(Transform transform,
       int32_t layer,
       ShaderProgram shaderProgram,
       std::shared_ptr<Camera> camera,
+      std::shared_ptr<RenderingService> renderer,
       std::shared_ptr<Texture> texture,
       RGBAConfig colourTint);
 
@@ -35,6 +42,7 @@ namespace NovelRT::Graphics {
       int32_t layer,
       ShaderProgram shaderProgram,
       std::shared_ptr<Camera> camera,
+      std::shared_ptr<RenderingService> renderer,
       RGBAConfig colourTint);
 
     const std::shared_ptr<Texture>& texture() const noexcept {
@@ -45,6 +53,36 @@ namespace NovelRT::Graphics {
       return _texture;
     }
 
+    /**
+     * The region of the texture to draw, as an origin (x, y) and size (z, w) in texture coordinates. Defaults to the whole texture.
+     */
+    inline Maths::GeoVector4F uvRect() const {
+      return _uvRect;
+    }
+
+    inline Maths::GeoVector4F& uvRect() {
+      _isDirty = true;
+      return _uvRect;
+    }
+
+    /**
+     * The part of this rect the texture is drawn into, as an origin (x, y) and size (z, w) in fractions of the rect. Defaults to the whole rect.
+     */
+    inline Maths::GeoVector4F contentRect() const {
+      return _contentRect;
+    }
+
+    inline Maths::GeoVector4F& contentRect() {
+      _isDirty = true;
+      return _contentRect;
+    }
+
+    /**
+     * Draws a region of a texture, such as a frame from a SpriteAtlas. Moving between regions of the same texture only
+     * changes texture coordinates, so the rect keeps batching with everything else that uses that texture.
+     */
+    void setTextureRegion(const TextureRegion& region);
+
     inline RGBAConfig colourTint() const {
       return _colourTint;
     }
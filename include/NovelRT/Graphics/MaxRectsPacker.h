@@ -0,0 +1,64 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_MAXRECTSPACKER_H
+#define NOVELRT_GRAPHICS_MAXRECTSPACKER_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Packs rectangles into a fixed size page by keeping every maximal free rectangle left in it, and placing each new rectangle
+   * in the free one it fits most snugly. This packs much tighter than SkylinePacker when the sizes vary a lot, at the cost of
+   * being slower, so it is meant for packing a known set of images up front rather than one at a time while drawing.
+   */
+  class MaxRectsPacker {
+  private:
+    struct FreeRect {
+      uint32_t x;
+      uint32_t y;
+      uint32_t width;
+      uint32_t height;
+    };
+
+    uint32_t _width;
+    uint32_t _height;
+    uint64_t _usedArea;
+    std::vector<FreeRect> _freeRects;
+
+    void splitFreeRects(const FreeRect& placed);
+    void pruneFreeRects();
+
+  public:
+    MaxRectsPacker(uint32_t width, uint32_t height) noexcept;
+
+    /**
+     * Reserves space for a rectangle of the given size.
+     *
+     * @param width The width of the rectangle.
+     * @param height The height of the rectangle.
+     * @param x Receives the left edge of the reserved space.
+     * @param y Receives the top edge of the reserved space.
+     * @returns Whether there was enough space left. Nothing is reserved when this returns false.
+     */
+    bool tryPack(uint32_t width, uint32_t height, uint32_t& x, uint32_t& y);
+
+    /**
+     * Gets the fraction of the page that has been reserved so far, from 0 to 1.
+     */
+    inline float getOccupancy() const noexcept {
+      return static_cast<float>(_usedArea) / (static_cast<float>(_width) * static_cast<float>(_height));
+    }
+
+    inline uint32_t getWidth() const noexcept {
+      return _width;
+    }
+
+    inline uint32_t getHeight() const noexcept {
+      return _height;
+    }
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_MAXRECTSPACKER_H
@@ -0,0 +1,35 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_OPENGLSPRITEBATCHBACKEND_H
+#define NOVELRT_GRAPHICS_OPENGLSPRITEBATCHBACKEND_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Draws each SpriteBatchGroup with a single glDrawElementsInstanced call over the GeometryCache's unit quad, streaming the
+   * instance data through one shared buffer.
+   */
+  class OpenGLSpriteBatchBackend : public SpriteBatchBackend {
+  private:
+    std::shared_ptr<GLStateCache> _glState;
+    std::shared_ptr<GeometryCache> _geometryCache;
+    Utilities::Lazy<GLuint> _vertexArrayObject;
+    Utilities::Lazy<GLuint> _instanceBuffer;
+    size_t _instanceBufferCapacity;
+
+    void configureVertexArray();
+    void bindInstanceAttributes(size_t firstInstance);
+
+  public:
+    OpenGLSpriteBatchBackend(std::shared_ptr<GLStateCache> glState, std::shared_ptr<GeometryCache> geometryCache) noexcept;
+
+    void submit(const std::vector<SpriteInstanceData>& instances, const std::vector<SpriteBatchGroup>& groups) final;
+
+    ~OpenGLSpriteBatchBackend();
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_OPENGLSPRITEBATCHBACKEND_H
@@ -0,0 +1,70 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_PARTICLECURVE_H
+#define NOVELRT_GRAPHICS_PARTICLECURVE_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * A value that changes over the lifetime of a particle, given as keys at times from 0 (when the particle is emitted) to 1 (when
+   * it dies). Values between keys are linearly interpolated, and values before the first key or after the last one hold steady.
+   * A curve with a single key is constant.
+   *
+   * Emitters bake their curves into lookup tables when their settings are applied, so curves are never evaluated per particle.
+   */
+  template<typename T>
+  class ParticleCurve {
+  public:
+    struct Key {
+      float time;
+      T value;
+    };
+
+  private:
+    std::vector<Key> _keys;
+
+  public:
+    explicit ParticleCurve(T value) : _keys{ Key{0.0f, value} } {}
+
+    ParticleCurve(std::initializer_list<Key> keys) : _keys() {
+      for (const auto& key : keys) {
+        addKey(key.time, key.value);
+      }
+    }
+
+    /**
+     * Adds a key to the curve. A key at the same time as an existing one is placed after it, which makes the curve jump.
+     *
+     * @param time When in the particle's lifetime the key is, from 0 to 1.
+     * @param value The value at that time.
+     */
+    void addKey(float time, T value) {
+      auto clampedTime = std::clamp(time, 0.0f, 1.0f);
+      auto position = std::upper_bound(_keys.begin(), _keys.end(), clampedTime, [](float left, const Key& right) { return left < right.time; });
+      _keys.insert(position, Key{clampedTime, value});
+    }
+
+    /**
+     * Gets the value of the curve at a time from 0 to 1.
+     */
+    T evaluate(float time) const {
+      if (_keys.empty()) return T{};
+      if (time <= _keys.front().time) return _keys.front().value;
+      if (time >= _keys.back().time) return _keys.back().value;
+
+      auto next = std::upper_bound(_keys.begin(), _keys.end(), time, [](float left, const Key& right) { return left < right.time; });
+      auto previous = next - 1;
+      auto fraction = (time - previous->time) / (next->time - previous->time);
+      return previous->value + (next->value - previous->value) * fraction;
+    }
+
+    inline const std::vector<Key>& getKeys() const noexcept {
+      return _keys;
+    }
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_PARTICLECURVE_H
@@ -0,0 +1,139 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_PARTICLEEMITTER_H
+#define NOVELRT_GRAPHICS_PARTICLEEMITTER_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Emits and simulates particles that all share one texture. Particles are held in structure of arrays form and moved in one pass
+   * a frame, several at a time with SSE2 or AVX2 when the build targets them. The curves in the emitter's settings are baked into
+   * lookup tables, so a particle's speed, size and colour are a table read for its age rather than a curve evaluation.
+   *
+   * Particles live in world space, so moving the emitter only moves where new particles appear. Dead particles are replaced by the
+   * last particle alive, which means particles are not drawn in the order they were emitted.
+   */
+  class ParticleEmitter {
+  public:
+    /**
+     * How many entries each curve is baked into.
+     */
+    static const size_t CurveTableSize = 64;
+
+  private:
+    std::shared_ptr<Texture> _texture;
+    ParticleEmitterSettings _settings;
+    std::vector<float> _positionX;
+    std::vector<float> _positionY;
+    std::vector<float> _velocityX;
+    std::vector<float> _velocityY;
+    std::vector<float> _rotation;
+    std::vector<float> _angularVelocity;
+    std::vector<float> _age;
+    std::vector<float> _inverseLifetime;
+    size_t _particleCount;
+    std::vector<float> _speedTable;
+    std::vector<Maths::GeoVector2F> _sizeTable;
+    std::vector<Maths::GeoVector4F> _colourTable;
+    float _maxParticleExtent;
+    Maths::GeoVector2F _minimum;
+    Maths::GeoVector2F _maximum;
+    float _emissionAccumulator;
+    uint64_t _randomState;
+    bool _isEmitting;
+
+    float nextRandom() noexcept;
+    float getRandomInRange(float minimum, float maximum) noexcept;
+    void bakeCurves();
+    void integrate(float seconds) noexcept;
+    void removeDeadParticles() noexcept;
+    void emit(uint32_t count, Maths::GeoVector2F position) noexcept;
+
+  public:
+    /**
+     * @param texture The texture every particle draws.
+     * @param settings How particles are emitted and how they change over their lifetimes.
+     * @param seed The seed for the emitter's random numbers. Emitters with the same seed and settings behave the same.
+     */
+    ParticleEmitter(std::shared_ptr<Texture> texture, const ParticleEmitterSettings& settings, uint64_t seed = 1);
+
+    /**
+     * Moves and ages every particle, removes the ones that have died and emits new ones.
+     *
+     * @param seconds How much time has passed since the last update.
+     * @param position Where the ParticleSystem that owns this emitter is. The emitter's offset is added to this.
+     */
+    void update(float seconds, Maths::GeoVector2F position) noexcept;
+
+    /**
+     * Emits a number of particles straight away, whether or not the emitter is emitting, as long as there is room for them.
+     *
+     * @param count How many particles to emit.
+     * @param position Where the ParticleSystem that owns this emitter is. The emitter's offset is added to this.
+     */
+    void burst(uint32_t count, Maths::GeoVector2F position) noexcept;
+
+    /**
+     * Writes a sprite instance for every particle alive.
+     *
+     * @param target Where to write the instances. There must be room for getParticleCount() of them.
+     * @param depth The z every instance is drawn at.
+     */
+    void writeInstances(SpriteInstanceData* target, float depth) const noexcept;
+
+    /**
+     * Removes every particle straight away.
+     */
+    void clear() noexcept;
+
+    inline const std::shared_ptr<Texture>& getTexture() const noexcept {
+      return _texture;
+    }
+
+    inline void setTexture(std::shared_ptr<Texture> value) noexcept {
+      _texture = value;
+    }
+
+    inline const ParticleEmitterSettings& getSettings() const noexcept {
+      return _settings;
+    }
+
+    /**
+     * Replaces the emitter's settings and bakes their curves. Particles already alive keep what they were emitted with, but take
+     * their speed, size and colour from the new curves. Particles past the new maximum are removed.
+     */
+    void setSettings(const ParticleEmitterSettings& value);
+
+    inline size_t getParticleCount() const noexcept {
+      return _particleCount;
+    }
+
+    /**
+     * Gets whether the emitter emits new particles as it is updated. Particles already alive carry on either way.
+     */
+    inline bool isEmitting() const noexcept {
+      return _isEmitting;
+    }
+
+    inline void setEmitting(bool value) noexcept {
+      _isEmitting = value;
+      _emissionAccumulator = 0.0f;
+    }
+
+    /**
+     * Gets an axis aligned box that contains every particle alive, at any rotation. Particles that died in the last update may
+     * still be counted.
+     */
+    Maths::GeoBounds getBounds() const noexcept;
+
+    /**
+     * Gets the instruction set the particle kernel was compiled for: "AVX2", "SSE2" or "Scalar".
+     */
+    static const char* getInstructionSet() noexcept;
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_PARTICLEEMITTER_H
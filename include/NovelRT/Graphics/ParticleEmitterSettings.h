@@ -0,0 +1,75 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_PARTICLEEMITTERSETTINGS_H
+#define NOVELRT_GRAPHICS_PARTICLEEMITTERSETTINGS_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Describes how a ParticleEmitter emits its particles and how they change over their lifetimes. Ranges are given as a minimum
+   * and maximum, and every particle picks its own value from each range when it is emitted. Distances are in world units, times
+   * in seconds and angles in degrees.
+   */
+  struct ParticleEmitterSettings {
+    /**
+     * How many particles are emitted every second while the emitter is emitting.
+     */
+    float emissionRate = 10.0f;
+
+    /**
+     * The most particles the emitter holds at once. Nothing is emitted while it is full.
+     */
+    uint32_t maxParticles = 1000;
+
+    float minLifetime = 1.0f;
+    float maxLifetime = 1.0f;
+
+    /**
+     * Where the emitter sits, relative to the position of the ParticleSystem that owns it.
+     */
+    Maths::GeoVector2F offset = Maths::GeoVector2F::zero();
+
+    /**
+     * The size of the box, centred on the emitter, that particles are emitted at random points within.
+     */
+    Maths::GeoVector2F spawnAreaSize = Maths::GeoVector2F::zero();
+
+    Maths::GeoVector2F minVelocity = Maths::GeoVector2F::zero();
+    Maths::GeoVector2F maxVelocity = Maths::GeoVector2F::zero();
+
+    /**
+     * A constant change in velocity every second, such as gravity or wind.
+     */
+    Maths::GeoVector2F acceleration = Maths::GeoVector2F::zero();
+
+    float minRotation = 0.0f;
+    float maxRotation = 0.0f;
+    float minAngularVelocity = 0.0f;
+    float maxAngularVelocity = 0.0f;
+
+    /**
+     * The region of the emitter's texture that every particle draws, as an origin (x, y) and size (z, w) in texture coordinates.
+     */
+    Maths::GeoVector4F uvRect = Maths::GeoVector4F(0.0f, 0.0f, 1.0f, 1.0f);
+
+    /**
+     * The colour of a particle over its lifetime, as normalised RGBA scalars. This tints the texture.
+     */
+    ParticleCurve<Maths::GeoVector4F> colourOverLifetime = ParticleCurve<Maths::GeoVector4F>(Maths::GeoVector4F(1.0f, 1.0f, 1.0f, 1.0f));
+
+    /**
+     * The width and height of a particle over its lifetime.
+     */
+    ParticleCurve<Maths::GeoVector2F> sizeOverLifetime = ParticleCurve<Maths::GeoVector2F>(Maths::GeoVector2F(16.0f, 16.0f));
+
+    /**
+     * How much of its velocity a particle moves with over its lifetime. A curve that falls to 0 brings particles to a stop.
+     */
+    ParticleCurve<float> speedOverLifetime = ParticleCurve<float>(1.0f);
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_PARTICLEEMITTERSETTINGS_H
@@ -0,0 +1,80 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_PARTICLESYSTEM_H
+#define NOVELRT_GRAPHICS_PARTICLESYSTEM_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Draws the particles of one or more ParticleEmitters, such as rain, sparks or falling petals, at its layer. Every particle of an
+   * emitter is written into the renderer's SpriteBatch as an instance, so each emitter costs one instanced draw however many particles
+   * it has alive. Emitters are positioned relative to the system's transform; the rest of the transform is not used.
+   *
+   * Particles only move when the system is updated, either by calling update directly or by playing it on a NovelRunner, which
+   * updates it every frame and keeps the frames coming for as long as any particles are alive.
+   */
+  class ParticleSystem : public RenderObject {
+  private:
+    std::vector<std::unique_ptr<ParticleEmitter>> _emitters;
+    std::vector<SpriteInstanceData> _instances;
+    NovelRunner* _runner;
+    Utilities::EventHandler<Timing::Timestamp> _updateHandler;
+
+    void onUpdate(Timing::Timestamp delta);
+
+  protected:
+    void configureObjectBuffers() final;
+    void drawObject() final;
+    void recordCommands(RenderCommandList& commands) final;
+    bool isTranslucent() const noexcept final;
+    GLuint getSortTextureId() noexcept final;
+    Maths::GeoBounds getCullingBounds() const final;
+
+  public:
+    ParticleSystem(Transform transform, int32_t layer, ShaderProgram shaderProgram, std::shared_ptr<Camera> camera, std::shared_ptr<RenderingService> renderer);
+
+    /**
+     * Adds an emitter to the system. Emitters are drawn in the order they were added.
+     *
+     * @param texture The texture every particle of the emitter draws.
+     * @param settings How the emitter emits its particles.
+     * @returns The new emitter, which lives as long as the system does.
+     */
+    ParticleEmitter& addEmitter(std::shared_ptr<Texture> texture, const ParticleEmitterSettings& settings);
+
+    inline const std::vector<std::unique_ptr<ParticleEmitter>>& getEmitters() const noexcept {
+      return _emitters;
+    }
+
+    /**
+     * Updates every emitter.
+     *
+     * @param delta How much time has passed since the last update.
+     */
+    void update(Timing::Timestamp delta);
+
+    /**
+     * Updates the system every time the runner raises Update, until it is stopped.
+     */
+    void play(NovelRunner* runner);
+
+    void stop();
+
+    /**
+     * Gets how many particles are alive across every emitter.
+     */
+    size_t getParticleCount() const noexcept;
+
+    /**
+     * Gets whether any emitter has particles alive or is still emitting them.
+     */
+    bool isAlive() const noexcept;
+
+    ~ParticleSystem();
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_PARTICLESYSTEM_H
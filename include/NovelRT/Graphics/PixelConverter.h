@@ -0,0 +1,77 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_PIXELCONVERTER_H
+#define NOVELRT_GRAPHICS_PIXELCONVERTER_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Converts tightly packed 8 bit pixels into the RGBA layout textures are uploaded in. Each conversion works on whole
+   * images at a time, using SSSE3, SSE2 or NEON when the build targets them and a scalar loop otherwise. Every path gives
+   * exactly the same result. Nothing here touches OpenGL, so it is safe to use from any thread.
+   */
+  class PixelConverter {
+  public:
+    /**
+     * Expands RGB pixels into RGBA, with every pixel fully opaque.
+     *
+     * @param source The RGB pixels, three bytes each.
+     * @param destination Receives the RGBA pixels, four bytes each. Must not overlap the source, unless the source is
+     * packed into the very end of the same buffer, which lets a decoder expand its pixels in place.
+     * @param pixelCount The number of pixels to convert.
+     */
+    static void rgbToRgba(const uint8_t* source, uint8_t* destination, size_t pixelCount) noexcept;
+
+    /**
+     * Expands greyscale pixels into RGBA, with every pixel fully opaque.
+     *
+     * @param source The greyscale pixels, one byte each.
+     * @param destination Receives the RGBA pixels, four bytes each. Must not overlap the source, unless the source is
+     * packed into the very end of the same buffer, which lets a decoder expand its pixels in place.
+     * @param pixelCount The number of pixels to convert.
+     */
+    static void grayToRgba(const uint8_t* source, uint8_t* destination, size_t pixelCount) noexcept;
+
+    /**
+     * Expands greyscale pixels with alpha into RGBA.
+     *
+     * @param source The greyscale and alpha pixels, two bytes each.
+     * @param destination Receives the RGBA pixels, four bytes each. Must not overlap the source, unless the source is
+     * packed into the very end of the same buffer, which lets a decoder expand its pixels in place.
+     * @param pixelCount The number of pixels to convert.
+     */
+    static void grayAlphaToRgba(const uint8_t* source, uint8_t* destination, size_t pixelCount) noexcept;
+
+    /**
+     * Multiplies the colour of each RGBA pixel by its alpha, in place, rounding to the nearest value.
+     */
+    static void premultiplyAlpha(uint8_t* pixels, size_t pixelCount) noexcept;
+
+    /**
+     * Reorders the channels of each four byte pixel, in place.
+     *
+     * @param pixels The pixels to reorder.
+     * @param pixelCount The number of pixels to reorder.
+     * @param order Which of the old channels ends up in each new channel. { 2, 1, 0, 3 } turns BGRA into RGBA and back again.
+     */
+    static void swizzle(uint8_t* pixels, size_t pixelCount, std::array<uint8_t, 4> order) noexcept;
+
+    /**
+     * Scans the alpha of each RGBA pixel to find out how a texture made from them has to be drawn. The scan stops at the first
+     * partially transparent pixel.
+     *
+     * @returns Opaque when every alpha is 255, Cutout when every alpha is either 0 or 255, and Translucent otherwise.
+     */
+    static TextureAlphaMode classifyAlpha(const uint8_t* pixels, size_t pixelCount) noexcept;
+
+    /**
+     * Gets the instruction set the conversions were compiled for: "SSSE3", "SSE2", "NEON" or "Scalar".
+     */
+    static const char* getInstructionSet() noexcept;
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_PIXELCONVERTER_H
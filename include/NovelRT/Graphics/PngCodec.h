@@ -0,0 +1,48 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_PNGCODEC_H
+#define NOVELRT_GRAPHICS_PNGCODEC_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Reads and writes PNG files. Nothing here touches OpenGL, so it is safe to use from tools and from threads other than the render thread.
+   */
+  class PngCodec {
+  public:
+    /**
+     * Decodes a PNG file, converting whatever it contains into 8 bit RGBA. Rows are read as stored and expanded to RGBA
+     * afterwards by PixelConverter.
+     *
+     * @param file The path of the PNG file.
+     * @returns The decoded image.
+     * @exception Exceptions::FileNotFoundException Thrown when the file cannot be opened.
+     * @exception Exceptions::IOException Thrown when the file is not a valid PNG.
+     */
+    static RgbaImage decodeFile(const std::string& file);
+
+    /**
+     * Decodes a PNG file into an existing image, reusing its pixel memory when it is already large enough.
+     *
+     * @param file The path of the PNG file.
+     * @param image Receives the decoded image.
+     * @exception Exceptions::FileNotFoundException Thrown when the file cannot be opened.
+     * @exception Exceptions::IOException Thrown when the file is not a valid PNG.
+     */
+    static void decodeFile(const std::string& file, RgbaImage& image);
+
+    /**
+     * Encodes an RGBA image into a PNG file, replacing the file if it already exists.
+     *
+     * @param file The path of the PNG file to write.
+     * @param image The image to encode.
+     * @exception Exceptions::IOException Thrown when the file cannot be written.
+     */
+    static void encodeFile(const std::string& file, const RgbaImage& image);
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_PNGCODEC_H
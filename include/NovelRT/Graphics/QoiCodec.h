@@ -0,0 +1,87 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_QOICODEC_H
+#define NOVELRT_GRAPHICS_QOICODEC_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Reads and writes QOI ("Quite OK Image") files, a simple lossless format that decodes several times faster than PNG for
+   * roughly the same size. Decoding is a single pass over the file straight into the destination pixels, with no intermediate
+   * rows. Nothing here touches OpenGL, so it is safe to use from tools and from threads other than the render thread.
+   */
+  class QoiCodec {
+  public:
+    static const size_t HeaderSize = 14;
+
+    /**
+     * Reads the size of the image in an encoded QOI file without decoding any pixels.
+     *
+     * @param data The encoded file.
+     * @param size The size of the encoded file, in bytes.
+     * @param width Receives the width of the image.
+     * @param height Receives the height of the image.
+     * @returns Whether the data starts with a valid QOI header.
+     */
+    static bool tryReadHeader(const uint8_t* data, size_t size, uint32_t& width, uint32_t& height) noexcept;
+
+    /**
+     * Decodes an encoded QOI file into RGBA pixels. Images without alpha decode as fully opaque.
+     *
+     * @param data The encoded file.
+     * @param size The size of the encoded file, in bytes.
+     * @param destination Receives the decoded pixels, tightly packed. Must hold at least width * height * 4 bytes, going by the header.
+     * @returns Whether the data was a valid QOI file. The destination may have been partly written even when it was not.
+     */
+    static bool tryDecode(const uint8_t* data, size_t size, uint8_t* destination) noexcept;
+
+    /**
+     * Decodes a QOI file.
+     *
+     * @param file The path of the QOI file.
+     * @returns The decoded image.
+     * @exception Exceptions::FileNotFoundException Thrown when the file cannot be opened.
+     * @exception Exceptions::IOException Thrown when the file is not a valid QOI file.
+     */
+    static RgbaImage decodeFile(const std::string& file);
+
+    /**
+     * Decodes a QOI file into an existing image, reusing its pixel memory when it is already large enough.
+     *
+     * @param file The path of the QOI file.
+     * @param image Receives the decoded image.
+     * @exception Exceptions::FileNotFoundException Thrown when the file cannot be opened.
+     * @exception Exceptions::IOException Thrown when the file is not a valid QOI file.
+     */
+    static void decodeFile(const std::string& file, RgbaImage& image);
+
+    /**
+     * Encodes an RGBA image as a QOI file.
+     *
+     * @param image The image to encode.
+     * @returns The bytes of the QOI file.
+     * @exception Exceptions::InvalidOperationException Thrown when the image is empty.
+     */
+    static std::vector<uint8_t> encode(const RgbaImage& image);
+
+    /**
+     * Encodes an RGBA image into a QOI file, replacing the file if it already exists.
+     *
+     * @param file The path of the QOI file to write.
+     * @param image The image to encode.
+     * @exception Exceptions::InvalidOperationException Thrown when the image is empty.
+     * @exception Exceptions::IOException Thrown when the file cannot be written.
+     */
+    static void encodeFile(const std::string& file, const RgbaImage& image);
+
+    /**
+     * Gets whether a file should be decoded as QOI rather than as a PNG, going by its extension.
+     */
+    static bool isQoiFile(const std::string& file);
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_QOICODEC_H
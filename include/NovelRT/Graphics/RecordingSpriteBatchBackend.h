@@ -0,0 +1,52 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_RECORDINGSPRITEBATCHBACKEND_H
+#define NOVELRT_GRAPHICS_RECORDINGSPRITEBATCHBACKEND_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * A SpriteBatchBackend that records what would have been drawn instead of talking to the GPU.
+   * This allows the batching behaviour to be inspected in tests and tools that do not have a GL context.
+   */
+  class RecordingSpriteBatchBackend : public SpriteBatchBackend {
+  private:
+    std::vector<SpriteBatchGroup> _recordedGroups;
+    std::vector<SpriteInstanceData> _recordedInstances;
+    uint32_t _submissionCount;
+
+  public:
+    RecordingSpriteBatchBackend() noexcept;
+
+    void submit(const std::vector<SpriteInstanceData>& instances, const std::vector<SpriteBatchGroup>& groups) final;
+
+    /**
+     * Gets every group submitted since the last reset. The instance ranges refer to getRecordedInstances().
+     */
+    inline const std::vector<SpriteBatchGroup>& getRecordedGroups() const noexcept {
+      return _recordedGroups;
+    }
+
+    inline const std::vector<SpriteInstanceData>& getRecordedInstances() const noexcept {
+      return _recordedInstances;
+    }
+
+    /**
+     * Gets the number of draw calls that would have been issued since the last reset. Each group is one instanced draw.
+     */
+    inline uint32_t getDrawCallCount() const noexcept {
+      return static_cast<uint32_t>(_recordedGroups.size());
+    }
+
+    inline uint32_t getSubmissionCount() const noexcept {
+      return _submissionCount;
+    }
+
+    void reset() noexcept;
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_RECORDINGSPRITEBATCHBACKEND_H
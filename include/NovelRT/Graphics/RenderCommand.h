@@ -0,0 +1,26 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_RENDERCOMMAND_H
+#define NOVELRT_GRAPHICS_RENDERCOMMAND_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * A single command in a RenderCommandList. Which of the fields mean anything depends on the type of the command.
+   */
+  struct RenderCommand {
+  public:
+    RenderCommandType type = RenderCommandType::DrawObject;
+    RenderPass pass = RenderPass::Opaque;    // The pass a BeginPass command starts.
+    RenderObject* object = nullptr;          // The object a DrawObject command draws.
+    GLuint shaderProgramId = 0;              // The program a DrawSprites or DrawShapes command draws with.
+    std::shared_ptr<Texture> texture;        // The texture a DrawSprites command samples from.
+    size_t first = 0;                        // The first sprite instance or shape vertex of a run, in the list's own storage.
+    size_t count = 0;                        // The number of sprite instances or shape vertices in a run.
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_RENDERCOMMAND_H
@@ -0,0 +1,78 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_RENDERCOMMANDLIST_H
+#define NOVELRT_GRAPHICS_RENDERCOMMANDLIST_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * A list of draw commands recorded without touching GL, so that it can be filled on any thread and replayed on the GL thread later.
+   * Sprites and shapes are copied into the list itself, and consecutive ones that share a shader program and texture are merged into
+   * a single command as they are added. The storage is kept when the list is cleared, so a list reused every frame stops allocating.
+   */
+  class RenderCommandList {
+  private:
+    std::vector<RenderCommand> _commands;
+    std::vector<SpriteInstanceData> _spriteInstances;
+    std::vector<ShapeVertex> _shapeVertices;
+
+  public:
+    RenderCommandList() noexcept;
+
+    /**
+     * Records the start of a render pass.
+     */
+    void beginPass(RenderPass pass);
+
+    /**
+     * Records a sprite, merging it into the last command if that draws sprites with the same program and texture.
+     *
+     * @returns The instance data of the new sprite, to be filled in by the caller.
+     */
+    SpriteInstanceData& addSprite(GLuint shaderProgramId, const std::shared_ptr<Texture>& texture);
+
+    /**
+     * Records a number of sprites, merging them into the last command if that draws sprites with the same program and texture.
+     *
+     * @returns The first of the new sprites' instance data, to be filled in by the caller.
+     */
+    SpriteInstanceData* addSprites(GLuint shaderProgramId, const std::shared_ptr<Texture>& texture, size_t count);
+
+    /**
+     * Records a number of shape vertices, merging them into the last command if that draws shapes with the same program.
+     *
+     * @returns The first of the new vertices, to be filled in by the caller.
+     */
+    ShapeVertex* addShapeVertices(GLuint shaderProgramId, size_t count);
+
+    /**
+     * Records an object that has to be drawn by calling its drawObject on the GL thread.
+     */
+    void addObject(RenderObject* object);
+
+    void clear() noexcept;
+
+    inline const std::vector<RenderCommand>& getCommands() const noexcept {
+      return _commands;
+    }
+
+    /**
+     * Gets the sprite instances recorded so far. The ranges of the DrawSprites commands refer to these.
+     */
+    inline const std::vector<SpriteInstanceData>& getSpriteInstances() const noexcept {
+      return _spriteInstances;
+    }
+
+    /**
+     * Gets the shape vertices recorded so far. The ranges of the DrawShapes commands refer to these.
+     */
+    inline const std::vector<ShapeVertex>& getShapeVertices() const noexcept {
+      return _shapeVertices;
+    }
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_RENDERCOMMANDLIST_H
@@ -0,0 +1,19 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_RENDERCOMMANDTYPE_H
+#define NOVELRT_GRAPHICS_RENDERCOMMANDTYPE_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  enum class RenderCommandType {
+    BeginPass, // Starts a render pass, which raises the RenderQueue's PassStarted event when it is replayed.
+    DrawSprites, // Draws a run of sprite instances that share a shader program and texture through the SpriteBatch.
+    DrawShapes, // Draws a run of shape vertices that share a shader program through the ShapeBatch.
+    DrawObject // Draws an object that issues its own GL calls, by calling its drawObject on the GL thread.
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_RENDERCOMMANDTYPE_H
@@ -0,0 +1,111 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_RENDERLAYER_H
+#define NOVELRT_GRAPHICS_RENDERLAYER_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * A group of RenderObjects that is drawn into its own framebuffer texture, then composited onto the screen with a single quad.
+   * While the layer is retained, that texture is only redrawn when something in it changes, so a static background or dialogue
+   * frame costs one textured quad a frame rather than every object inside it.
+   *
+   * Objects join a layer through RenderObject::setRenderLayer, and keep calling executeObjectBehaviour every frame as usual.
+   * The layer is redrawn when one of them is dirty, is added, removed, shown or hidden, when the camera or window changes, or
+   * when a texture finishes loading in the background. Anything else that changes how a member looks, such as a custom shader
+   * uniform, needs a call to invalidate().
+   *
+   * The layer covers what the camera can see and is composited at its own layer, so it sorts against other objects as a whole.
+   * Its members keep their own layers, which only order them within the layer. Layers assume an orthographic camera.
+   */
+  class RenderLayer : public RenderObject {
+    friend class RenderingService;
+
+  private:
+    RenderQueue _renderQueue;
+    bool _isRetained;
+    bool _needsRebuild;
+    uint32_t _rebuildCount;
+    std::shared_ptr<Texture> _texture;
+    Utilities::Lazy<GLuint> _framebuffer;
+    Utilities::Lazy<GLuint> _depthBuffer;
+    SpriteInstanceData _instanceData;
+    LoggingService _logger;
+
+    void resizeTarget(uint32_t width, uint32_t height);
+
+    /**
+     * Positions the composite quad over the camera's view and queues it with the renderer, if anything was submitted this frame.
+     */
+    void submitComposite(Maths::GeoBounds visibleBounds);
+
+    /**
+     * Redraws the layer into its texture if it needs it, or throws away this frame's submissions if it does not.
+     *
+     * @param cullingIndex The renderer's SpatialIndex, already culled for this frame.
+     * @param targetSize The size of the window, which the layer's texture matches.
+     * @param mainFramebuffer The framebuffer to bind again afterwards.
+     * @param forceRebuild Whether something outside the layer, such as the camera, has changed.
+     * @returns Whether the layer was redrawn.
+     */
+    bool render(const SpatialIndex* cullingIndex, Maths::GeoVector2F targetSize, GLuint mainFramebuffer, bool forceRebuild);
+
+  protected:
+    void drawObject() final;
+    void recordCommands(RenderCommandList& commands) final;
+    void configureObjectBuffers() final;
+    bool isTranslucent() const noexcept final;
+    GLuint getSortTextureId() noexcept final;
+
+  public:
+    RenderLayer(int32_t layer, ShaderProgram shaderProgram, std::shared_ptr<Camera> camera, std::shared_ptr<RenderingService> renderer);
+
+    /**
+     * Queues a member to be drawn into this layer. Members are routed here by RenderObject::executeObjectBehaviour.
+     */
+    void submit(RenderObject* object, int32_t layer, bool isTranslucent, GLuint shaderProgramId, GLuint textureId);
+
+    /**
+     * Removes a member that is about to be destroyed or moved to another layer.
+     */
+    void cancel(const RenderObject* object) noexcept;
+
+    /**
+     * Forces the layer to be redrawn at the end of this frame.
+     */
+    inline void invalidate() noexcept {
+      _needsRebuild = true;
+    }
+
+    /**
+     * Gets whether the layer keeps its texture between frames. Members of a layer that is not retained are drawn straight to
+     * the screen like any other object, which suits a layer that is about to animate for a while.
+     */
+    inline bool isRetained() const noexcept {
+      return _isRetained;
+    }
+
+    void setRetained(bool value) noexcept;
+
+    /**
+     * Gets the queue that members wait in until the layer is redrawn, or thrown away if it does not need to be.
+     */
+    inline const RenderQueue& getRenderQueue() const noexcept {
+      return _renderQueue;
+    }
+
+    /**
+     * Gets how many times the layer has been redrawn into its texture. A static layer should stop counting once it has been drawn.
+     */
+    inline uint32_t getRebuildCount() const noexcept {
+      return _rebuildCount;
+    }
+
+    ~RenderLayer();
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_RENDERLAYER_H
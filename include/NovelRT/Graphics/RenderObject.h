@@ -9,25 +9,73 @@
 
 namespace NovelRT::Graphics {
   class RenderObject : public WorldObject {
+    friend class RenderQueue;
+    friend class SpatialIndex;
+
+  private:
+    uint32_t _visibleCullId;
+    uint32_t _transformHandle;
+
   protected:
     virtual void drawObject() = 0;
-    virtual void configureObjectBuffers();
-    static GLuint generateStandardBuffer();
-    Maths::GeoMatrix4x4F generateViewData();
-    Maths::GeoMatrix4x4F generateCameraBlock();
+    virtual void configureObjectBuffers() = 0;
+
+    /**
+     * Records what drawObject would draw into a command list, without touching GL. Objects that draw through the sprite or shape
+     * batch copy their instance data or vertices in, and everything else records itself to be drawn with drawObject later on.
+     * This runs on the RenderQueue's worker threads, alongside other objects recording into their own lists, so it must not change
+     * anything outside the command list, not even on this object.
+     */
+    virtual void recordCommands(RenderCommandList& commands);
+
+    /**
+     * Whether this object blends with what is behind it. Translucent objects are drawn after every opaque one, with blending on
+     * and depth writes off.
+     */
+    virtual bool isTranslucent() const noexcept;
+
+    /**
+     * The texture this object samples from, used by the RenderQueue to keep objects that share a texture together.
+     */
+    virtual GLuint getSortTextureId() noexcept;
+
+    /**
+     * Gets the scale this object's model matrix is built with. This is the transform's scale unless the object sizes itself.
+     */
+    virtual Maths::GeoVector2F getModelScale() const;
+
+    /**
+     * Gets this object's model matrix from the renderer's TransformStore. Read it while drawing rather than while configuring buffers,
+     * so that it comes out of the store's batched update at the start of endFrame instead of being rebuilt on its own.
+     */
+    const Maths::GeoMatrix4x4F& getModelMatrix();
+
+    /**
+     * Gets an axis aligned box that contains this object at any rotation. Used to cull the object when it is out of view.
+     */
+    virtual Maths::GeoBounds getCullingBounds() const;
 
-    Utilities::Lazy<GLuint> _vertexBuffer;
-    Utilities::Lazy<GLuint> _vertexArrayObject;
     ShaderProgram _shaderProgram;
-    std::vector<GLfloat> _vertexBufferData;
     bool _bufferInitialised;
     std::shared_ptr<Camera> _camera;
-    Utilities::Lazy<Maths::GeoMatrix4x4F> _finalViewMatrixData;
+    std::shared_ptr<RenderingService> _renderer;
+    std::shared_ptr<RenderLayer> _renderLayer;
 
   public:
-    RenderObject(Transform transform, int32_t layer, ShaderProgram shaderProgram, std::shared_ptr<Camera> camera);
+    RenderObject(Transform transform, int32_t layer, ShaderProgram shaderProgram, std::shared_ptr<Camera> camera, std::shared_ptr<RenderingService> renderer);
 
     void executeObjectBehaviour() final;
+
+    inline const std::shared_ptr<RenderLayer>& getRenderLayer() const noexcept {
+      return _renderLayer;
+    }
+
+    /**
+     * Moves this object into a RenderLayer, which draws it into the layer's texture instead of straight to the screen.
+     * Passing nullptr takes it back out again.
+     */
+    void setRenderLayer(std::shared_ptr<RenderLayer> value);
+
     virtual ~RenderObject();
   };
 }
@@ -0,0 +1,17 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_RENDERPASS_H
+#define NOVELRT_GRAPHICS_RENDERPASS_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  enum class RenderPass {
+    Opaque, // Opaque objects, drawn front to back with blending off so that the depth test rejects whatever they hide.
+    Translucent // Translucent objects, drawn back to front with blending on and without writing depth.
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_RENDERPASS_H
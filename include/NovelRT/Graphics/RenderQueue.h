@@ -0,0 +1,252 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_RENDERQUEUE_H
+#define NOVELRT_GRAPHICS_RENDERQUEUE_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Collects the RenderObjects submitted over the course of a frame and draws them in sort key order when executed.
+   * Each key packs, from the most significant bits down, a translucency flag, the layer, the shader program, the texture
+   * and the submission order. Every opaque object therefore draws before every translucent one. Opaque objects draw front
+   * to back, so that the depth test rejects what they hide, and translucent objects draw back to front, so that they blend
+   * over what is behind them. Objects that share state within a layer end up next to each other.
+   *
+   * Executing happens in two steps. Recording walks the sorted entries and has each object record what it draws into a
+   * RenderCommandList, which touches no GL, so the entries are split into contiguous runs recorded on the worker pool at the
+   * same time. Replaying then walks the lists in order on the GL thread, handing the recorded sprites and shapes to the batches.
+   */
+  class RenderQueue {
+  public:
+    static const uint32_t TranslucencyBits = 1;
+    static const uint32_t LayerBits = 16;
+    static const uint32_t ShaderBits = 11;
+    static const uint32_t TextureBits = 16;
+    static const uint32_t SequenceBits = 20;
+
+    /**
+     * The fewest entries recorded by each worker thread. Below this, waking the threads costs more than it saves.
+     */
+    static const size_t MinimumEntriesPerTask = 256;
+
+    struct Entry {
+      uint64_t key;
+      RenderObject* object;
+    };
+
+  private:
+    struct Submission {
+      const RenderObject* object;
+      uint64_t key;
+      bool isActive;
+
+      inline bool operator==(const Submission& other) const noexcept {
+        return object == other.object && key == other.key && isActive == other.isActive;
+      }
+    };
+
+    struct ChunkStatistics {
+      uint32_t submittedCount;
+      uint32_t culledCount;
+      uint32_t stateChangeCount;
+      float opaqueArea;
+      float translucentArea;
+      const Entry* firstDrawn;
+      const Entry* lastDrawn;
+    };
+
+    SpriteBatch* _spriteBatch;
+    ShapeBatch* _shapeBatch;
+    RenderWorkerPool* _workerPool;
+    std::vector<Entry> _entries;
+    std::vector<Entry> _scratch;
+    std::vector<Submission> _submissions;
+    std::vector<Submission> _lastSubmissions;
+    std::vector<RenderCommandList> _commandLists;
+    std::vector<ChunkStatistics> _chunkStatistics;
+    size_t _recordedListCount;
+    bool _hasSubmissionChanged;
+    bool _isExecuting;
+    uint32_t _submittedCount;
+    uint32_t _culledCount;
+    uint32_t _stateChangeCount;
+    float _opaqueOverdraw;
+    float _translucentOverdraw;
+    Timing::Timestamp _lastSortTime;
+    Timing::Timestamp _lastRecordTime;
+
+    void rememberSubmissions() noexcept;
+    void recordChunk(size_t first, size_t last, const SpatialIndex* cullingIndex, Maths::GeoBounds view, RenderCommandList& commands,
+      ChunkStatistics& statistics);
+
+  public:
+    /**
+     * Raised during execution just before the first object of each pass is drawn, so that the blend and depth write state
+     * can be set up for it. Passes with nothing to draw are not raised.
+     */
+    Utilities::Event<RenderPass> PassStarted;
+
+    /**
+     * @param spriteBatch The batch that recorded sprites are replayed into. Without both batches, every object is drawn through
+     * its drawObject instead.
+     * @param shapeBatch The batch that recorded shapes are replayed into.
+     * @param workerPool The threads to record on. Without one, recording happens on the calling thread.
+     */
+    explicit RenderQueue(SpriteBatch* spriteBatch = nullptr, ShapeBatch* shapeBatch = nullptr, RenderWorkerPool* workerPool = nullptr) noexcept;
+
+    /**
+     * Creates the sort key for an object. Shader and texture ids are truncated to their fields, which can only cost a state
+     * change, never correctness, as the submission order still breaks every tie.
+     */
+    static uint64_t createSortKey(int32_t layer, bool isTranslucent, GLuint shaderProgramId, GLuint textureId, uint32_t sequence) noexcept;
+
+    static inline RenderPass getRenderPass(uint64_t key) noexcept {
+      return (key >> (LayerBits + ShaderBits + TextureBits + SequenceBits)) != 0 ? RenderPass::Translucent : RenderPass::Opaque;
+    }
+
+    static inline GLuint getShaderProgramId(uint64_t key) noexcept {
+      return static_cast<GLuint>((key >> (TextureBits + SequenceBits)) & ((1ULL << ShaderBits) - 1));
+    }
+
+    static inline GLuint getTextureId(uint64_t key) noexcept {
+      return static_cast<GLuint>((key >> SequenceBits) & ((1ULL << TextureBits) - 1));
+    }
+
+    /**
+     * Sorts the given entries by key with a least significant digit radix sort. The sort is stable, and passes over bytes
+     * that are identical across every key are skipped.
+     *
+     * @param entries The entries to sort in place.
+     * @param scratch Storage for the sort to ping-pong through. It is resized as needed so that it can be reused across calls.
+     */
+    static void sortEntries(std::vector<Entry>& entries, std::vector<Entry>& scratch);
+
+    /**
+     * Queues an object to be drawn when the queue is next executed. The object must stay alive until then.
+     * Objects submitted while the queue is executing, such as the letters of a TextRect, are drawn immediately in place of
+     * their parent.
+     */
+    void submit(RenderObject* object, int32_t layer, bool isTranslucent, GLuint shaderProgramId, GLuint textureId);
+
+    /**
+     * Removes an object that is about to be destroyed from the queue, so that it is not drawn when the queue executes.
+     */
+    void cancel(const RenderObject* object) noexcept;
+
+    /**
+     * Sorts everything submitted since the last execution, records it into command lists and empties the queue. Objects read
+     * their model matrices while recording, so the TransformStore has to have been updated first. Every object recorded has to
+     * stay alive until the lists are replayed.
+     *
+     * @param cullingIndex If provided, objects that this index did not find visible in its last cull are skipped, and the
+     * overdraw of the objects that remain is measured against the bounds it culled to.
+     */
+    void record(const SpatialIndex* cullingIndex = nullptr);
+
+    /**
+     * Draws what the last record put into the command lists, in order, then empties them. This is where PassStarted is raised.
+     */
+    void replay();
+
+    /**
+     * Records everything submitted since the last execution, then replays it straight away.
+     *
+     * @param cullingIndex If provided, objects that this index did not find visible in its last cull are skipped, and the
+     * overdraw of the objects that remain is measured against the bounds it culled to.
+     */
+    void execute(const SpatialIndex* cullingIndex = nullptr);
+
+    /**
+     * Empties the queue, along with anything recorded but not yet replayed, without drawing anything.
+     */
+    void clear() noexcept;
+
+    /**
+     * Gets whether everything submitted since the last execution or clear matches what was submitted before it: the same
+     * objects, in the same order, with the same sort keys, shown or hidden as they were, and with none of them cancelled.
+     * Changes inside an object, such as a new position, do not show up here.
+     */
+    inline bool matchesLastSubmissions() const noexcept {
+      return !_hasSubmissionChanged && _submissions.size() == _lastSubmissions.size();
+    }
+
+    inline bool isExecuting() const noexcept {
+      return _isExecuting;
+    }
+
+    inline size_t getPendingCount() const noexcept {
+      return _entries.size();
+    }
+
+    /**
+     * Gets how many command lists the last record filled, which is how many threads it was split across.
+     */
+    inline size_t getRecordedListCount() const noexcept {
+      return _recordedListCount;
+    }
+
+    /**
+     * Gets one of the command lists filled by the last record. Lists are emptied once they have been replayed.
+     */
+    inline const RenderCommandList& getCommandList(size_t index) const noexcept {
+      return _commandLists[index];
+    }
+
+    /**
+     * Gets the number of objects that were drawn by the last execution.
+     */
+    inline uint32_t getSubmittedCount() const noexcept {
+      return _submittedCount;
+    }
+
+    /**
+     * Gets the number of objects that the last execution skipped because they were out of view.
+     */
+    inline uint32_t getCulledCount() const noexcept {
+      return _culledCount;
+    }
+
+    /**
+     * Gets the number of shader program and texture changes between consecutive objects in the last execution.
+     */
+    inline uint32_t getStateChangeCount() const noexcept {
+      return _stateChangeCount;
+    }
+
+    /**
+     * Gets how many times over, on average, the opaque objects drawn by the last execution covered the view. This is worked
+     * out from their culling bounds, so it counts fragments that the depth test went on to reject. It is zero when the last
+     * execution was not given a culling index.
+     */
+    inline float getOpaqueOverdraw() const noexcept {
+      return _opaqueOverdraw;
+    }
+
+    /**
+     * Gets how many times over, on average, the translucent objects drawn by the last execution covered the view. Every one
+     * of these fragments is blended, which makes this the number to watch on fill rate limited hardware.
+     */
+    inline float getTranslucentOverdraw() const noexcept {
+      return _translucentOverdraw;
+    }
+
+    /**
+     * Gets the time the last execution spent sorting.
+     */
+    inline Timing::Timestamp getLastSortTime() const noexcept {
+      return _lastSortTime;
+    }
+
+    /**
+     * Gets the time the last execution spent recording commands, not counting the sort.
+     */
+    inline Timing::Timestamp getLastRecordTime() const noexcept {
+      return _lastRecordTime;
+    }
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_RENDERQUEUE_H
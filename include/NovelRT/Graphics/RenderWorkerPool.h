@@ -0,0 +1,63 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_RENDERWORKERPOOL_H
+#define NOVELRT_GRAPHICS_RENDERWORKERPOOL_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Splits the CPU side of preparing a frame, such as rebuilding model matrices and recording draw commands, across a fixed set of
+   * worker threads. The calling thread works through the tasks alongside the workers and only returns once every task is done.
+   * Nothing here touches OpenGL. The workers are only started the first time there is more than one task to run.
+   */
+  class RenderWorkerPool {
+  private:
+    size_t _workerCount;
+    std::vector<std::thread> _workers;
+    std::mutex _mutex;
+    std::condition_variable _workAvailable;
+    std::condition_variable _workFinished;
+    const std::function<void(size_t)>* _task;
+    size_t _taskCount;
+    std::atomic<size_t> _nextTask;
+    size_t _busyWorkerCount;
+    uint64_t _generation;
+    bool _isStopping;
+
+    void runWorker();
+    void runTasks();
+
+  public:
+    /**
+     * @param workerCount The number of threads to start besides the calling one. With none, every task runs on the calling thread.
+     */
+    explicit RenderWorkerPool(size_t workerCount) noexcept;
+    RenderWorkerPool(const RenderWorkerPool&) = delete;
+    RenderWorkerPool& operator=(const RenderWorkerPool&) = delete;
+
+    /**
+     * Gets a worker count that leaves one core for the calling thread.
+     */
+    static size_t getDefaultWorkerCount() noexcept;
+
+    /**
+     * Runs a task once for every index from zero up to the task count, and waits for all of them to finish. Tasks may run in any
+     * order and at the same time as each other, so each must only write to what belongs to its own index. Tasks must not throw.
+     *
+     * @param taskCount The number of times to run the task.
+     * @param task The task, which is given the index of the run.
+     */
+    void run(size_t taskCount, const std::function<void(size_t)>& task);
+
+    inline size_t getWorkerCount() const noexcept {
+      return _workerCount;
+    }
+
+    ~RenderWorkerPool();
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_RENDERWORKERPOOL_H
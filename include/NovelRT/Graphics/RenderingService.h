@@ -13,28 +13,98 @@ namespace NovelRT::Graphics {
     friend class TextRect;
     friend class Texture;
     friend class FontSet;
+    friend class RenderLayer;
   private:
+    struct FontCacheKey {
+      std::string file;
+      float size;
+      FontRenderMode renderMode;
+
+      inline bool operator==(const FontCacheKey& other) const noexcept {
+        return file == other.file && size == other.size && renderMode == other.renderMode;
+      }
+    };
+
+    struct FontCacheKeyHash {
+      inline size_t operator()(const FontCacheKey& key) const noexcept {
+        return std::hash<std::string>()(key.file) ^ (std::hash<float>()(key.size) * 31) ^ static_cast<size_t>(key.renderMode);
+      }
+    };
+
     bool initialiseRenderPipeline(bool completeLaunch = true, Maths::GeoVector2F* const optionalWindowSize = nullptr);
     LoggingService _logger;
     std::shared_ptr<Windowing::WindowingService> _windowingService;
 
-    ShaderProgram loadShaders(const std::string& vertexFilePath, const std::string& fragmentFilePath);
+    /**
+     * Loads a shader program, from the ShaderProgramCache when it can, and otherwise by compiling and linking the sources.
+     * Each set of defines is a separate variant with its own cache entry.
+     */
+    ShaderProgram loadShaders(const std::string& vertexFilePath, const std::string& fragmentFilePath, const std::vector<std::string>& defines = {});
+    void linkShaders(GLuint programId,
+      const std::string& vertexFileName,
+      const std::string& vertexShaderCode,
+      const std::string& fragmentFileName,
+      const std::string& fragmentShaderCode);
+    std::unique_ptr<ShaderProgramCache> _shaderProgramCache;
     ShaderProgram _basicFillRectProgram;
     ShaderProgram _texturedRectProgram;
+    ShaderProgram _cutoutTexturedRectProgram;
     ShaderProgram _fontProgram;
+    ShaderProgram _distanceFieldFontProgram;
+    ShaderProgram _renderLayerProgram;
 
     Utilities::Lazy<GLuint> _cameraObjectRenderUbo;
     std::shared_ptr<Camera> _camera;
 
-    std::map<Atom, std::weak_ptr<Texture>> _textureCache;
-    std::map<Atom, std::weak_ptr<FontSet>> _fontCache;
+    Utilities::ResourceCache<std::string, Texture> _textureCache;
+    Utilities::ResourceCache<FontCacheKey, FontSet, FontCacheKeyHash> _fontCache;
 
     RGBAConfig _framebufferColour;
 
+    std::shared_ptr<GLStateCache> _glState;
+    std::shared_ptr<GeometryCache> _geometryCache;
+    SpriteBatch _spriteBatch;
+    ShapeBatch _shapeBatch;
+    RenderWorkerPool _workerPool;
+    RenderQueue _renderQueue;
+    SpatialIndex _spatialIndex;
+    TransformStore _transformStore;
+    std::vector<RenderLayer*> _renderLayers;
+    uint32_t _lastFrameRenderLayerRebuildCount;
+    ScreenTransition _screenTransition;
+
+    TextureLoader _textureLoader;
+    std::weak_ptr<Texture> _placeholderTexture;
+
+    std::shared_ptr<FontLibrary> _fontLibrary;
+
+    Utilities::Lazy<GLuint> _offscreenFramebuffer;
+    Utilities::Lazy<GLuint> _offscreenColourBuffer;
+    Utilities::Lazy<GLuint> _offscreenDepthBuffer;
+
+    uint64_t _frameCount;
+    std::map<uint64_t, std::string> _pendingFrameCaptures;
+
+    bool _isFrameInvalidated;
+    bool _isIdleFrameSkippingEnabled;
+    bool _wasLastFrameSkipped;
+    uint64_t _skippedFrameCount;
+
     void bindCameraUboForProgram(GLuint shaderProgramId);
+    void resizeOffscreenFramebuffer(Maths::GeoVector2F windowSize);
+    void uploadCameraUbo();
+    void renderRetainedLayers();
+    void drawQueuedFrame();
+    bool isSceneUnchanged() const noexcept;
+    bool isFrameUnchanged() const noexcept;
+    GLuint getMainFramebuffer();
+    void beginRenderPass(RenderPass pass);
+
+    std::shared_ptr<Texture> getPlaceholderTexture();
 
     void handleTexturePreDestruction(Texture* target);
     void handleFontSetPreDestruction(FontSet* target);
+    void handleRenderLayerPreDestruction(RenderLayer* target);
 
   public:
     RenderingService(std::shared_ptr<Windowing::WindowingService> windowingService) noexcept;
@@ -47,17 +117,289 @@ namespace NovelRT::Graphics {
 
     std::unique_ptr<BasicFillRect> createBasicFillRect(Transform transform, int32_t layer, RGBAConfig colourConfig);
 
-    std::unique_ptr<TextRect> createTextRect(Transform transform, int32_t layer, RGBAConfig colourConfig, float fontSize, const std::string& fontFilePath);
+    /**
+     * Creates an empty Canvas2D, which draws rectangles, rounded rectangles, circles, lines and polylines without an object for
+     * each shape.
+     *
+     * @param layer The layer every shape on the canvas is drawn at.
+     */
+    std::unique_ptr<Canvas2D> createCanvas(int32_t layer);
+
+    /**
+     * Creates an empty ParticleSystem. Emitters are added to it with ParticleSystem::addEmitter.
+     *
+     * @param transform Where the system is. Only the position is used, as the point its emitters are offset from.
+     * @param layer The layer every particle of the system is drawn at.
+     */
+    std::unique_ptr<ParticleSystem> createParticleSystem(Transform transform, int32_t layer);
+
+    /**
+     * Creates a TextRect. Distance field text shares one FontSet across every size of the same font, and supports outlines and
+     * drop shadows; bitmap text gets a FontSet rasterised for exactly this size.
+     */
+    std::unique_ptr<TextRect> createTextRect(Transform transform, int32_t layer, RGBAConfig colourConfig, float fontSize, const std::string& fontFilePath,
+      FontRenderMode renderMode = FontRenderMode::Bitmap);
+
+    /**
+     * Creates a retained RenderLayer. Objects are moved into it with RenderObject::setRenderLayer.
+     *
+     * @param layer The layer the whole RenderLayer is composited at.
+     */
+    std::shared_ptr<RenderLayer> createRenderLayer(int32_t layer);
 
     std::shared_ptr<Camera> getCamera() const;
 
-    void beginFrame() const;
-    void endFrame() const;
+    /**
+     * Refreshes the shared camera UBO if the camera changed since it was last uploaded.
+     * Objects only carry their own model transform, so moving the camera never touches per-object state.
+     * Textures that finished loading in the background are uploaded here, within the TextureLoader's budgets.
+     */
+    void beginFrame();
+
+    /**
+     * Clears the framebuffer and draws everything queued for the frame, writes out a frame capture if one was requested for this
+     * frame, then presents it. RenderLayers that need it are redrawn into their textures first.
+     *
+     * If idle frame skipping is enabled and nothing has changed since the last frame was drawn, the frame is skipped instead:
+     * nothing is drawn or presented, and the last frame stays on screen. Something has changed when an object was dirty, was
+     * added, removed, shown, hidden or re-sorted, when the camera, window or background colour changed, when a texture finished
+     * loading in the background, when the screen transition moved on, or when the frame is due to be captured.
+     *
+     * While a screen transition is running, the queued frame is only drawn when the transition needs to capture it, and the
+     * transition pass is drawn over the whole screen instead.
+     */
+    void endFrame();
+
+    /**
+     * Makes sure the current frame is drawn even if nothing the renderer tracks has changed. Call this after changing how
+     * something looks in a way the renderer cannot see, such as a custom shader uniform.
+     */
+    inline void invalidateFrame() noexcept {
+      _isFrameInvalidated = true;
+    }
+
+    inline bool isIdleFrameSkippingEnabled() const noexcept {
+      return _isIdleFrameSkippingEnabled;
+    }
+
+    /**
+     * Sets whether endFrame may skip frames that would come out the same as the last one. This is on by default.
+     */
+    inline void setIdleFrameSkippingEnabled(bool value) noexcept {
+      _isIdleFrameSkippingEnabled = value;
+      invalidateFrame();
+    }
+
+    /**
+     * Gets whether the last call to endFrame skipped its frame because nothing had changed.
+     */
+    inline bool wasLastFrameSkipped() const noexcept {
+      return _wasLastFrameSkipped;
+    }
+
+    /**
+     * Gets how many frames endFrame has skipped so far because nothing had changed. Skipped frames still count towards getFrameCount.
+     */
+    inline uint64_t getSkippedFrameCount() const noexcept {
+      return _skippedFrameCount;
+    }
+
+    /**
+     * Gets how many frames have been ended so far. This is also the number of the frame currently being drawn.
+     */
+    inline uint64_t getFrameCount() const noexcept {
+      return _frameCount;
+    }
+
+    /**
+     * Reads back what has been drawn into the framebuffer so far this frame.
+     *
+     * @returns The framebuffer contents, top row first.
+     */
+    RgbaImage readFramebuffer();
+
+    /**
+     * Requests that a frame is saved as a PNG once it has been drawn, just before it is presented. Frames are numbered from zero,
+     * so the first frame drawn is frame 0. Reading the framebuffer back stalls the GPU, so only the frame that was asked for pays for it.
+     *
+     * @param frameNumber The frame to capture. This may be the frame currently being drawn.
+     * @param file The PNG file to write.
+     * @exception Exceptions::InvalidOperationException Thrown when the frame has already been presented.
+     */
+    void captureFrame(uint64_t frameNumber, const std::string& file);
 
     void setBackgroundColour(RGBAConfig colour);
 
+    /**
+     * Gets a texture for a PNG file, a QOI file (.qoi) or a texture container (.nrtex), loading it if it is not cached already.
+     * Calling this without a file creates an empty texture that is never cached.
+     */
     std::shared_ptr<Texture> getTexture(const std::string& fileTarget = "");
-    std::shared_ptr<FontSet> getFontSet(const std::string& fileTarget, float fontSize);
+
+    /**
+     * Gets a texture for a PNG file without waiting for it to load. The file is decoded in the background and uploaded
+     * during a later beginFrame. Until then, the texture draws as a transparent placeholder. Texture containers (.nrtex)
+     * need no decoding, so they are loaded straight away.
+     *
+     * @param fileTarget The PNG file to load.
+     * @returns The texture, which may still be loading. Textures that are already cached are returned as they are.
+     */
+    std::shared_ptr<Texture> getTextureAsync(const std::string& fileTarget);
+    std::shared_ptr<FontSet> getFontSet(const std::string& fileTarget, float fontSize, FontRenderMode renderMode = FontRenderMode::Bitmap);
+
+    /**
+     * Packs a set of PNG files into a new SpriteAtlas. Each image's region is named by the path it was loaded from.
+     *
+     * @param imageFiles The PNG files to pack.
+     * @param pageSize The width and height of each atlas page, in pixels.
+     * @param padding The transparent gutter left around each image, in pixels.
+     * @param shouldTrim Whether fully transparent borders are trimmed from each image before packing.
+     * @returns The packed atlas, with its pages already uploaded.
+     */
+    std::shared_ptr<SpriteAtlas> createSpriteAtlas(const std::vector<std::string>& imageFiles,
+      uint32_t pageSize = SpriteAtlasBuilder::DefaultPageSize,
+      uint32_t padding = SpriteAtlasBuilder::DefaultPadding,
+      bool shouldTrim = true);
+
+    /**
+     * Loads a SpriteAtlas that was packed ahead of time by the AtlasBuilder tool.
+     *
+     * @param manifestFile The .atlas manifest file. Its pages are loaded from the same directory.
+     * @returns The loaded atlas.
+     * @exception Exceptions::FileNotFoundException Thrown when the manifest cannot be opened.
+     * @exception Exceptions::IOException Thrown when the manifest is malformed.
+     */
+    std::shared_ptr<SpriteAtlas> loadSpriteAtlas(const std::string& manifestFile);
+
+    /**
+     * Gets the loader that uploads textures requested through getTextureAsync. Its budgets and metrics are exposed here.
+     */
+    inline TextureLoader& getTextureLoader() noexcept {
+      return _textureLoader;
+    }
+
+    inline const TextureLoader& getTextureLoader() const noexcept {
+      return _textureLoader;
+    }
+
+    /**
+     * Gets how many texture requests were served from the texture cache.
+     */
+    inline uint64_t getTextureCacheHitCount() const noexcept {
+      return _textureCache.getHitCount();
+    }
+
+    /**
+     * Gets how many texture requests had to create a new texture because nothing live was cached for the file.
+     */
+    inline uint64_t getTextureCacheMissCount() const noexcept {
+      return _textureCache.getMissCount();
+    }
+
+    inline uint64_t getFontCacheHitCount() const noexcept {
+      return _fontCache.getHitCount();
+    }
+
+    inline uint64_t getFontCacheMissCount() const noexcept {
+      return _fontCache.getMissCount();
+    }
+
+    /**
+     * Gets the FreeType library that FontSets rasterise their glyphs with. It is created the first time a font is loaded.
+     *
+     * @exception Exceptions::InitialisationFailureException Thrown when FreeType cannot be initialised.
+     */
+    const std::shared_ptr<FontLibrary>& getFontLibrary();
+
+    /**
+     * Gets the tracker that every program, vertex array, texture and buffer binding goes through, so that redundant ones are skipped.
+     */
+    inline GLStateCache& getGLStateCache() noexcept {
+      return *_glState;
+    }
+
+    /**
+     * Gets the cache holding the unit quad that every RenderObject is drawn with.
+     */
+    inline const std::shared_ptr<GeometryCache>& getGeometryCache() const noexcept {
+      return _geometryCache;
+    }
+
+    /**
+     * Gets the store holding every RenderObject's transform. Dirty model matrices are rebuilt in one batch at the start of endFrame.
+     */
+    inline TransformStore& getTransformStore() noexcept {
+      return _transformStore;
+    }
+
+    /**
+     * Gets the RenderQueue that RenderObjects are submitted to. The queue is sorted and drawn at the end of every frame.
+     */
+    inline RenderQueue& getRenderQueue() noexcept {
+      return _renderQueue;
+    }
+
+    inline const RenderQueue& getRenderQueue() const noexcept {
+      return _renderQueue;
+    }
+
+    /**
+     * Gets the threads that model matrices are rebuilt and draw commands are recorded on at the end of every frame.
+     */
+    inline RenderWorkerPool& getWorkerPool() noexcept {
+      return _workerPool;
+    }
+
+    /**
+     * Gets the index used to cull RenderObjects that are outside the camera's view before they are drawn.
+     */
+    inline SpatialIndex& getSpatialIndex() noexcept {
+      return _spatialIndex;
+    }
+
+    inline const SpatialIndex& getSpatialIndex() const noexcept {
+      return _spatialIndex;
+    }
+
+    /**
+     * Gets how many RenderLayers were redrawn into their textures during the last frame. This stays at zero while every layer is static.
+     */
+    inline uint32_t getLastFrameRenderLayerRebuildCount() const noexcept {
+      return _lastFrameRenderLayerRebuildCount;
+    }
+
+    /**
+     * Gets the transition that endFrame draws between the outgoing and incoming frames while it is running.
+     */
+    inline ScreenTransition& getScreenTransition() noexcept {
+      return _screenTransition;
+    }
+
+    inline const ScreenTransition& getScreenTransition() const noexcept {
+      return _screenTransition;
+    }
+
+    /**
+     * Gets the SpriteBatch that ImageRects are submitted to. The batch is flushed at the end of every frame.
+     */
+    inline SpriteBatch& getSpriteBatch() noexcept {
+      return _spriteBatch;
+    }
+
+    inline const SpriteBatch& getSpriteBatch() const noexcept {
+      return _spriteBatch;
+    }
+
+    /**
+     * Gets the ShapeBatch that BasicFillRects and Canvas2Ds are submitted to. The batch is flushed at the end of every frame.
+     */
+    inline ShapeBatch& getShapeBatch() noexcept {
+      return _shapeBatch;
+    }
+
+    inline const ShapeBatch& getShapeBatch() const noexcept {
+      return _shapeBatch;
+    }
   };
 }
 
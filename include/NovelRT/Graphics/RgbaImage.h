@@ -0,0 +1,38 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_RGBAIMAGE_H
+#define NOVELRT_GRAPHICS_RGBAIMAGE_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * A decoded image held in CPU memory as tightly packed 8 bit RGBA rows, top row first.
+   */
+  struct RgbaImage {
+    static const uint32_t BytesPerPixel = 4;
+
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::vector<uint8_t> pixels;
+
+    RgbaImage() = default;
+
+    RgbaImage(uint32_t imageWidth, uint32_t imageHeight) :
+      width(imageWidth),
+      height(imageHeight),
+      pixels(static_cast<size_t>(imageWidth) * imageHeight * BytesPerPixel, 0) {}
+
+    inline uint8_t* getPixel(uint32_t x, uint32_t y) noexcept {
+      return pixels.data() + ((static_cast<size_t>(y) * width) + x) * BytesPerPixel;
+    }
+
+    inline const uint8_t* getPixel(uint32_t x, uint32_t y) const noexcept {
+      return pixels.data() + ((static_cast<size_t>(y) * width) + x) * BytesPerPixel;
+    }
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_RGBAIMAGE_H
@@ -0,0 +1,199 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SCREENTRANSITION_H
+#define NOVELRT_GRAPHICS_SCREENTRANSITION_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Moves between two scenes with a single full-screen pass. The renderer draws the outgoing and incoming frames into textures
+   * once each, then draws nothing but the transition pass, blending the two by the transition's progress, until it finishes. The
+   * scenes go on submitting their objects as usual, but the incoming frame is only drawn again when something in it changes, so
+   * a transition costs about the same however much is on screen.
+   *
+   * The frame being built when start is called becomes the outgoing frame, so the outgoing scene has to stay up until that frame
+   * has been drawn. OutgoingFrameCaptured is raised once it has, which is the time to take it down and put the incoming scene up.
+   *
+   * NovelRunner advances the renderer's transition every Update. Without a runner, call update or setProgress instead.
+   */
+  class ScreenTransition {
+    friend class RenderingService;
+
+  public:
+    /**
+     * The furthest the Blur effect can blur, as the mip level it samples at its peak.
+     */
+    static const uint32_t MaxBlurLevelLimit = 6;
+
+  private:
+    struct ProgramLocations {
+      GLint progress;
+      GLint fadeColour;
+      GLint softness;
+      GLint maxBlurLevel;
+    };
+
+    std::shared_ptr<GLStateCache> _glState;
+    std::array<ShaderProgram, 4> _programs;
+    std::array<ProgramLocations, 4> _programLocations;
+    ScreenTransitionEffect _effect;
+    ScreenTransitionState _state;
+    Timing::Timestamp _duration;
+    Timing::Timestamp _elapsed;
+    float _progress;
+    RGBAConfig _fadeColour;
+    std::shared_ptr<Texture> _mask;
+    float _softness;
+    float _maxBlurLevel;
+    bool _hasChanged;
+    bool _wasOutgoingFrameCaptured;
+    uint32_t _captureCount;
+    GLuint _outgoingFramebuffer;
+    GLuint _outgoingTexture;
+    Maths::GeoVector2F _outgoingSize;
+    GLuint _incomingFramebuffer;
+    GLuint _incomingTexture;
+    Maths::GeoVector2F _incomingSize;
+    GLuint _depthBuffer;
+    Maths::GeoVector2F _depthBufferSize;
+    GLuint _vertexArray;
+    LoggingService _logger;
+
+    /**
+     * Takes the transition's programs once the renderer has loaded them, in the same order as ScreenTransitionEffect.
+     */
+    void setPrograms(const std::array<ShaderProgram, 4>& programs);
+
+    void resizeTarget(GLuint& framebuffer, GLuint& texture, Maths::GeoVector2F& currentSize, Maths::GeoVector2F targetSize);
+    void capture(const std::function<void()>& drawFrame, GLuint framebuffer, GLuint texture, GLuint mainFramebuffer);
+    void drawComposite(GLuint mainFramebuffer);
+
+    /**
+     * Captures whatever the current state calls for and draws the transition pass over the whole of the main framebuffer.
+     *
+     * @param drawFrame Clears the bound framebuffer and draws everything queued for the frame.
+     * @param hasFrameChanged Whether the frame being built differs from the last one, which means the incoming frame is stale.
+     * @param targetSize The size of the window, which the captured frames match.
+     * @param mainFramebuffer The framebuffer to draw the transition pass into.
+     * @returns Whether drawFrame was called.
+     */
+    bool render(const std::function<void()>& drawFrame, bool hasFrameChanged, Maths::GeoVector2F targetSize, GLuint mainFramebuffer);
+
+  public:
+    /**
+     * Raised at the end of the frame that was captured as the outgoing frame.
+     */
+    Utilities::Event<> OutgoingFrameCaptured;
+
+    /**
+     * Raised when the transition finishes, whether it ran its course or finish was called.
+     */
+    Utilities::Event<> Finished;
+
+    explicit ScreenTransition(std::shared_ptr<GLStateCache> glState) noexcept;
+
+    /**
+     * Starts a transition, capturing the frame currently being built as the outgoing frame. Starting a transition while another
+     * one is running restarts it from whatever is on screen in this frame.
+     *
+     * @param effect How the outgoing frame turns into the incoming one.
+     * @param duration How long the transition takes.
+     * @exception Exceptions::InvalidOperationException Thrown when the effect is MaskWipe and there is no mask.
+     */
+    void start(ScreenTransitionEffect effect, Timing::Timestamp duration);
+
+    /**
+     * Moves the transition on, and finishes it once its duration has passed.
+     *
+     * @param delta How much time has passed since the last update.
+     */
+    void update(Timing::Timestamp delta);
+
+    /**
+     * Finishes the transition straight away. The next frame is drawn straight to the screen.
+     */
+    void finish();
+
+    inline ScreenTransitionEffect getEffect() const noexcept {
+      return _effect;
+    }
+
+    inline ScreenTransitionState getState() const noexcept {
+      return _state;
+    }
+
+    inline bool isActive() const noexcept {
+      return _state != ScreenTransitionState::Idle;
+    }
+
+    inline Timing::Timestamp getDuration() const noexcept {
+      return _duration;
+    }
+
+    /**
+     * Gets how far through the transition is, from 0 (only the outgoing frame) to 1 (only the incoming frame).
+     */
+    inline float getProgress() const noexcept {
+      return _progress;
+    }
+
+    /**
+     * Sets how far through the transition is, for transitions that are driven by hand rather than by time. This does not finish
+     * the transition, even at 1.
+     */
+    void setProgress(float value) noexcept;
+
+    inline RGBAConfig getFadeColour() const noexcept {
+      return _fadeColour;
+    }
+
+    /**
+     * Sets the colour the Fade effect passes through. This is black by default.
+     */
+    void setFadeColour(RGBAConfig value) noexcept;
+
+    inline const std::shared_ptr<Texture>& getMask() const noexcept {
+      return _mask;
+    }
+
+    /**
+     * Sets the greyscale image that the MaskWipe effect follows. It is stretched over the whole screen.
+     */
+    void setMask(std::shared_ptr<Texture> value) noexcept;
+
+    inline float getSoftness() const noexcept {
+      return _softness;
+    }
+
+    /**
+     * Sets how far apart in luminance the first and last pixels to blend at any moment of a MaskWipe are. Low values give a hard
+     * edge and high ones a dissolve. This is 0.1 by default.
+     */
+    void setSoftness(float value) noexcept;
+
+    inline float getMaxBlurLevel() const noexcept {
+      return _maxBlurLevel;
+    }
+
+    /**
+     * Sets how far the Blur effect blurs at its peak, as a mip level up to MaxBlurLevelLimit. Each level doubles the blur. This
+     * is 5 by default.
+     */
+    void setMaxBlurLevel(float value) noexcept;
+
+    /**
+     * Gets how many times a frame has been drawn into one of the transition's textures. A transition into a static scene captures
+     * two frames, however long it runs for.
+     */
+    inline uint32_t getCaptureCount() const noexcept {
+      return _captureCount;
+    }
+
+    ~ScreenTransition();
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SCREENTRANSITION_H
@@ -0,0 +1,19 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SCREENTRANSITIONEFFECT_H
+#define NOVELRT_GRAPHICS_SCREENTRANSITIONEFFECT_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  enum class ScreenTransitionEffect : uint32_t {
+    Fade, // The outgoing frame fades to the fade colour over the first half, then the incoming frame fades in from it.
+    Crossfade, // The outgoing frame fades straight into the incoming one.
+    MaskWipe, // Each pixel switches over once progress passes the luminance of the mask at that point, darkest first.
+    Blur // The frames blur out towards the middle of the transition and back in again, crossfading as they go.
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SCREENTRANSITIONEFFECT_H
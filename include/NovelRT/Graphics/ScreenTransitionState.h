@@ -0,0 +1,19 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SCREENTRANSITIONSTATE_H
+#define NOVELRT_GRAPHICS_SCREENTRANSITIONSTATE_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  enum class ScreenTransitionState : uint32_t {
+    Idle, // No transition is running, and frames are drawn straight to the screen.
+    CapturingOutgoing, // The frame being built is drawn into the outgoing texture at the end of this frame.
+    CapturingIncoming, // The frame being built is drawn into the incoming texture at the end of this frame.
+    Running // Both frames are captured, and only the transition pass is drawn until the incoming scene changes.
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SCREENTRANSITIONSTATE_H
@@ -11,7 +11,8 @@ namespace NovelRT::Graphics {
   struct ShaderProgram {
   public:
     GLuint shaderProgramId = 0;
-    GLuint finalViewMatrixBufferUboId = 0;
+    GLuint cameraMatrixBufferUboId = 0;
+    GLint modelTransformUniformLocation = -1;
     std::vector<GLuint> uboIds;
 
     ShaderProgram() {}
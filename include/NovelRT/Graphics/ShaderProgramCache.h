@@ -0,0 +1,85 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SHADERPROGRAMCACHE_H
+#define NOVELRT_GRAPHICS_SHADERPROGRAMCACHE_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Keeps linked shader programs on disk as driver binaries, so that later launches can skip compiling and linking them.
+   * Binaries are keyed on the program's source, its defines and the GL renderer and version, so a driver update or a shader
+   * edit simply misses the cache. Drivers are free to reject a binary at any time, so callers must always be ready to build
+   * the program from source instead.
+   */
+  class ShaderProgramCache {
+  private:
+    std::filesystem::path _cacheDirectory;
+    std::string _deviceIdentity;
+    bool _isSupported;
+    uint64_t _hitCount;
+    uint64_t _missCount;
+    LoggingService _logger;
+
+    std::filesystem::path getBinaryPath(uint64_t key) const;
+
+  public:
+    /**
+     * Creates a cache. Must be called on the render thread once GL is up, since it asks the driver whether it supports
+     * program binaries at all.
+     *
+     * @param cacheDirectory The directory binaries are kept in. It is created when the first binary is stored.
+     * @param renderer The GL_RENDERER string of the current context.
+     * @param version The GL_VERSION string of the current context.
+     */
+    ShaderProgramCache(std::filesystem::path cacheDirectory, const std::string& renderer, const std::string& version);
+
+    /**
+     * Gets the key a program is cached under. Defines should already have been applied to the sources with applyDefines, which
+     * is what gives every variant of a shader its own entry.
+     */
+    uint64_t getKey(const std::string& vertexSource, const std::string& fragmentSource) const;
+
+    /**
+     * Loads a cached binary into a program object that has had nothing attached to it.
+     *
+     * @returns Whether the binary was found and accepted. When it was not, the program is left unlinked and should be built
+     * from source.
+     */
+    bool tryLoad(uint64_t key, GLuint programId);
+
+    /**
+     * Writes a program's binary to the cache. The program should have been linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set.
+     * Failing to write is logged, but is not an error; the program will just be built from source again next time.
+     */
+    void store(uint64_t key, GLuint programId);
+
+    inline bool isSupported() const noexcept {
+      return _isSupported;
+    }
+
+    inline uint64_t getHitCount() const noexcept {
+      return _hitCount;
+    }
+
+    inline uint64_t getMissCount() const noexcept {
+      return _missCount;
+    }
+
+    /**
+     * Hashes some bytes with 64 bit FNV-1a. Unlike std::hash the result never changes between runs or platforms, which is what
+     * makes it usable as an on-disk key.
+     */
+    static uint64_t hash(const std::string& value, uint64_t seed = 14695981039346656037ull) noexcept;
+
+    /**
+     * Inserts a #define line for each define straight after the source's #version directive, which has to stay first.
+     * Sources without a #version directive get the defines at the very start.
+     */
+    static std::string applyDefines(const std::string& source, const std::vector<std::string>& defines);
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SHADERPROGRAMCACHE_H
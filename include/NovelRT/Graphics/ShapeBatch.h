@@ -0,0 +1,114 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SHAPEBATCH_H
+#define NOVELRT_GRAPHICS_SHAPEBATCH_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Collects the triangles of untextured shapes in one vertex stream, so that BasicFillRects and Canvas2Ds drawn one after another
+   * share a single buffer upload when the batch is flushed. Shapes are drawn in the order they were submitted, with one draw call for
+   * each run of shapes that use the same shader program.
+   */
+  class ShapeBatch {
+  private:
+    struct Run {
+      GLuint shaderProgramId;
+      size_t firstVertex;
+      size_t vertexCount;
+    };
+
+    std::shared_ptr<GLStateCache> _glState;
+    Utilities::Lazy<GLuint> _vertexArrayObject;
+    Utilities::Lazy<GLuint> _vertexBuffer;
+    size_t _vertexBufferCapacity;
+    std::vector<ShapeVertex> _vertices;
+    std::vector<Run> _runs;
+    uint32_t _vertexCount;
+    uint32_t _drawCallCount;
+
+    ShapeVertex* beginShape(GLuint shaderProgramId, size_t vertexCount);
+    void configureVertexArray();
+
+  public:
+    explicit ShapeBatch(std::shared_ptr<GLStateCache> glState) noexcept;
+
+    /**
+     * Queues a list of triangles for drawing.
+     *
+     * @param shaderProgramId The program the triangles should be drawn with.
+     * @param vertices The triangles, three vertices each.
+     * @param depth The z every vertex is drawn at, which replaces the z in the vertices.
+     */
+    void submit(GLuint shaderProgramId, const std::vector<ShapeVertex>& vertices, float depth);
+
+    /**
+     * Queues a range of triangles for drawing as they are, such as those recorded into a RenderCommandList.
+     *
+     * @param shaderProgramId The program the triangles should be drawn with.
+     * @param vertices The first vertex of the triangles, three vertices each.
+     * @param vertexCount How many vertices there are.
+     */
+    void submit(GLuint shaderProgramId, const ShapeVertex* vertices, size_t vertexCount);
+
+    /**
+     * Queues a unit quad, centred on the origin, for drawing as two triangles.
+     *
+     * @param shaderProgramId The program the quad should be drawn with.
+     * @param modelMatrix The transform the quad's corners are moved into world space with.
+     * @param colour The colour of every corner.
+     */
+    void submitQuad(GLuint shaderProgramId, const Maths::GeoMatrix4x4F& modelMatrix, std::array<uint8_t, 4> colour);
+
+    /**
+     * Writes the six vertices of a transformed unit quad, as submitQuad queues them.
+     *
+     * @param target Where to write the vertices. There must be room for six.
+     * @param modelMatrix The transform the quad's corners are moved into world space with.
+     * @param colour The colour of every corner.
+     */
+    static void writeQuad(ShapeVertex* target, const Maths::GeoMatrix4x4F& modelMatrix, std::array<uint8_t, 4> colour) noexcept;
+
+    /**
+     * Uploads every queued vertex in one go and draws them, then empties the batch. Flushing an empty batch does nothing.
+     */
+    void flush();
+
+    inline const std::vector<ShapeVertex>& getPendingVertices() const noexcept {
+      return _vertices;
+    }
+
+    /**
+     * Gets how many draw calls the queued vertices would be flushed with.
+     */
+    inline size_t getPendingRunCount() const noexcept {
+      return _runs.size();
+    }
+
+    /**
+     * Gets the number of vertices flushed since the last call to resetStatistics().
+     */
+    inline uint32_t getVertexCount() const noexcept {
+      return _vertexCount;
+    }
+
+    /**
+     * Gets the number of draw calls issued since the last call to resetStatistics().
+     */
+    inline uint32_t getDrawCallCount() const noexcept {
+      return _drawCallCount;
+    }
+
+    inline void resetStatistics() noexcept {
+      _vertexCount = 0;
+      _drawCallCount = 0;
+    }
+
+    ~ShapeBatch();
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SHAPEBATCH_H
@@ -0,0 +1,27 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SHAPEVERTEX_H
+#define NOVELRT_GRAPHICS_SHAPEVERTEX_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * A single vertex of an untextured shape, as streamed to the GPU by the ShapeBatch.
+   * The layout of this struct is mirrored by the vertex attributes of the basic vertex shader, so it must stay tightly packed.
+   */
+  struct ShapeVertex {
+  public:
+    Maths::GeoVector3F position;   // The position in world space. z is the layer, so that shapes are depth tested like any other object.
+    std::array<uint8_t, 4> colour; // The colour as RGBA bytes, which are normalised on the GPU.
+
+    static inline std::array<uint8_t, 4> packColour(RGBAConfig colour) noexcept {
+      auto toByte = [](int32_t value) { return static_cast<uint8_t>(std::clamp(value, 0, 255)); };
+      return { toByte(colour.getR()), toByte(colour.getG()), toByte(colour.getB()), toByte(colour.getA()) };
+    }
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SHAPEVERTEX_H
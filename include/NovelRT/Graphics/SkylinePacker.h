@@ -0,0 +1,53 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SKYLINEPACKER_H
+#define NOVELRT_GRAPHICS_SKYLINEPACKER_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Packs rectangles into a fixed size page by tracking the skyline formed by the tops of everything placed so far.
+   * Each rectangle goes wherever it ends up lowest, which suits glyphs well as they arrive one at a time and are of similar heights.
+   */
+  class SkylinePacker {
+  private:
+    struct Segment {
+      uint32_t x;
+      uint32_t y;
+      uint32_t width;
+    };
+
+    uint32_t _width;
+    uint32_t _height;
+    std::vector<Segment> _skyline;
+
+    bool tryFit(size_t segmentIndex, uint32_t width, uint32_t height, uint32_t& y) const noexcept;
+
+  public:
+    SkylinePacker(uint32_t width, uint32_t height) noexcept;
+
+    /**
+     * Reserves space for a rectangle of the given size.
+     *
+     * @param width The width of the rectangle.
+     * @param height The height of the rectangle.
+     * @param x Receives the left edge of the reserved space.
+     * @param y Receives the top edge of the reserved space.
+     * @returns Whether there was enough space left. Nothing is reserved when this returns false.
+     */
+    bool tryPack(uint32_t width, uint32_t height, uint32_t& x, uint32_t& y);
+
+    inline uint32_t getWidth() const noexcept {
+      return _width;
+    }
+
+    inline uint32_t getHeight() const noexcept {
+      return _height;
+    }
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SKYLINEPACKER_H
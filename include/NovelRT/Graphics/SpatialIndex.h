@@ -0,0 +1,96 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SPATIALINDEX_H
+#define NOVELRT_GRAPHICS_SPATIALINDEX_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Tracks where every RenderObject is so that the ones outside the camera's view can be rejected without visiting the rest.
+   * Objects are stored in a Maths::QuadTree by the centre of their AABB. Objects that are larger than MaxIndexedExtent, or that
+   * sit outside the bounds of the tree, are kept in a separate list that is tested directly instead.
+   */
+  class SpatialIndex {
+  public:
+    static constexpr float MaxIndexedExtent = 512.0f;
+
+  private:
+    class IndexedObject : public Maths::QuadTreePoint {
+    public:
+      RenderObject* object;
+      Maths::GeoBounds bounds;
+      bool isInTree;
+
+      IndexedObject(RenderObject* object, Maths::GeoBounds bounds) :
+        Maths::QuadTreePoint(bounds.position),
+        object(object),
+        bounds(bounds),
+        isInTree(false) {
+      }
+    };
+
+    std::shared_ptr<Maths::QuadTree> _tree;
+    std::unordered_map<const RenderObject*, std::shared_ptr<IndexedObject>> _objects;
+    std::vector<std::shared_ptr<IndexedObject>> _unindexedObjects;
+    std::vector<std::shared_ptr<Maths::QuadTreePoint>> _queryResults;
+    uint32_t _cullId;
+    size_t _lastVisibleCount;
+    Maths::GeoBounds _lastCullBounds;
+
+    void detach(const std::shared_ptr<IndexedObject>& entry);
+
+  public:
+    /**
+     * Creates an index whose quad tree covers the given world space bounds. The default covers the 1920x1080 virtual canvas
+     * plus a full canvas of margin on every side, which is where slide-in transitions park their sprites.
+     */
+    explicit SpatialIndex(Maths::GeoBounds worldBounds = Maths::GeoBounds(Maths::GeoVector2F(960.0f, 540.0f), Maths::GeoVector2F(5760.0f, 3240.0f), 0.0f)) noexcept;
+
+    /**
+     * Inserts an object, or moves it if it is already present.
+     */
+    void update(RenderObject* object, Maths::GeoBounds bounds);
+
+    void remove(const RenderObject* object);
+
+    /**
+     * Marks every object whose bounds intersect the given bounds as visible, and every other object as culled, until the
+     * next call.
+     */
+    void cull(Maths::GeoBounds visibleBounds);
+
+    /**
+     * Gets whether the object was inside the bounds given to the last call to cull().
+     */
+    inline bool isVisible(const RenderObject* object) const noexcept {
+      return object->_visibleCullId == _cullId;
+    }
+
+    inline size_t getObjectCount() const noexcept {
+      return _objects.size();
+    }
+
+    inline size_t getUnindexedObjectCount() const noexcept {
+      return _unindexedObjects.size();
+    }
+
+    /**
+     * Gets the number of objects that were found to be visible by the last call to cull().
+     */
+    inline size_t getLastVisibleCount() const noexcept {
+      return _lastVisibleCount;
+    }
+
+    /**
+     * Gets the bounds given to the last call to cull().
+     */
+    inline Maths::GeoBounds getLastCullBounds() const noexcept {
+      return _lastCullBounds;
+    }
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SPATIALINDEX_H
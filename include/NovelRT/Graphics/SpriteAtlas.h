@@ -0,0 +1,48 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SPRITEATLAS_H
+#define NOVELRT_GRAPHICS_SPRITEATLAS_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * A set of images packed into a few shared textures. Drawing different images from the same atlas page only changes
+   * texture coordinates, so they can all go out in one SpriteBatch draw.
+   */
+  class SpriteAtlas {
+  private:
+    std::vector<std::shared_ptr<Texture>> _pages;
+    std::vector<SpriteAtlasRegion> _regions;
+    std::unordered_map<std::string, size_t> _regionIndices;
+    LoggingService _logger;
+
+  public:
+    SpriteAtlas(std::vector<std::shared_ptr<Texture>> pages, std::vector<SpriteAtlasRegion> regions);
+
+    inline bool hasRegion(const std::string& name) const {
+      return _regionIndices.find(name) != _regionIndices.end();
+    }
+
+    /**
+     * Gets the part of the atlas an image was packed into.
+     *
+     * @param name The name the image was packed under.
+     * @returns The region, ready to be given to an ImageRect or a SpriteAnimatorFrame.
+     * @exception Exceptions::InvalidOperationException Thrown when there is no region with that name.
+     */
+    TextureRegion getRegion(const std::string& name);
+
+    inline size_t getPageCount() const noexcept {
+      return _pages.size();
+    }
+
+    inline size_t getRegionCount() const noexcept {
+      return _regions.size();
+    }
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SPRITEATLAS_H
@@ -0,0 +1,86 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SPRITEATLASBUILDER_H
+#define NOVELRT_GRAPHICS_SPRITEATLASBUILDER_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Packs a set of images into as few atlas pages as it can. Fully transparent borders can be trimmed off each image first,
+   * and every image is surrounded by a transparent gutter so that filtering never bleeds one image into its neighbour.
+   * This works purely on CPU memory, so it can be run at load time by RenderingService or offline by the atlas builder tool.
+   */
+  class SpriteAtlasBuilder {
+  public:
+    static const uint32_t DefaultPageSize = 2048;
+    static const uint32_t DefaultPadding = 2;
+
+  private:
+    struct PendingImage {
+      std::string name;
+      RgbaImage image;
+    };
+
+    uint32_t _pageSize;
+    uint32_t _padding;
+    bool _shouldTrim;
+    std::vector<PendingImage> _pendingImages;
+    std::vector<RgbaImage> _pages;
+    std::vector<SpriteAtlasRegion> _regions;
+    LoggingService _logger;
+
+    static void findOpaqueBounds(const RgbaImage& image, uint32_t& x, uint32_t& y, uint32_t& width, uint32_t& height) noexcept;
+
+  public:
+    SpriteAtlasBuilder(uint32_t pageSize = DefaultPageSize, uint32_t padding = DefaultPadding, bool shouldTrim = true);
+
+    /**
+     * Queues an image to be packed by the next call to build.
+     *
+     * @param name The name the image's region can be looked up by.
+     * @param image The image to pack.
+     */
+    void addImage(const std::string& name, RgbaImage image);
+
+    /**
+     * Packs every queued image, replacing the pages and regions from any earlier build.
+     *
+     * @exception Exceptions::InvalidOperationException Thrown when an image will not fit in a single page.
+     */
+    void build();
+
+    inline const std::vector<RgbaImage>& getPages() const noexcept {
+      return _pages;
+    }
+
+    /**
+     * Gets the region of every packed image, in the order the images were added.
+     */
+    inline const std::vector<SpriteAtlasRegion>& getRegions() const noexcept {
+      return _regions;
+    }
+
+    /**
+     * Writes a manifest describing the packed regions.
+     *
+     * @param output The stream to write to.
+     * @param pageFiles The file each page was saved to, relative to the manifest, in page order.
+     */
+    void writeManifest(std::ostream& output, const std::vector<std::string>& pageFiles) const;
+
+    /**
+     * Reads a manifest written by writeManifest.
+     *
+     * @param input The stream to read from.
+     * @param pageFiles Receives the file of each page, relative to the manifest.
+     * @param regions Receives every region in the manifest.
+     * @returns Whether the manifest was well formed. The outputs are left in an unspecified state when this returns false.
+     */
+    static bool tryReadManifest(std::istream& input, std::vector<std::string>& pageFiles, std::vector<SpriteAtlasRegion>& regions);
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SPRITEATLASBUILDER_H
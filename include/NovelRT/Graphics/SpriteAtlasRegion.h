@@ -0,0 +1,28 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SPRITEATLASREGION_H
+#define NOVELRT_GRAPHICS_SPRITEATLASREGION_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Where one image ended up in a sprite atlas, in pixels. This is what an atlas manifest stores for each image.
+   */
+  struct SpriteAtlasRegion {
+    std::string name;
+    uint32_t page = 0;
+    uint32_t x = 0;             // Left edge of the trimmed image within its page
+    uint32_t y = 0;             // Top edge of the trimmed image within its page
+    uint32_t width = 0;         // Size of the trimmed image
+    uint32_t height = 0;        // Size of the trimmed image
+    uint32_t trimX = 0;         // How far the trimmed image starts from the left of the original
+    uint32_t trimY = 0;         // How far the trimmed image starts from the top of the original
+    uint32_t sourceWidth = 0;   // Size of the original image
+    uint32_t sourceHeight = 0;  // Size of the original image
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SPRITEATLASREGION_H
@@ -0,0 +1,89 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SPRITEBATCH_H
+#define NOVELRT_GRAPHICS_SPRITEBATCH_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Collects sprites over the course of a frame and groups them by shader program and texture,
+   * so that every group can be drawn with a single instanced draw call when the batch is flushed.
+   */
+  class SpriteBatch {
+  private:
+    std::unique_ptr<SpriteBatchBackend> _backend;
+    std::map<std::pair<GLuint, const Texture*>, size_t> _groupLookup;
+    std::vector<SpriteBatchGroup> _groups;
+    std::vector<std::vector<SpriteInstanceData>> _groupInstances;
+    std::vector<SpriteInstanceData> _instances;
+    uint32_t _spriteCount;
+    uint32_t _drawCallCount;
+
+  public:
+    explicit SpriteBatch(std::unique_ptr<SpriteBatchBackend> backend) noexcept;
+
+    /**
+     * Queues a sprite for drawing. Sprites that share a shader program and texture are drawn together.
+     *
+     * @param shaderProgramId The program the sprite should be drawn with.
+     * @param texture The texture the sprite samples from.
+     * @param instance The per-instance data of the sprite.
+     */
+    void submit(GLuint shaderProgramId, const std::shared_ptr<Texture>& texture, const SpriteInstanceData& instance);
+
+    /**
+     * Queues a range of sprites that share a shader program and texture, such as those recorded into a RenderCommandList.
+     *
+     * @param shaderProgramId The program the sprites should be drawn with.
+     * @param texture The texture the sprites sample from.
+     * @param instances The per-instance data of the first sprite.
+     * @param instanceCount How many sprites there are.
+     */
+    void submit(GLuint shaderProgramId, const std::shared_ptr<Texture>& texture, const SpriteInstanceData* instances, size_t instanceCount);
+
+    /**
+     * Hands every queued group to the backend and empties the batch. Flushing an empty batch does nothing.
+     */
+    void flush();
+
+    inline size_t getPendingSpriteCount() const noexcept {
+      size_t count = 0;
+      for (size_t i = 0; i < _groups.size(); i++) {
+        count += _groupInstances[i].size();
+      }
+      return count;
+    }
+
+    inline size_t getPendingGroupCount() const noexcept {
+      return _groups.size();
+    }
+
+    /**
+     * Gets the number of sprites flushed since the last call to resetStatistics().
+     */
+    inline uint32_t getSpriteCount() const noexcept {
+      return _spriteCount;
+    }
+
+    /**
+     * Gets the number of instanced draw calls issued since the last call to resetStatistics().
+     */
+    inline uint32_t getDrawCallCount() const noexcept {
+      return _drawCallCount;
+    }
+
+    inline void resetStatistics() noexcept {
+      _spriteCount = 0;
+      _drawCallCount = 0;
+    }
+
+    inline SpriteBatchBackend* getBackend() const noexcept {
+      return _backend.get();
+    }
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SPRITEBATCH_H
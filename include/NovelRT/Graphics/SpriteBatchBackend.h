@@ -0,0 +1,27 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SPRITEBATCHBACKEND_H
+#define NOVELRT_GRAPHICS_SPRITEBATCHBACKEND_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Receives the grouped output of a SpriteBatch and turns it into draw calls.
+   */
+  class SpriteBatchBackend {
+  public:
+    /**
+     * Submits one frame's worth of sprites.
+     *
+     * @param instances The instance data of every sprite, laid out contiguously per group.
+     * @param groups The groups to draw, in submission order. Each group refers to a range inside instances.
+     */
+    virtual void submit(const std::vector<SpriteInstanceData>& instances, const std::vector<SpriteBatchGroup>& groups) = 0;
+    virtual ~SpriteBatchBackend() {}
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SPRITEBATCHBACKEND_H
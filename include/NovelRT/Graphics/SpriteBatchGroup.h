@@ -0,0 +1,23 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SPRITEBATCHGROUP_H
+#define NOVELRT_GRAPHICS_SPRITEBATCHGROUP_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * A run of sprite instances that share a shader program and texture, and can therefore be submitted as a single instanced draw.
+   */
+  struct SpriteBatchGroup {
+  public:
+    GLuint shaderProgramId = 0;
+    std::shared_ptr<Texture> texture;
+    size_t firstInstance = 0;
+    size_t instanceCount = 0;
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SPRITEBATCHGROUP_H
@@ -0,0 +1,23 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_SPRITEINSTANCEDATA_H
+#define NOVELRT_GRAPHICS_SPRITEINSTANCEDATA_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * The per-instance attributes uploaded for a single sprite in an instanced draw.
+   * The layout of this struct is mirrored by the instance attributes in the textured vertex shaders, so it must stay tightly packed.
+   */
+  struct SpriteInstanceData {
+  public:
+    Maths::GeoMatrix4x4F transform; // The model matrix of the sprite. The camera matrix is applied on the GPU from the shared camera UBO.
+    Maths::GeoVector4F uvRect;      // The UV origin (x, y) and UV size (z, w) of the region to sample.
+    Maths::GeoVector4F colourTint;  // The colour tint as normalised RGBA scalars.
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_SPRITEINSTANCEDATA_H
@@ -8,28 +8,61 @@
 #endif
 
 namespace NovelRT::Graphics {
+  /**
+   * Draws a string as a single mesh with one quad per glyph. The mesh is only rebuilt when the text or font changes; moving the
+   * rect, changing its colour or changing its font size does not touch it. Bitmap fonts are always drawn at the size they were
+   * rasterised at, while distance field fonts are scaled to the rect's font size. The scale of the transform is ignored.
+   */
   class TextRect : public RenderObject {
 
   private:
-    void reloadText();
+    struct MeshRange {
+      std::shared_ptr<Texture> texture;
+      GLsizei firstIndex;
+      GLsizei indexCount;
+    };
+
+    void rebuildMesh();
+    float getGlyphScale() const noexcept;
 
     std::string _fontFileDir;
     std::string _previousFontFileDir;
     std::string _text;
-    std::vector<std::unique_ptr<ImageRect>> _letterRects;
     LoggingService _logger;
     RGBAConfig _colourConfig;
     std::shared_ptr<FontSet> _fontSet;
+    float _fontSize;
+    RGBAConfig _outlineColour;
+    float _outlineWidth;
+    RGBAConfig _shadowColour;
+    Maths::GeoVector2F _shadowOffset;
+    GLint _outlineColourUniformLocation;
+    GLint _outlineWidthUniformLocation;
+    GLint _shadowColourUniformLocation;
+    GLint _shadowOffsetUniformLocation;
+
+    Utilities::Lazy<GLuint> _vertexArrayObject;
+    Utilities::Lazy<GLuint> _vertexBuffer;
+    Utilities::Lazy<GLuint> _indexBuffer;
+    std::vector<GLfloat> _vertexData;
+    std::vector<GLuint> _indexData;
+    std::vector<MeshRange> _meshRanges;
+    Maths::GeoBounds _meshBounds;
+    bool _isMeshDirty;
 
   protected:
     void configureObjectBuffers() final;
     void drawObject() final;
+    bool isTranslucent() const noexcept final;
+    Maths::GeoVector2F getModelScale() const final;
+    Maths::GeoBounds getCullingBounds() const final;
 
   public:
     TextRect(Transform transform,
       int32_t layer,
       ShaderProgram programId,
       std::shared_ptr<Camera> camera,
+      std::shared_ptr<RenderingService> renderer,
       std::shared_ptr<FontSet> fontSet,
       RGBAConfig colourConfig);
 
@@ -43,16 +76,73 @@ namespace NovelRT::Graphics {
     std::string getText() const;
     void setText(const std::string& value);
 
-    void setActive(bool value) override;
-
     inline std::shared_ptr<FontSet> getFontSet() const noexcept {
       return _fontSet;
     }
 
-    inline void setFontSet(std::shared_ptr<FontSet> value) noexcept {
-      _fontSet = value;
+    /**
+     * Replaces the font. The new FontSet must use the same FontRenderMode as the old one, since the mode decides which shader
+     * this rect was created with.
+     *
+     * @exception Exceptions::InvalidOperationException Thrown when the new FontSet uses a different FontRenderMode.
+     */
+    void setFontSet(std::shared_ptr<FontSet> value);
+
+    inline float getFontSize() const noexcept {
+      return _fontSize;
+    }
+
+    /**
+     * Sets the size to draw the text at, in pixels. Only distance field fonts can be drawn at a size other than their own.
+     */
+    inline void setFontSize(float value) noexcept {
+      _fontSize = value;
+      _isDirty = true;
+    }
+
+    /**
+     * Draws an outline around each glyph. Outlines need a distance field font, and are ignored otherwise.
+     *
+     * @param colour The colour of the outline. Fully transparent colours turn the outline off.
+     * @param width How far the outline reaches out from each glyph, in pixels at the rect's font size. It is limited by the
+     * distance field's spread.
+     */
+    inline void setOutline(RGBAConfig colour, float width) noexcept {
+      _outlineColour = colour;
+      _outlineWidth = width;
+      _isDirty = true;
+    }
+
+    inline RGBAConfig getOutlineColour() const noexcept {
+      return _outlineColour;
+    }
+
+    inline float getOutlineWidth() const noexcept {
+      return _outlineWidth;
+    }
+
+    /**
+     * Draws a drop shadow behind each glyph. Drop shadows need a distance field font, and are ignored otherwise.
+     *
+     * @param colour The colour of the shadow. Fully transparent colours turn the shadow off.
+     * @param offset How far the shadow is moved from the text, in pixels at the rect's font size. It is limited by the distance
+     * field's spread.
+     */
+    inline void setDropShadow(RGBAConfig colour, Maths::GeoVector2F offset) noexcept {
+      _shadowColour = colour;
+      _shadowOffset = offset;
+      _isDirty = true;
+    }
+
+    inline RGBAConfig getShadowColour() const noexcept {
+      return _shadowColour;
+    }
+
+    inline Maths::GeoVector2F getShadowOffset() const noexcept {
+      return _shadowOffset;
     }
 
+    ~TextRect();
   };
 }
 
@@ -11,6 +11,11 @@ namespace NovelRT::Graphics {
     friend class TextRect;
     friend class RenderingService;
     friend class FontSet;
+    friend class OpenGLSpriteBatchBackend;
+    friend class ParticleSystem;
+    friend class ScreenTransition;
+    friend class RenderLayer;
+    friend class TextureLoader;
   private:
     Atom _id;
     std::shared_ptr<RenderingService> _renderer;
@@ -18,11 +23,20 @@ namespace NovelRT::Graphics {
     LoggingService _logger; //not proud of this
     std::string _textureFile;
     Maths::GeoVector2F _size;
+    TextureAlphaMode _alphaMode;
+    std::shared_ptr<Texture> _placeholder;
 
     inline GLuint getTextureIdInternal() noexcept {
-      return _textureId.getActual();
+      return _placeholder != nullptr ? _placeholder->getTextureIdInternal() : _textureId.getActual();
     }
 
+    void allocateAndUpload(uint32_t width, uint32_t height, const GLvoid* pixels);
+
+    /**
+     * Allocates a single level texture to be drawn into through a framebuffer, without uploading anything.
+     */
+    void allocateRenderTarget(uint32_t width, uint32_t height);
+
     inline void setTextureIdInternal(GLuint textureId) noexcept {
       _textureId.reset(textureId);
     }
@@ -35,10 +49,59 @@ namespace NovelRT::Graphics {
     Texture(std::shared_ptr<RenderingService> renderer, Atom id);
     void loadPngAsTexture(const std::string& file);
 
+    /**
+     * Decodes a QOI file and uploads it into this texture.
+     *
+     * @param file The QOI file.
+     * @exception Exceptions::InvalidOperationException Thrown when this texture has already been loaded.
+     * @exception Exceptions::FileNotFoundException Thrown when the file cannot be opened.
+     * @exception Exceptions::IOException Thrown when the file is not a valid QOI file.
+     */
+    void loadQoiAsTexture(const std::string& file);
+
+    /**
+     * Uploads a texture container (.nrtex) into this texture. The file is memory mapped and each stored mip level is handed
+     * to the driver straight from the mapping, compressed or not, without being decoded or copied.
+     *
+     * @param file The texture container file.
+     * @exception Exceptions::InvalidOperationException Thrown when this texture has already been loaded.
+     * @exception Exceptions::FileNotFoundException Thrown when the file cannot be opened.
+     * @exception Exceptions::IOException Thrown when the file is not a valid texture container.
+     */
+    void loadContainerAsTexture(const std::string& file);
+
+    /**
+     * Uploads an image that has already been decoded into this texture.
+     *
+     * @param image The image to upload.
+     * @exception Exceptions::InvalidOperationException Thrown when this texture has already been loaded.
+     */
+    void loadRgbaImageAsTexture(const RgbaImage& image);
+
+    /**
+     * Gets a region of this texture from a rectangle in pixels, measured from the top left of the image.
+     */
+    TextureRegion getRegion(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
     inline const std::string& getTextureFile() const noexcept {
       return _textureFile;
     }
 
+    /**
+     * Gets whether this texture is still being loaded in the background. Until it is done, it draws as a placeholder.
+     */
+    inline bool isLoading() const noexcept {
+      return _placeholder != nullptr;
+    }
+
+    /**
+     * Gets how this texture has to be blended, found by scanning its alpha when it was loaded. Textures whose alpha is not known,
+     * such as render targets and compressed textures with alpha, are treated as translucent.
+     */
+    inline TextureAlphaMode getAlphaMode() const noexcept {
+      return _placeholder != nullptr ? _placeholder->getAlphaMode() : _alphaMode;
+    }
+
     inline Maths::GeoVector2F getSize() const noexcept {
       return _size;
     }
@@ -0,0 +1,18 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_TEXTUREALPHAMODE_H
+#define NOVELRT_GRAPHICS_TEXTUREALPHAMODE_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  enum class TextureAlphaMode {
+    Opaque, // Every pixel is fully opaque, so the texture can be drawn without blending.
+    Cutout, // Every pixel is either fully opaque or fully transparent, so transparent pixels can be discarded instead of blended.
+    Translucent // Some pixels are partially transparent and have to be blended with what is behind them.
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_TEXTUREALPHAMODE_H
@@ -0,0 +1,89 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_TEXTURECONTAINER_H
+#define NOVELRT_GRAPHICS_TEXTURECONTAINER_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * A texture file that stores every mip level ready to upload, optionally compressed as ETC2. The file is memory mapped
+   * rather than read, so its levels can go to the driver without being copied or decoded first.
+   * Files are made with the TextureConverter tool and use the .nrtex extension.
+   */
+  class TextureContainer {
+  private:
+    Utilities::MemoryMappedFile _mappedFile;
+    TextureContainerFormat _format;
+    uint32_t _width;
+    uint32_t _height;
+    std::vector<TextureContainerLevel> _levels;
+
+  public:
+    /**
+     * Maps a texture container and checks that it is well formed.
+     *
+     * @param file The .nrtex file to map.
+     * @exception Exceptions::FileNotFoundException Thrown when the file cannot be opened.
+     * @exception Exceptions::IOException Thrown when the file is not a valid texture container.
+     */
+    TextureContainer(const std::string& file);
+    TextureContainer(const TextureContainer&) = delete;
+    TextureContainer& operator=(const TextureContainer&) = delete;
+
+    inline TextureContainerFormat getFormat() const noexcept {
+      return _format;
+    }
+
+    inline uint32_t getWidth() const noexcept {
+      return _width;
+    }
+
+    inline uint32_t getHeight() const noexcept {
+      return _height;
+    }
+
+    /**
+     * Gets the mip levels stored in the file, largest first.
+     */
+    inline const std::vector<TextureContainerLevel>& getLevels() const noexcept {
+      return _levels;
+    }
+
+    /**
+     * Gets whether a file should be loaded as a texture container rather than as a PNG, going by its extension.
+     */
+    static bool isContainerFile(const std::string& file);
+
+    /**
+     * Halves an image again and again down to a single pixel. Colours are averaged by alpha, so transparent pixels do not
+     * darken the edges of what is next to them.
+     *
+     * @returns Every level, starting with a copy of the image itself.
+     */
+    static std::vector<RgbaImage> generateMipChain(const RgbaImage& image);
+
+    /**
+     * Encodes an image as a texture container.
+     *
+     * @param image The image to encode.
+     * @param format How the levels are stored.
+     * @param shouldGenerateMipmaps Whether to store a full mip chain rather than only the image itself.
+     * @returns The bytes of the container file.
+     * @exception Exceptions::InvalidOperationException Thrown when the image is empty.
+     */
+    static std::vector<uint8_t> encode(const RgbaImage& image, TextureContainerFormat format, bool shouldGenerateMipmaps = true);
+
+    /**
+     * Encodes an image into a texture container file, replacing the file if it already exists.
+     *
+     * @exception Exceptions::InvalidOperationException Thrown when the image is empty.
+     * @exception Exceptions::IOException Thrown when the file cannot be written.
+     */
+    static void encodeFile(const std::string& file, const RgbaImage& image, TextureContainerFormat format, bool shouldGenerateMipmaps = true);
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_TEXTURECONTAINER_H
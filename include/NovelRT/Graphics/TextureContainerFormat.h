@@ -0,0 +1,18 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_TEXTURECONTAINERFORMAT_H
+#define NOVELRT_GRAPHICS_TEXTURECONTAINERFORMAT_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  enum class TextureContainerFormat : uint32_t {
+    Rgba8 = 0, // Uncompressed 8 bit RGBA. Lossless, and as large in VRAM as a PNG loaded the usual way.
+    Etc2Rgb8 = 1, // GL_COMPRESSED_RGB8_ETC2. An eighth of the size of Rgba8, for images without transparency.
+    Etc2Rgba8 = 2 // GL_COMPRESSED_RGBA8_ETC2_EAC. A quarter of the size of Rgba8.
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_TEXTURECONTAINERFORMAT_H
@@ -0,0 +1,22 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_TEXTURECONTAINERLEVEL_H
+#define NOVELRT_GRAPHICS_TEXTURECONTAINERLEVEL_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * One mip level of a TextureContainer. The data points straight into the mapped file, so it is only valid while the container is.
+   */
+  struct TextureContainerLevel {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_TEXTURECONTAINERLEVEL_H
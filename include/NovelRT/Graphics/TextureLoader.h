@@ -0,0 +1,114 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_TEXTURELOADER_H
+#define NOVELRT_GRAPHICS_TEXTURELOADER_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Loads textures in the background. Files are decoded on an ImageDecodeWorkerPool, then uploaded on the render thread
+   * at the start of each frame, a few at a time, so that loading a large image never stalls a frame for long.
+   * Uploads go through a pixel unpack buffer into immutable texture storage.
+   */
+  class TextureLoader {
+  public:
+    static const size_t DefaultUploadByteBudget = 16 * 1024 * 1024;
+
+  private:
+    struct PendingUpload {
+      std::weak_ptr<Texture> texture;
+      std::chrono::steady_clock::time_point requestTime;
+    };
+
+    std::shared_ptr<GLStateCache> _glState;
+    ImageDecodeWorkerPool _decoder;
+    std::unordered_map<uint64_t, PendingUpload> _pendingUploads;
+    uint64_t _nextRequestId;
+    Utilities::Lazy<GLuint> _pixelUnpackBuffer;
+    Timing::Timestamp _uploadTimeBudget;
+    size_t _uploadByteBudget;
+    Timing::Timestamp _lastFrameUploadTime;
+    size_t _lastFrameUploadedBytes;
+    Timing::Timestamp _lastLoadLatency;
+    LoggingService _logger;
+
+    void upload(Texture& texture, const RgbaImage& image, TextureAlphaMode alphaMode);
+
+  public:
+    TextureLoader(std::shared_ptr<GLStateCache> glState) noexcept;
+    TextureLoader(const TextureLoader&) = delete;
+    TextureLoader& operator=(const TextureLoader&) = delete;
+
+    /**
+     * Starts loading a PNG file into a texture. The texture keeps drawing its placeholder until the upload has happened.
+     */
+    void request(const std::shared_ptr<Texture>& texture, const std::string& file);
+
+    /**
+     * Uploads finished decodes until this frame's time or byte budget is used up. At least one image is uploaded whenever
+     * one is ready, so images larger than the byte budget still get through. Must be called on the render thread.
+     */
+    void processUploads();
+
+    /**
+     * Sets how long processUploads may spend uploading each frame.
+     */
+    inline void setUploadTimeBudget(Timing::Timestamp value) noexcept {
+      _uploadTimeBudget = value;
+    }
+
+    inline Timing::Timestamp getUploadTimeBudget() const noexcept {
+      return _uploadTimeBudget;
+    }
+
+    /**
+     * Sets how many bytes of pixels processUploads may upload each frame.
+     */
+    inline void setUploadByteBudget(size_t value) noexcept {
+      _uploadByteBudget = value;
+    }
+
+    inline size_t getUploadByteBudget() const noexcept {
+      return _uploadByteBudget;
+    }
+
+    /**
+     * Gets the number of textures that have been requested but not uploaded yet.
+     */
+    inline size_t getPendingCount() const noexcept {
+      return _pendingUploads.size();
+    }
+
+    /**
+     * Gets the number of bytes of decoded pixels that are waiting for their turn to be uploaded.
+     */
+    inline size_t getQueuedBytes() const {
+      return _decoder.getResultBytes();
+    }
+
+    /**
+     * Gets how long the last call to processUploads spent uploading.
+     */
+    inline Timing::Timestamp getLastFrameUploadTime() const noexcept {
+      return _lastFrameUploadTime;
+    }
+
+    inline size_t getLastFrameUploadedBytes() const noexcept {
+      return _lastFrameUploadedBytes;
+    }
+
+    /**
+     * Gets the time between the most recently finished texture being requested and it being ready to draw.
+     */
+    inline Timing::Timestamp getLastLoadLatency() const noexcept {
+      return _lastLoadLatency;
+    }
+
+    ~TextureLoader();
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_TEXTURELOADER_H
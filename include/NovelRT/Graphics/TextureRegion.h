@@ -0,0 +1,31 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_TEXTUREREGION_H
+#define NOVELRT_GRAPHICS_TEXTUREREGION_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * A part of a texture that can be drawn on its own, such as a single frame packed into a sprite atlas.
+   */
+  struct TextureRegion {
+    std::shared_ptr<Texture> texture;
+
+    /**
+     * The origin (x, y) and size (z, w) of the region within the texture, in texture coordinates.
+     */
+    Maths::GeoVector4F uvRect = Maths::GeoVector4F(0.0f, 0.0f, 1.0f, 1.0f);
+
+    /**
+     * The origin (x, y) and size (z, w) of the region within the image it was cut from, as fractions of that image.
+     * This is smaller than the whole image when transparent borders were trimmed away while packing, and lets a rect
+     * sized for the original image draw the region in the right place.
+     */
+    Maths::GeoVector4F contentRect = Maths::GeoVector4F(0.0f, 0.0f, 1.0f, 1.0f);
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_TEXTUREREGION_H
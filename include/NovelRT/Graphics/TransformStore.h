@@ -0,0 +1,110 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_GRAPHICS_TRANSFORMSTORE_H
+#define NOVELRT_GRAPHICS_TRANSFORMSTORE_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Graphics {
+  /**
+   * Holds the transforms of every RenderObject in structure of arrays form, and builds their model matrices in batches.
+   * Objects write their transform in when it changes, which marks their slot dirty. Once per frame, update() rebuilds every dirty
+   * matrix in one pass, several slots at a time with SSE2 or AVX2 when the build targets them. Matrices are translate * rotate * scale,
+   * with the layer as the Z translation.
+   */
+  class TransformStore {
+  public:
+    static const uint32_t InvalidHandle = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * The fewest dirty slots update() hands to a worker thread. Below this, waking the threads costs more than it saves.
+     */
+    static const size_t MinimumHandlesPerTask = 2048;
+
+  private:
+    std::vector<float> _positionX;
+    std::vector<float> _positionY;
+    std::vector<float> _rotation;
+    std::vector<float> _scaleX;
+    std::vector<float> _scaleY;
+    std::vector<float> _layer;
+    std::vector<Maths::GeoMatrix4x4F> _modelMatrices;
+    std::vector<uint64_t> _dirtyBits;
+    std::vector<uint32_t> _dirtyHandles;
+    std::vector<uint32_t> _freeHandles;
+    size_t _lastUpdateCount;
+
+    inline bool isDirty(uint32_t handle) const noexcept {
+      return (_dirtyBits[handle / 64] >> (handle % 64)) & 1;
+    }
+
+    inline void setDirty(uint32_t handle, bool value) noexcept {
+      auto bit = uint64_t(1) << (handle % 64);
+      _dirtyBits[handle / 64] = value ? (_dirtyBits[handle / 64] | bit) : (_dirtyBits[handle / 64] & ~bit);
+    }
+
+    void computeModelMatrices(const uint32_t* handles, size_t count) noexcept;
+
+  public:
+    TransformStore() noexcept;
+
+    /**
+     * Reserves a slot for a new transform. Slots start out with an identity transform that is not dirty.
+     *
+     * @returns The handle of the slot.
+     */
+    uint32_t allocate();
+
+    /**
+     * Returns a slot so a later allocate can reuse it.
+     */
+    void release(uint32_t handle) noexcept;
+
+    /**
+     * Writes a transform into a slot and marks it dirty. Its matrix is rebuilt by the next update, or by getModelMatrix if that comes first.
+     *
+     * @param handle The slot to write to.
+     * @param position The translation, in world units.
+     * @param rotation The rotation around Z, in degrees.
+     * @param scale The scale along X and Y.
+     * @param layer The Z translation.
+     */
+    void set(uint32_t handle, Maths::GeoVector2F position, float rotation, Maths::GeoVector2F scale, float layer) noexcept;
+
+    /**
+     * Gets the model matrix of a slot. A slot that is still dirty is rebuilt on its own first, so this is always up to date.
+     */
+    const Maths::GeoMatrix4x4F& getModelMatrix(uint32_t handle) noexcept;
+
+    /**
+     * Rebuilds the model matrix of every dirty slot, then clears the dirty bits.
+     *
+     * @param workerPool If provided, and there are enough dirty slots to be worth it, the slots are split between its threads.
+     * @returns How many matrices were rebuilt.
+     */
+    size_t update(RenderWorkerPool* workerPool = nullptr);
+
+    /**
+     * Gets how many slots exist, including released ones waiting to be reused.
+     */
+    inline size_t getCapacity() const noexcept {
+      return _modelMatrices.size();
+    }
+
+    /**
+     * Gets how many matrices the last update rebuilt.
+     */
+    inline size_t getLastUpdateCount() const noexcept {
+      return _lastUpdateCount;
+    }
+
+    /**
+     * Gets the instruction set the matrix kernel was compiled for: "AVX2", "SSE2" or "Scalar".
+     */
+    static const char* getInstructionSet() noexcept;
+  };
+}
+
+#endif //NOVELRT_GRAPHICS_TRANSFORMSTORE_H
@@ -31,12 +31,25 @@ namespace NovelRT::Input {
   public:
     InteractionService(std::shared_ptr<Windowing::WindowingService> windowingService) noexcept;
 
-    void consumePlayerInput();
+    /**
+     * Collects the input that has arrived since the last call.
+     *
+     * @param maximumWait How long to block for if no input has arrived yet. The game loop waits here while there is nothing
+     * new to draw, rather than spinning.
+     */
+    void consumePlayerInput(Timing::Timestamp maximumWait = Timing::Timestamp::zero());
 
     std::unique_ptr<BasicInteractionRect> createBasicInteractionRect(Transform transform, int32_t layer);
 
     void executeClickedInteractable();
 
+    /**
+     * Gets whether an interactable was clicked this frame and is waiting for executeClickedInteractable to run it.
+     */
+    inline bool hasClickedInteractable() const noexcept {
+      return _clickTarget != nullptr;
+    }
+
     inline void setScreenSize(Maths::GeoVector2F value) noexcept {
       _screenSize = value;
     }
@@ -25,6 +25,8 @@ namespace NovelRT {
     Utilities::Event<Timing::Timestamp> Update;
   private:
     int32_t _exitCode;
+    Timing::Timestamp _idleTimeout;
+    Timing::Timestamp _nextUpdateDelay;
     Utilities::Lazy<std::unique_ptr<Timing::StepTimer>> _stepTimer;
     std::shared_ptr<Windowing::WindowingService> _novelWindowingService;
     std::shared_ptr<Input::InteractionService> _novelInteractionService;
@@ -41,14 +43,43 @@ namespace NovelRT {
      * @param displayNumber The display on which to start the novel.
      * @param windowTitle The title of the window created for NovelRunner.
      * @param targetFrameRate The framerate that should be targeted and capped.
+     * @param transparency Whether the window's framebuffer is transparent.
+     * @param headless Whether to render offscreen through EGL instead of opening a window. Headless runs render at 1920x1080
+     * until the windowing service is resized, and take no input. Use RenderingService::captureFrame to see what was drawn.
      */
-    explicit NovelRunner(int32_t displayNumber, const std::string& windowTitle = "NovelRTTest", uint32_t targetFrameRate = 0, bool transparency = false);
+    explicit NovelRunner(int32_t displayNumber, const std::string& windowTitle = "NovelRTTest", uint32_t targetFrameRate = 0, bool transparency = false,
+      bool headless = false);
     /**
      * Launches the NovelRT game loop. This method will block until the game terminates.
      * @returns Exit code.
      */
     int32_t runNovel();
 
+    /**
+     * Stops the game loop once the current frame is finished. Headless runs have no window to close, so this is how they end.
+     */
+    void requestExit() noexcept;
+
+    /**
+     * Gets the longest the game loop will wait for input while nothing on screen is changing. Update keeps being raised at
+     * least this often, so that handlers which only change things after a while are not starved.
+     */
+    inline Timing::Timestamp getIdleTimeout() const noexcept {
+      return _idleTimeout;
+    }
+
+    inline void setIdleTimeout(Timing::Timestamp value) noexcept {
+      _idleTimeout = value;
+    }
+
+    /**
+     * Asks for Update to be raised again within the given time, even if the game loop is waiting for input. This only lasts
+     * for the current frame, so anything that runs to a timer, such as an animation between frames, asks again every Update.
+     */
+    inline void requestUpdateWithin(Timing::Timestamp delay) noexcept {
+      _nextUpdateDelay = std::min(_nextUpdateDelay, delay);
+    }
+
     /// Gets the Rendering Service associated with this Runner.
     std::shared_ptr<Graphics::RenderingService> getRenderer() const;
     /// Gets the Interaction Service associated with this Runner
@@ -0,0 +1,56 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_UTILITIES_MEMORYMAPPEDFILE_H
+#define NOVELRT_UTILITIES_MEMORYMAPPEDFILE_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Utilities {
+  /**
+   * A read only view of a whole file, mapped into memory instead of being read into a buffer. Pages are only read from disk
+   * as they are touched, and they are shared with every other process that maps the same file.
+   */
+  class MemoryMappedFile {
+  private:
+    std::string _file;
+    const uint8_t* _data;
+    size_t _size;
+#if defined(WIN32)
+    HANDLE _fileHandle;
+    HANDLE _mappingHandle;
+#endif
+
+  public:
+    /**
+     * Maps a file into memory.
+     *
+     * @param file The file to map.
+     * @exception Exceptions::FileNotFoundException Thrown when the file cannot be opened.
+     * @exception Exceptions::IOException Thrown when the file is opened but cannot be mapped.
+     */
+    MemoryMappedFile(const std::string& file);
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    inline const std::string& getFile() const noexcept {
+      return _file;
+    }
+
+    /**
+     * Gets the start of the mapped file. Empty files are never mapped, so this is nullptr for them.
+     */
+    inline const uint8_t* getData() const noexcept {
+      return _data;
+    }
+
+    inline size_t getSize() const noexcept {
+      return _size;
+    }
+
+    ~MemoryMappedFile();
+  };
+}
+
+#endif //NOVELRT_UTILITIES_MEMORYMAPPEDFILE_H
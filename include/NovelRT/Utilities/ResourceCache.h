@@ -0,0 +1,101 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_UTILITIES_RESOURCECACHE_H
+#define NOVELRT_UTILITIES_RESOURCECACHE_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Utilities {
+  /**
+   * A hashed index of shared resources that does not keep them alive. Lookups cost the same however many resources are cached,
+   * and entries whose resource has been destroyed are swept away a bucket at a time as new entries are added, so the index never
+   * has to be walked in full.
+   */
+  template<typename TKey, typename TResource, typename THash = std::hash<TKey>>
+  class ResourceCache {
+  private:
+    std::unordered_map<TKey, std::weak_ptr<TResource>, THash> _entries;
+    size_t _sweepBucket;
+    uint64_t _hitCount;
+    uint64_t _missCount;
+
+    void sweepNextBucket() {
+      if (_entries.bucket_count() == 0) return;
+
+      _sweepBucket = (_sweepBucket + 1) % _entries.bucket_count();
+
+      //Erasing invalidates the bucket's local iterators, so gather the expired keys first.
+      std::vector<TKey> expiredKeys;
+      for (auto entry = _entries.begin(_sweepBucket); entry != _entries.end(_sweepBucket); ++entry) {
+        if (entry->second.expired()) {
+          expiredKeys.push_back(entry->first);
+        }
+      }
+
+      for (auto& key : expiredKeys) {
+        _entries.erase(key);
+      }
+    }
+
+  public:
+    ResourceCache() : _entries(), _sweepBucket(0), _hitCount(0), _missCount(0) {}
+
+    /**
+     * Looks up a live resource, counting the lookup as a hit or a miss.
+     *
+     * @returns The resource, or nullptr when nothing is cached under the key or the cached resource has since been destroyed.
+     */
+    std::shared_ptr<TResource> tryGet(const TKey& key) {
+      auto match = _entries.find(key);
+      if (match != _entries.end()) {
+        auto resource = match->second.lock();
+        if (resource != nullptr) {
+          _hitCount++;
+          return resource;
+        }
+
+        _entries.erase(match);
+      }
+
+      _missCount++;
+      return nullptr;
+    }
+
+    /**
+     * Caches a resource, replacing whatever was cached under the key before.
+     */
+    void insert(const TKey& key, const std::shared_ptr<TResource>& resource) {
+      //Two buckets per insert lets the sweep keep pace with the table as it grows.
+      sweepNextBucket();
+      sweepNextBucket();
+      _entries.insert_or_assign(key, std::weak_ptr<TResource>(resource));
+    }
+
+    /**
+     * Removes the entry for a key if its resource has been destroyed. Resources call this from their destructor, so that a
+     * newer resource cached under the same key is left alone.
+     */
+    void removeIfExpired(const TKey& key) {
+      auto match = _entries.find(key);
+      if (match == _entries.end() || !match->second.expired()) return;
+
+      _entries.erase(match);
+    }
+
+    inline size_t getCount() const noexcept {
+      return _entries.size();
+    }
+
+    inline uint64_t getHitCount() const noexcept {
+      return _hitCount;
+    }
+
+    inline uint64_t getMissCount() const noexcept {
+      return _missCount;
+    }
+  };
+}
+
+#endif //NOVELRT_UTILITIES_RESOURCECACHE_H
@@ -0,0 +1,48 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#ifndef NOVELRT_WINDOWING_HEADLESSCONTEXT_H
+#define NOVELRT_WINDOWING_HEADLESSCONTEXT_H
+
+#ifndef NOVELRT_H
+#error Please do not include this directly. Use the centralised header (NovelRT.h) instead!
+#endif
+
+namespace NovelRT::Windowing {
+  /**
+   * An OpenGL ES 3.0 context created through EGL without a window or a display server, for CI and benchmark runs.
+   * Mesa's surfaceless platform is preferred so nothing needs X11 or Wayland. When the driver cannot make a context current without
+   * a surface, a 1x1 pbuffer is bound instead. Either way the default framebuffer is not meant to be drawn to; the rendering service
+   * renders into its own framebuffer object.
+   */
+  class HeadlessContext {
+  private:
+    void* _display;
+    void* _context;
+    void* _surface;
+    LoggingService _logger;
+
+    void release() noexcept;
+
+  public:
+    /**
+     * Creates the context.
+     *
+     * @exception Exceptions::NotSupportedException Thrown when the engine was built without EGL.
+     * @exception Exceptions::InitialisationFailureException Thrown when EGL cannot create an OpenGL ES 3.0 context.
+     */
+    HeadlessContext();
+    HeadlessContext(const HeadlessContext&) = delete;
+    HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+    void makeCurrent();
+
+    /**
+     * Looks up a GL entry point. This is what glad is loaded with in headless mode.
+     */
+    static void* getProcAddress(const char* name);
+
+    ~HeadlessContext();
+  };
+}
+
+#endif //NOVELRT_WINDOWING_HEADLESSCONTEXT_H
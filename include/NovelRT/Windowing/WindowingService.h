@@ -28,15 +28,18 @@ namespace NovelRT::Windowing {
 
     Utilities::Event<Maths::GeoVector2F> WindowResized;
     Utilities::Event<> WindowTornDown;
+    Utilities::Event<> WindowRefreshRequested;
     Utilities::Event<MouseClickEventArgs> MouseButtonClicked;
     Utilities::Event<KeyboardButtonChangeEventArgs> KeyboardButtonChanged;
 
   private:
     Maths::GeoVector2F _windowSize;
     std::unique_ptr<GLFWwindow, decltype(&glfwDestroyWindow)> _window;
+    std::unique_ptr<HeadlessContext> _headlessContext;
     LoggingService _logger;
     std::string _windowTitle;
     bool _isTornDown;
+    bool _isHeadless;
 
 #if defined(_WIN32) || defined(_WIN64)
     HMODULE _optimus;
@@ -49,24 +52,58 @@ namespace NovelRT::Windowing {
     explicit WindowingService() noexcept;
 
     void initialiseWindow(int32_t displayNumber, const std::string& windowTitle, bool transparencyEnabled);
+
+    /**
+     * Creates an offscreen OpenGL ES context through EGL instead of a window, for CI and benchmark runs. There is no window and no
+     * input; the rendering service draws into a framebuffer object of the given size instead.
+     *
+     * @param windowTitle The title reported by getWindowTitle. Nothing displays it.
+     * @param windowSize The size of the offscreen framebuffer, in pixels.
+     * @exception Exceptions::NotSupportedException Thrown when the engine was built without EGL.
+     * @exception Exceptions::InitialisationFailureException Thrown when EGL cannot create an OpenGL ES 3.0 context.
+     */
+    void initialiseHeadless(const std::string& windowTitle, Maths::GeoVector2F windowSize);
     void tearDown();
 
+    /**
+     * Makes the OpenGL context current on the calling thread.
+     */
+    void makeContextCurrent();
+
+    /**
+     * Gets the function glad should load OpenGL entry points with.
+     */
+    GLADloadproc getProcAddressLoader() const;
+
+    /**
+     * Presents the frame. Headless runs have nothing to present, so this waits for the GPU to finish the frame instead,
+     * keeping frame times honest.
+     */
+    void swapBuffers();
+
     inline GLFWwindow* getWindow() const {
       return _window.get();
     }
 
+    inline bool isHeadless() const noexcept {
+      return _isHeadless;
+    }
+
     inline std::string getWindowTitle() const {
       return _windowTitle;
     }
 
     inline void setWindowTitle(const std::string& value) {
       _windowTitle = value;
-      return glfwSetWindowTitle(getWindow(), _windowTitle.c_str());
+      if (isHeadless()) return;
+      glfwSetWindowTitle(getWindow(), _windowTitle.c_str());
     }
 
     inline void setWindowSize(Maths::GeoVector2F value) {
       _windowSize = value;
-      glfwSetWindowSize(getWindow(), static_cast<int32_t>(value.x), static_cast<int32_t>(value.y));
+      if (!isHeadless()) {
+        glfwSetWindowSize(getWindow(), static_cast<int32_t>(value.x), static_cast<int32_t>(value.y));
+      }
       WindowResized(_windowSize);
     }
 
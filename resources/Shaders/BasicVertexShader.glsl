@@ -4,13 +4,13 @@
 layout(location = 0) in vec3 vertexPosition;
 layout(location = 1) in vec4 vertexColour;
 
-layout (std140) uniform finalViewMatrixBuffer {
-  mat4 modelViewProjection;
+layout (std140) uniform cameraMatrixBuffer {
+  mat4 cameraMatrix;
 };
 
 out vec4 fragmentColour;
 
 void main(){
-    gl_Position = vec4(vertexPosition, 1.0f) * modelViewProjection;
+    gl_Position = cameraMatrix * vec4(vertexPosition, 1.0f);
     fragmentColour = vertexColour;
 }
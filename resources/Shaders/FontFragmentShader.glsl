@@ -8,9 +8,43 @@ in vec4 colourTint;
 
 uniform sampler2D ourTexture;
 
+#ifdef DISTANCE_FIELD
+uniform vec4 outlineColour;
+uniform float outlineWidth;
+uniform vec4 shadowColour;
+uniform vec2 shadowOffset;
+
+// Layers are composited premultiplied, so that each edge only fades out once.
+vec4 premultiply(vec3 colour, float alpha)
+{
+    return vec4(colour * alpha, alpha);
+}
+
+void main()
+{
+    // 0.5 is the glyph's edge. Keeping the ramp about a screen pixel wide keeps the edge sharp at any scale.
+    float distance = texture(ourTexture, texCoord).r;
+    float smoothing = max(fwidth(distance) * 0.5, 0.001);
+    float outerEdge = 0.5 - outlineWidth;
+
+    float fillAlpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance) * colourTint.a;
+    float outlineAlpha = smoothstep(outerEdge - smoothing, outerEdge + smoothing, distance) * outlineColour.a;
+    float shadowDistance = texture(ourTexture, texCoord - shadowOffset).r;
+    float shadowAlpha = smoothstep(outerEdge - smoothing, outerEdge + smoothing, shadowDistance) * shadowColour.a;
+
+    vec4 result = premultiply(shadowColour.rgb, shadowAlpha);
+    vec4 outline = premultiply(outlineColour.rgb, outlineAlpha);
+    result = outline + result * (1.0 - outline.a);
+    vec4 fill = premultiply(colourTint.rgb, fillAlpha);
+    result = fill + result * (1.0 - fill.a);
+
+    fragColor = result.a > 0.0 ? vec4(result.rgb / result.a, result.a) : vec4(0.0);
+}
+#else
 void main()
 {
     vec3 glyphColour = texture(ourTexture, texCoord).rgb;
     float alpha = glyphColour.r;
     fragColor = vec4(1, 1, 1, alpha)  * colourTint;
 }
+#endif
@@ -1,12 +1,14 @@
 // Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
 #version 300 es
 
-layout (location = 0) in vec3 vertexPosition;
-layout (location = 1) in vec2 aTexCoord;
-layout (location = 2) in vec4 aColourTint;
+layout (location = 0) in vec2 vertexPosition;
+layout (location = 1) in vec2 vertexTexCoord;
+layout (location = 2) in vec4 vertexColourTint;
 
-layout (std140) uniform finalViewMatrixBuffer {
-  mat4 modelViewProjection;
+uniform mat4 modelTransform;
+
+layout (std140) uniform cameraMatrixBuffer {
+  mat4 cameraMatrix;
 };
 
 out vec2 texCoord;
@@ -14,7 +16,7 @@ out vec4 colourTint;
 
 void main()
 {
-    gl_Position = vec4(vertexPosition, 1.0) * modelViewProjection;
-    texCoord = aTexCoord;
-    colourTint = aColourTint;
+    gl_Position = cameraMatrix * modelTransform * vec4(vertexPosition, 0.0, 1.0);
+    texCoord = vertexTexCoord;
+    colourTint = vertexColourTint;
 }
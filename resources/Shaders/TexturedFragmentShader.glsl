@@ -10,5 +10,18 @@ uniform sampler2D ourTexture;
 
 void main()
 {
+#ifdef UNPREMULTIPLY_ALPHA
+    // RenderLayer textures hold premultiplied colour, which has to be divided back out to blend like any other sprite.
+    vec4 texel = texture(ourTexture, texCoord);
+    fragColour = vec4(texel.rgb / max(texel.a, 0.001), texel.a) * colourTint;
+#else
     fragColour = texture(ourTexture, texCoord) * colourTint;
+#endif
+
+#ifdef ALPHA_CUTOUT
+    // Cutout sprites draw in the opaque pass with blending off, so the transparent texels have to be thrown away instead.
+    if (fragColour.a < 0.5) {
+        discard;
+    }
+#endif
 }
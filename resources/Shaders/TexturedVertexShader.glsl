@@ -2,11 +2,12 @@
 #version 300 es
 
 layout (location = 0) in vec3 vertexPosition;
-layout (location = 1) in vec2 aTexCoord;
-layout (location = 2) in vec4 aColourTint;
+layout (location = 1) in mat4 instanceTransform;
+layout (location = 5) in vec4 instanceUvRect;
+layout (location = 6) in vec4 instanceColourTint;
 
-layout (std140) uniform finalViewMatrixBuffer {
-  mat4 modelViewProjection;
+layout (std140) uniform cameraMatrixBuffer {
+  mat4 cameraMatrix;
 };
 
 out vec2 texCoord;
@@ -14,7 +15,7 @@ out vec4 colourTint;
 
 void main()
 {
-    gl_Position = vec4(vertexPosition, 1.0) * modelViewProjection;
-    texCoord = aTexCoord;
-    colourTint = aColourTint;
+    gl_Position = cameraMatrix * instanceTransform * vec4(vertexPosition, 1.0);
+    texCoord = instanceUvRect.xy + ((vertexPosition.xy + 0.5) * instanceUvRect.zw);
+    colourTint = instanceColourTint;
 }
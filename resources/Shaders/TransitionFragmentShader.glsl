@@ -0,0 +1,48 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+#version 300 es
+precision mediump float;
+out vec4 fragColour;
+
+in vec2 texCoord;
+
+uniform sampler2D incomingFrame;
+uniform sampler2D outgoingFrame;
+uniform sampler2D transitionMask;
+uniform float progress;
+uniform vec4 fadeColour;
+uniform float softness;
+uniform float maxBlurLevel;
+
+#ifdef BLUR
+vec4 sampleBlurred(sampler2D frame, float level)
+{
+    // Four taps half a texel apart on the chosen mip level smooth out the blockiness of sampling a small level on its own.
+    vec2 offset = exp2(level) * 0.5 / vec2(textureSize(frame, 0));
+    return 0.25 * (textureLod(frame, texCoord + vec2(-offset.x, -offset.y), level)
+        + textureLod(frame, texCoord + vec2(offset.x, -offset.y), level)
+        + textureLod(frame, texCoord + vec2(-offset.x, offset.y), level)
+        + textureLod(frame, texCoord + vec2(offset.x, offset.y), level));
+}
+#endif
+
+void main()
+{
+#if defined(FADE)
+    if (progress < 0.5) {
+        fragColour = mix(textureLod(outgoingFrame, texCoord, 0.0), fadeColour, progress * 2.0);
+    }
+    else {
+        fragColour = mix(fadeColour, textureLod(incomingFrame, texCoord, 0.0), (progress * 2.0) - 1.0);
+    }
+#elif defined(MASK_WIPE)
+    // Masks are images loaded top row first, whereas the captured frames start at the bottom.
+    float luminance = dot(texture(transitionMask, vec2(texCoord.x, 1.0 - texCoord.y)).rgb, vec3(0.299, 0.587, 0.114));
+    float amount = clamp(((progress * (1.0 + softness)) - luminance) / max(softness, 0.0001), 0.0, 1.0);
+    fragColour = mix(textureLod(outgoingFrame, texCoord, 0.0), textureLod(incomingFrame, texCoord, 0.0), amount);
+#elif defined(BLUR)
+    float level = maxBlurLevel * (1.0 - abs((progress * 2.0) - 1.0));
+    fragColour = mix(sampleBlurred(outgoingFrame, level), sampleBlurred(incomingFrame, level), progress);
+#else
+    fragColour = mix(textureLod(outgoingFrame, texCoord, 0.0), textureLod(incomingFrame, texCoord, 0.0), progress);
+#endif
+}
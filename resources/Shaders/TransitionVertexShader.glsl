@@ -0,0 +1,12 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+#version 300 es
+
+out vec2 texCoord;
+
+void main()
+{
+    // A single triangle that covers the whole screen, built from the vertex index so that no vertex buffer is needed.
+    vec2 corner = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));
+    gl_Position = vec4((corner * 2.0) - 1.0, 0.0, 1.0);
+    texCoord = corner;
+}
@@ -81,10 +81,25 @@ int main(int /*argc*/, char* /*argv*/[])
   idleState->shouldLoop() = true;
   auto idleFrames = std::vector<NovelRT::Animation::SpriteAnimatorFrame>();
 
+  //Every frame lives in one atlas, so changing frames only changes texture coordinates.
+  auto idleFrameFiles = std::vector<std::string>();
+  auto movingFrameFiles = std::vector<std::string>();
   for (int32_t i = 0; i < 10; i++) {
+    idleFrameFiles.push_back((imagesDirPath / "idle" / ("0-" + std::to_string(i) + ".png")).string());
+  }
+
+  for (int32_t i = 0; i < 5; i++) {
+    movingFrameFiles.push_back((imagesDirPath / "right" / ("100-" + std::to_string(i) + ".png")).string());
+  }
+
+  auto atlasFiles = idleFrameFiles;
+  atlasFiles.insert(atlasFiles.end(), movingFrameFiles.begin(), movingFrameFiles.end());
+  auto animAtlas = runner.getRenderer()->createSpriteAtlas(atlasFiles);
+
+  for (auto& frameFile : idleFrameFiles) {
     auto frame = NovelRT::Animation::SpriteAnimatorFrame();
     frame.duration() = NovelRT::Timing::Timestamp::fromSeconds(0.1f);
-    frame.texture() = runner.getRenderer()->getTexture((imagesDirPath / "idle" / ("0-" + std::to_string(i) + ".png")).string());
+    frame.region() = animAtlas->getRegion(frameFile);
     idleFrames.push_back(frame);
   }
 
@@ -100,10 +115,10 @@ int main(int /*argc*/, char* /*argv*/[])
 
   auto movingFrames = std::vector<NovelRT::Animation::SpriteAnimatorFrame>();
 
-  for (int32_t i = 0; i < 5; i++) {
+  for (auto& frameFile : movingFrameFiles) {
     auto frame = NovelRT::Animation::SpriteAnimatorFrame();
     frame.duration() = NovelRT::Timing::Timestamp::fromSeconds(0.1f);
-    frame.texture() = runner.getRenderer()->getTexture((imagesDirPath / "right" / ("100-" + std::to_string(i) + ".png")).string());
+    frame.region() = animAtlas->getRegion(frameFile);
     movingFrames.push_back(frame);
   }
 
@@ -20,7 +20,7 @@ namespace NovelRT::Animation {
           _currentState = _states.at(0);
 
           auto frame = _currentState->frames().at(_currentFrameIndex);
-          _rect->texture() = frame.texture();
+          _rect->setTextureRegion(frame.region());
           frame.FrameEnter();
         }
 
@@ -44,11 +44,17 @@ namespace NovelRT::Animation {
           }
 
           auto newFrame = _currentState->frames().at(_currentFrameIndex);
-          _rect->texture() = newFrame.texture();
+          _rect->setTextureRegion(newFrame.region());
           newFrame.FrameEnter();
         }
 
         _accumulatedDelta += delta;
+
+        //Nothing changes on screen between frames, so the runner would otherwise sleep straight through the next one.
+        if (_currentState->frames().size() > _currentFrameIndex) {
+          auto duration = _currentState->frames().at(_currentFrameIndex).duration();
+          _runner->requestUpdateWithin(duration > _accumulatedDelta ? duration - _accumulatedDelta : Timing::Timestamp::zero());
+        }
         break;
       }
 
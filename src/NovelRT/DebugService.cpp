@@ -65,10 +65,23 @@ namespace NovelRT {
     }
   }
 
+  uint32_t DebugService::getIssuedGLStateChanges() const {
+    return _renderingService->getGLStateCache().getLastFrameIssuedCallCount();
+  }
+
+  uint32_t DebugService::getElidedGLStateChanges() const {
+    return _renderingService->getGLStateCache().getLastFrameElidedCallCount();
+  }
+
+  uint64_t DebugService::getSkippedFrames() const {
+    return _renderingService->getSkippedFrameCount();
+  }
+
   void DebugService::updateFpsCounter() {
     if (_fpsCounter != nullptr) {
-      char fpsText[16];
-      snprintf(fpsText, 16, "%u fps", _framesPerSecond);
+      char fpsText[64];
+      snprintf(fpsText, 64, "%u fps, %u/%u GL state changes elided", _framesPerSecond, getElidedGLStateChanges(),
+        getIssuedGLStateChanges() + getElidedGLStateChanges());
       _fpsCounter->setText(fpsText);
     }
   }
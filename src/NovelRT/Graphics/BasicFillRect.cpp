@@ -3,52 +3,32 @@
 #include <NovelRT.h>
 
 namespace NovelRT::Graphics {
-
   BasicFillRect::BasicFillRect(Transform transform,
     int32_t layer,
     std::shared_ptr<Camera> camera,
     ShaderProgram shaderProgram,
+    std::shared_ptr<RenderingService> renderer,
     RGBAConfig fillColour) :
-    RenderObject(transform, layer, shaderProgram, camera), _colourConfig(fillColour),
-    _colourBuffer(Utilities::Lazy<GLuint>(generateStandardBuffer)) {}
+    RenderObject(transform, layer, shaderProgram, camera, renderer), _colourConfig(fillColour),
+    _colourData() {}
 
   void BasicFillRect::drawObject() {
     if (!getActive())
       return;
 
-    glUseProgram(_shaderProgram.shaderProgramId);
-
-    glBindBuffer(GL_UNIFORM_BUFFER, _shaderProgram.finalViewMatrixBufferUboId);
-    glBufferData(GL_UNIFORM_BUFFER, sizeof(Maths::GeoMatrix4x4F), &_finalViewMatrixData.getActual(), GL_STATIC_DRAW);
-
+    //Sprites queued before this rect have to reach the screen first, otherwise the batch would reorder them past us.
+    _renderer->getSpriteBatch().flush();
+    _renderer->getShapeBatch().submitQuad(_shaderProgram.shaderProgramId, getModelMatrix(), _colourData);
+  }
 
-    glBindVertexArray(_vertexArrayObject.getActual());
-    glEnableVertexAttribArray(0);
-    glBindBuffer(GL_ARRAY_BUFFER, _vertexBuffer.getActual());
-    glVertexAttribPointer(
-      0,
-      3,
-      GL_FLOAT,
-      GL_FALSE,
-      0,
-      nullptr
-    );
-    glEnableVertexAttribArray(1);
-    glBindBuffer(GL_ARRAY_BUFFER, _colourBuffer.getActual());
-    glVertexAttribPointer(
-      1,
-      4,
-      GL_FLOAT,
-      GL_FALSE,
-      0,
-      nullptr
-    );
+  void BasicFillRect::recordCommands(RenderCommandList& commands) {
+    if (!getActive()) return;
 
-    glDrawArrays(GL_TRIANGLES, 0, 6);
-    glDisableVertexAttribArray(1);
-    glDisableVertexAttribArray(0);
-    glBindVertexArray(0);
+    ShapeBatch::writeQuad(commands.addShapeVertices(_shaderProgram.shaderProgramId, 6), getModelMatrix(), _colourData);
+  }
 
+  bool BasicFillRect::isTranslucent() const noexcept {
+    return _colourConfig.getA() < 255;
   }
 
   RGBAConfig BasicFillRect::getColourConfig() const {
@@ -58,28 +38,10 @@ namespace NovelRT::Graphics {
   void BasicFillRect::setColourConfig(RGBAConfig value) {
     _colourConfig = value;
     configureObjectBuffers();
+    _isDirty = true;
   }
 
   void BasicFillRect::configureObjectBuffers() {
-    RenderObject::configureObjectBuffers();
-
-    auto config = getColourConfig();
-    auto rScalar = config.getRScalar();
-    auto gScalar = config.getGScalar();
-    auto bScalar = config.getBScalar();
-    auto aScalar = config.getAScalar();
-
-    _colourData = {
-        rScalar, gScalar, bScalar, aScalar,
-        rScalar, gScalar, bScalar, aScalar,
-        rScalar, gScalar, bScalar, aScalar,
-        rScalar, gScalar, bScalar, aScalar,
-        rScalar, gScalar, bScalar, aScalar,
-        rScalar, gScalar, bScalar, aScalar,
-    };
-
-    auto colourBuffer = _colourBuffer.getActual();
-    glBindBuffer(GL_ARRAY_BUFFER, colourBuffer);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * _colourData.size(), _colourData.data(), GL_STATIC_DRAW);
+    _colourData = ShapeVertex::packColour(getColourConfig());
   }
 }
@@ -43,6 +43,26 @@ namespace NovelRT::Graphics {
     return getProjectionMatrix() * getViewMatrix();
   }
 
+  Maths::GeoBounds Camera::getVisibleBounds() {
+    auto cameraMatrix = getCameraUboMatrix();
+    auto inverseMatrix = glm::inverse(*reinterpret_cast<glm::mat4*>(&cameraMatrix));
+
+    auto minimum = glm::vec2(std::numeric_limits<float>::max());
+    auto maximum = glm::vec2(std::numeric_limits<float>::lowest());
+
+    //Both the near and far corners are used so that the result also holds for perspective cameras.
+    for (int32_t i = 0; i < 8; i++) {
+      auto corner = inverseMatrix * glm::vec4((i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f, (i & 4) ? 1.0f : -1.0f, 1.0f);
+      auto worldCorner = glm::vec2(corner.x, corner.y) / corner.w;
+      minimum = glm::min(minimum, worldCorner);
+      maximum = glm::max(maximum, worldCorner);
+    }
+
+    auto size = maximum - minimum;
+    auto centre = minimum + (size / 2.0f);
+    return Maths::GeoBounds(Maths::GeoVector2F(centre.x, centre.y), Maths::GeoVector2F(size.x, size.y), 0.0f);
+  }
+
   void Camera::initialiseCameraForFrame() {
     switch (_cameraFrameState) {
       case CameraFrameState::ModifiedInCurrent:
@@ -0,0 +1,220 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  static const float CURVE_TOLERANCE = 0.25f;
+  static const float MINIMUM_SEGMENTS_PER_TURN = 8.0f;
+  static const float MAXIMUM_SEGMENTS_PER_TURN = 256.0f;
+  static const float MAXIMUM_MITER_RATIO = 4.0f;
+  static const float PI = 3.14159265f;
+
+  static inline float dot(Maths::GeoVector2F first, Maths::GeoVector2F second) noexcept {
+    return (first.x * second.x) + (first.y * second.y);
+  }
+
+  Canvas2D::Canvas2D(int32_t layer, ShaderProgram shaderProgram, std::shared_ptr<Camera> camera, std::shared_ptr<RenderingService> renderer) :
+    RenderObject(Transform(), layer, shaderProgram, camera, renderer),
+    _vertices(),
+    _minimum(Maths::GeoVector2F::zero()),
+    _maximum(Maths::GeoVector2F::zero()) {}
+
+  uint32_t Canvas2D::getCurveSegmentCount(float radius, float angle) noexcept {
+    auto turns = std::abs(angle) / (2.0f * PI);
+    auto minimum = std::max(1.0f, std::ceil(turns * MINIMUM_SEGMENTS_PER_TURN));
+    if (radius <= CURVE_TOLERANCE) return static_cast<uint32_t>(minimum);
+
+    //A chord strays furthest from its arc at its middle, by r(1 - cos(step / 2)), so this is the widest step within the tolerance.
+    auto step = 2.0f * std::acos(1.0f - (CURVE_TOLERANCE / radius));
+    auto count = std::ceil(std::abs(angle) / step);
+    return static_cast<uint32_t>(std::clamp(count, minimum, std::max(minimum, std::ceil(turns * MAXIMUM_SEGMENTS_PER_TURN))));
+  }
+
+  void Canvas2D::addTriangle(Maths::GeoVector2F first, Maths::GeoVector2F second, Maths::GeoVector2F third, std::array<uint8_t, 4> colour) {
+    if (_vertices.empty()) {
+      _minimum = first;
+      _maximum = first;
+    }
+
+    for (auto point : { first, second, third }) {
+      _minimum = Maths::GeoVector2F(std::min(_minimum.x, point.x), std::min(_minimum.y, point.y));
+      _maximum = Maths::GeoVector2F(std::max(_maximum.x, point.x), std::max(_maximum.y, point.y));
+      _vertices.push_back(ShapeVertex{Maths::GeoVector3F(point), colour});
+    }
+  }
+
+  void Canvas2D::addQuad(Maths::GeoVector2F first, Maths::GeoVector2F second, Maths::GeoVector2F third, Maths::GeoVector2F fourth, std::array<uint8_t, 4> colour) {
+    addTriangle(first, second, third, colour);
+    addTriangle(first, third, fourth, colour);
+  }
+
+  void Canvas2D::addFan(Maths::GeoVector2F centre, const std::vector<Maths::GeoVector2F>& outline, std::array<uint8_t, 4> colour) {
+    _vertices.reserve(_vertices.size() + (outline.size() * 3));
+    for (size_t i = 0; i < outline.size(); i++) {
+      addTriangle(centre, outline[i], outline[(i + 1) % outline.size()], colour);
+    }
+  }
+
+  void Canvas2D::drawRect(Maths::GeoVector2F position, Maths::GeoVector2F size, RGBAConfig colour) {
+    auto extents = size / 2.0f;
+    addQuad(Maths::GeoVector2F(position.x - extents.x, position.y - extents.y),
+      Maths::GeoVector2F(position.x + extents.x, position.y - extents.y),
+      Maths::GeoVector2F(position.x + extents.x, position.y + extents.y),
+      Maths::GeoVector2F(position.x - extents.x, position.y + extents.y),
+      ShapeVertex::packColour(colour));
+    _isDirty = true;
+  }
+
+  void Canvas2D::drawRoundedRect(Maths::GeoVector2F position, Maths::GeoVector2F size, float cornerRadius, RGBAConfig colour) {
+    auto extents = size / 2.0f;
+    auto radius = std::min(cornerRadius, std::min(std::abs(extents.x), std::abs(extents.y)));
+    if (radius <= 0.0f) {
+      drawRect(position, size, colour);
+      return;
+    }
+
+    //Each corner turns a quarter, starting with the one whose arc begins at angle zero and working round. The shape stays convex,
+    //so it can be filled as a fan from its centre.
+    static const float cornerSigns[4][2] = { { 1.0f, 1.0f }, { -1.0f, 1.0f }, { -1.0f, -1.0f }, { 1.0f, -1.0f } };
+    auto segments = getCurveSegmentCount(radius, PI / 2.0f);
+
+    std::vector<Maths::GeoVector2F> outline;
+    outline.reserve(4 * (segments + 1));
+    for (uint32_t corner = 0; corner < 4; corner++) {
+      auto centre = position + Maths::GeoVector2F(cornerSigns[corner][0] * (extents.x - radius), cornerSigns[corner][1] * (extents.y - radius));
+      for (uint32_t i = 0; i <= segments; i++) {
+        auto angle = (static_cast<float>(corner) + (static_cast<float>(i) / static_cast<float>(segments))) * (PI / 2.0f);
+        outline.emplace_back(centre.x + (std::cos(angle) * radius), centre.y + (std::sin(angle) * radius));
+      }
+    }
+
+    addFan(position, outline, ShapeVertex::packColour(colour));
+    _isDirty = true;
+  }
+
+  void Canvas2D::drawCircle(Maths::GeoVector2F centre, float radius, RGBAConfig colour) {
+    if (radius <= 0.0f) return;
+
+    auto segments = getCurveSegmentCount(radius, 2.0f * PI);
+    std::vector<Maths::GeoVector2F> outline;
+    outline.reserve(segments);
+    for (uint32_t i = 0; i < segments; i++) {
+      auto angle = (static_cast<float>(i) / static_cast<float>(segments)) * 2.0f * PI;
+      outline.emplace_back(centre.x + (std::cos(angle) * radius), centre.y + (std::sin(angle) * radius));
+    }
+
+    addFan(centre, outline, ShapeVertex::packColour(colour));
+    _isDirty = true;
+  }
+
+  void Canvas2D::drawLine(Maths::GeoVector2F start, Maths::GeoVector2F end, float thickness, RGBAConfig colour) {
+    auto direction = end - start;
+    if (thickness <= 0.0f || direction == Maths::GeoVector2F::zero()) return;
+
+    direction = direction.getNormalised();
+    auto offset = Maths::GeoVector2F(-direction.y, direction.x) * (thickness / 2.0f);
+    addQuad(start + offset, end + offset, end - offset, start - offset, ShapeVertex::packColour(colour));
+    _isDirty = true;
+  }
+
+  void Canvas2D::drawPolyline(const std::vector<Maths::GeoVector2F>& points, float thickness, RGBAConfig colour, bool isClosed) {
+    if (thickness <= 0.0f) return;
+
+    //A repeated point has no direction to offset the line from.
+    std::vector<Maths::GeoVector2F> path;
+    path.reserve(points.size());
+    for (auto point : points) {
+      if (path.empty() || path.back() != point) {
+        path.push_back(point);
+      }
+    }
+
+    if (isClosed && path.size() > 1 && path.back() == path.front()) {
+      path.pop_back();
+    }
+
+    if (path.size() < 2) return;
+
+    //Closing a single segment back on itself would only draw it twice.
+    isClosed = isClosed && path.size() > 2;
+    auto pointCount = path.size();
+    auto segmentCount = isClosed ? pointCount : pointCount - 1;
+    auto halfThickness = thickness / 2.0f;
+
+    std::vector<Maths::GeoVector2F> normals(segmentCount);
+    for (size_t i = 0; i < segmentCount; i++) {
+      auto direction = (path[(i + 1) % pointCount] - path[i]).getNormalised();
+      normals[i] = Maths::GeoVector2F(-direction.y, direction.x);
+    }
+
+    std::vector<Maths::GeoVector2F> offsets(pointCount);
+    for (size_t i = 0; i < pointCount; i++) {
+      if (!isClosed && (i == 0 || i == pointCount - 1)) {
+        offsets[i] = normals[i == 0 ? 0 : segmentCount - 1] * halfThickness;
+        continue;
+      }
+
+      auto previous = normals[(i + segmentCount - 1) % segmentCount];
+      auto next = normals[i % segmentCount];
+      auto miter = previous + next;
+      auto miterLength = miter.getMagnitude();
+      if (miterLength < 0.0001f) {
+        //The line doubles straight back on itself, so there is no corner to mitre.
+        offsets[i] = next * halfThickness;
+        continue;
+      }
+
+      miter = miter / miterLength;
+      offsets[i] = miter * (halfThickness / std::max(dot(miter, next), 1.0f / MAXIMUM_MITER_RATIO));
+    }
+
+    auto packedColour = ShapeVertex::packColour(colour);
+    _vertices.reserve(_vertices.size() + (segmentCount * 6));
+    for (size_t i = 0; i < segmentCount; i++) {
+      auto j = (i + 1) % pointCount;
+      addQuad(path[i] + offsets[i], path[j] + offsets[j], path[j] - offsets[j], path[i] - offsets[i], packedColour);
+    }
+
+    _isDirty = true;
+  }
+
+  void Canvas2D::clear() noexcept {
+    if (_vertices.empty()) return;
+
+    _vertices.clear();
+    _isDirty = true;
+  }
+
+  void Canvas2D::configureObjectBuffers() {
+    //The triangles are built as each shape is drawn, so there is nothing left to do here.
+  }
+
+  void Canvas2D::drawObject() {
+    if (!getActive() || _vertices.empty()) return;
+
+    //Sprites queued before this canvas have to reach the screen first, otherwise the batch would reorder them past us.
+    _renderer->getSpriteBatch().flush();
+    _renderer->getShapeBatch().submit(_shaderProgram.shaderProgramId, _vertices, static_cast<float>(layer()));
+  }
+
+  void Canvas2D::recordCommands(RenderCommandList& commands) {
+    if (!getActive() || _vertices.empty()) return;
+
+    auto depth = static_cast<float>(layer());
+    auto target = commands.addShapeVertices(_shaderProgram.shaderProgramId, _vertices.size());
+    for (const auto& vertex : _vertices) {
+      *target = vertex;
+      target->position.z = depth;
+      target++;
+    }
+  }
+
+  bool Canvas2D::isTranslucent() const noexcept {
+    //Shapes on a canvas share its layer, so only drawing them in order with depth writes off lets later ones cover earlier ones.
+    return true;
+  }
+
+  Maths::GeoBounds Canvas2D::getCullingBounds() const {
+    return getBounds();
+  }
+}
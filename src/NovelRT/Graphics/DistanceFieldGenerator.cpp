@@ -0,0 +1,108 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  static const float INFINITE_DISTANCE = 1e20f;
+
+  //One pass of Felzenszwalb and Huttenlocher's squared distance transform, run over a single row or column.
+  //Every sample's squared distance becomes the smallest of (distance to another sample squared + that sample's value).
+  static void transformLine(std::vector<float>& grid, size_t offset, size_t stride, size_t length,
+    std::vector<float>& values, std::vector<size_t>& parabolas, std::vector<float>& boundaries) {
+    for (size_t i = 0; i < length; i++) {
+      values[i] = grid[offset + i * stride];
+    }
+
+    parabolas[0] = 0;
+    boundaries[0] = -INFINITE_DISTANCE;
+    boundaries[1] = INFINITE_DISTANCE;
+
+    size_t lastParabola = 0;
+    for (size_t q = 1; q < length; q++) {
+      float intersection;
+      while (true) {
+        auto vertex = parabolas[lastParabola];
+        auto q2 = static_cast<float>(q * q);
+        auto v2 = static_cast<float>(vertex * vertex);
+        intersection = ((values[q] + q2) - (values[vertex] + v2)) / (2.0f * (static_cast<float>(q) - static_cast<float>(vertex)));
+
+        //The first boundary is -infinity, so the walk back always stops at the first parabola.
+        if (intersection > boundaries[lastParabola] || lastParabola == 0) break;
+
+        lastParabola--;
+      }
+
+      lastParabola++;
+      parabolas[lastParabola] = q;
+      boundaries[lastParabola] = intersection;
+      boundaries[lastParabola + 1] = INFINITE_DISTANCE;
+    }
+
+    size_t parabola = 0;
+    for (size_t q = 0; q < length; q++) {
+      while (boundaries[parabola + 1] < static_cast<float>(q)) {
+        parabola++;
+      }
+
+      auto vertex = parabolas[parabola];
+      auto distance = static_cast<float>(q) - static_cast<float>(vertex);
+      grid[offset + q * stride] = distance * distance + values[vertex];
+    }
+  }
+
+  static void transformGrid(std::vector<float>& grid, size_t width, size_t height) {
+    auto longestSide = std::max(width, height);
+    std::vector<float> values(longestSide);
+    std::vector<size_t> parabolas(longestSide);
+    std::vector<float> boundaries(longestSide + 1);
+
+    for (size_t x = 0; x < width; x++) {
+      transformLine(grid, x, width, height, values, parabolas, boundaries);
+    }
+
+    for (size_t y = 0; y < height; y++) {
+      transformLine(grid, y * width, 1, width, values, parabolas, boundaries);
+    }
+  }
+
+  std::vector<uint8_t> DistanceFieldGenerator::generate(const uint8_t* coverage, uint32_t width, uint32_t height, uint32_t spread) {
+    auto fieldWidth = static_cast<size_t>(width) + spread * 2;
+    auto fieldHeight = static_cast<size_t>(height) + spread * 2;
+    auto fieldSize = fieldWidth * fieldHeight;
+
+    //Squared distances to the nearest inside and outside pixel. Partly covered pixels start part way to the edge, which is
+    //what lets the field place the edge between pixels instead of snapping it to them.
+    std::vector<float> outside(fieldSize, INFINITE_DISTANCE);
+    std::vector<float> inside(fieldSize, 0.0f);
+
+    for (uint32_t y = 0; y < height; y++) {
+      for (uint32_t x = 0; x < width; x++) {
+        auto alpha = coverage[static_cast<size_t>(y) * width + x] / 255.0f;
+        auto index = (static_cast<size_t>(y) + spread) * fieldWidth + x + spread;
+
+        if (alpha >= 1.0f) {
+          outside[index] = 0.0f;
+          inside[index] = INFINITE_DISTANCE;
+        }
+        else if (alpha > 0.0f) {
+          auto edgeOffset = 0.5f - alpha;
+          outside[index] = edgeOffset > 0.0f ? edgeOffset * edgeOffset : 0.0f;
+          inside[index] = edgeOffset < 0.0f ? edgeOffset * edgeOffset : 0.0f;
+        }
+      }
+    }
+
+    transformGrid(outside, fieldWidth, fieldHeight);
+    transformGrid(inside, fieldWidth, fieldHeight);
+
+    std::vector<uint8_t> field(fieldSize);
+    auto range = static_cast<float>(std::max<uint32_t>(spread, 1)) * 2.0f;
+    for (size_t i = 0; i < fieldSize; i++) {
+      auto signedDistance = std::sqrt(outside[i]) - std::sqrt(inside[i]);
+      auto value = std::clamp(0.5f - (signedDistance / range), 0.0f, 1.0f);
+      field[i] = static_cast<uint8_t>(std::lround(value * 255.0f));
+    }
+
+    return field;
+  }
+}
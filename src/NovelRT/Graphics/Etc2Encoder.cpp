@@ -0,0 +1,324 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  //Intensity modifiers for colour blocks, from the ETC2 specification. A pixel adds the small or large value, or subtracts it.
+  static const int32_t COLOUR_MODIFIER_TABLES[8][2] = {
+    {2, 8}, {5, 17}, {9, 29}, {13, 42}, {18, 60}, {24, 80}, {33, 106}, {47, 183}
+  };
+
+  //Modifiers for EAC alpha blocks, from the ETC2 specification. These are scaled by the block's multiplier.
+  static const int32_t ALPHA_MODIFIER_TABLES[16][8] = {
+    {-3, -6, -9, -15, 2, 5, 8, 14},
+    {-3, -7, -10, -13, 2, 6, 9, 12},
+    {-2, -5, -8, -13, 1, 4, 7, 12},
+    {-2, -4, -6, -13, 1, 3, 5, 12},
+    {-3, -6, -8, -12, 2, 5, 7, 11},
+    {-3, -7, -9, -11, 2, 6, 8, 10},
+    {-4, -7, -8, -11, 3, 6, 7, 10},
+    {-3, -5, -8, -11, 2, 4, 7, 10},
+    {-2, -6, -8, -10, 1, 5, 7, 9},
+    {-2, -5, -8, -10, 1, 4, 7, 9},
+    {-2, -4, -8, -10, 1, 3, 7, 9},
+    {-2, -5, -7, -10, 1, 4, 6, 9},
+    {-3, -4, -7, -10, 2, 3, 6, 9},
+    {-1, -2, -3, -10, 0, 1, 2, 9},
+    {-4, -6, -8, -9, 3, 5, 7, 8},
+    {-3, -5, -7, -9, 2, 4, 6, 8}
+  };
+
+  //Table 13 holds the only zero modifier, which lets a block of one alpha value come out exactly.
+  static const uint32_t ZERO_ALPHA_MODIFIER_TABLE = 13;
+  static const uint32_t ZERO_ALPHA_MODIFIER_INDEX = 4;
+
+  static const size_t PIXELS_PER_BLOCK = Etc2Encoder::BlockDimension * Etc2Encoder::BlockDimension;
+
+  struct SubblockFit {
+    uint32_t error;
+    uint64_t table;
+  };
+
+  static inline int32_t clampByte(int32_t value) noexcept {
+    return std::clamp(value, 0, 255);
+  }
+
+  static inline int32_t quantise(int32_t value, int32_t maximum) noexcept {
+    return (value * maximum + 127) / 255;
+  }
+
+  static inline int32_t getColourModifier(uint64_t table, uint32_t index) noexcept {
+    auto magnitude = COLOUR_MODIFIER_TABLES[table][index & 1];
+    return (index & 2) != 0 ? -magnitude : magnitude;
+  }
+
+  //Blocks number their pixels down each column in turn, so pixel (x, y) is pixel x * 4 + y.
+  static void gatherBlock(const uint8_t* pixels, size_t rowStride, uint8_t (&blockPixels)[PIXELS_PER_BLOCK][RgbaImage::BytesPerPixel]) noexcept {
+    for (uint32_t y = 0; y < Etc2Encoder::BlockDimension; y++) {
+      for (uint32_t x = 0; x < Etc2Encoder::BlockDimension; x++) {
+        std::memcpy(blockPixels[x * Etc2Encoder::BlockDimension + y], pixels + y * rowStride + x * RgbaImage::BytesPerPixel, RgbaImage::BytesPerPixel);
+      }
+    }
+  }
+
+  static void writeBigEndian(uint64_t bits, uint8_t* block) noexcept {
+    for (int32_t i = 7; i >= 0; i--) {
+      block[i] = static_cast<uint8_t>(bits & 0xFF);
+      bits >>= 8;
+    }
+  }
+
+  //Picks the table that best fits the pixels of one subblock around a base colour, along with each pixel's modifier in it.
+  static SubblockFit fitSubblock(const uint8_t (&blockPixels)[PIXELS_PER_BLOCK][RgbaImage::BytesPerPixel], const uint32_t (&members)[8],
+    const int32_t (&base)[3], uint32_t (&indices)[PIXELS_PER_BLOCK]) noexcept {
+    SubblockFit best{std::numeric_limits<uint32_t>::max(), 0};
+    uint32_t candidateIndices[8];
+
+    for (uint64_t table = 0; table < 8; table++) {
+      uint32_t error = 0;
+      for (uint32_t i = 0; i < 8 && error < best.error; i++) {
+        auto pixel = blockPixels[members[i]];
+        auto bestPixelError = std::numeric_limits<uint32_t>::max();
+
+        for (uint32_t index = 0; index < 4; index++) {
+          auto modifier = getColourModifier(table, index);
+          uint32_t pixelError = 0;
+          for (uint32_t channel = 0; channel < 3; channel++) {
+            auto difference = clampByte(base[channel] + modifier) - static_cast<int32_t>(pixel[channel]);
+            pixelError += static_cast<uint32_t>(difference * difference);
+          }
+
+          if (pixelError < bestPixelError) {
+            bestPixelError = pixelError;
+            candidateIndices[i] = index;
+          }
+        }
+
+        error += bestPixelError;
+      }
+
+      if (error < best.error) {
+        best = SubblockFit{error, table};
+        for (uint32_t i = 0; i < 8; i++) {
+          indices[members[i]] = candidateIndices[i];
+        }
+      }
+    }
+
+    return best;
+  }
+
+  static uint64_t packColourIndices(const uint32_t (&indices)[PIXELS_PER_BLOCK]) noexcept {
+    uint64_t bits = 0;
+    for (uint32_t i = 0; i < PIXELS_PER_BLOCK; i++) {
+      bits |= static_cast<uint64_t>((indices[i] >> 1) & 1) << (16 + i);
+      bits |= static_cast<uint64_t>(indices[i] & 1) << i;
+    }
+
+    return bits;
+  }
+
+  void Etc2Encoder::encodeRgb8Block(const uint8_t* pixels, size_t rowStride, uint8_t* block) noexcept {
+    uint8_t blockPixels[PIXELS_PER_BLOCK][RgbaImage::BytesPerPixel];
+    gatherBlock(pixels, rowStride, blockPixels);
+
+    uint64_t bestBits = 0;
+    auto bestError = std::numeric_limits<uint32_t>::max();
+
+    //Unflipped blocks are split into left and right halves, flipped ones into top and bottom halves.
+    for (uint64_t flip = 0; flip < 2; flip++) {
+      uint32_t members[2][8];
+      uint32_t memberCounts[2] = {0, 0};
+      int32_t averages[2][3] = {{0, 0, 0}, {0, 0, 0}};
+
+      for (uint32_t i = 0; i < PIXELS_PER_BLOCK; i++) {
+        auto x = i / BlockDimension;
+        auto y = i % BlockDimension;
+        auto subblock = (flip != 0 ? y : x) >= 2 ? 1 : 0;
+        members[subblock][memberCounts[subblock]++] = i;
+
+        for (uint32_t channel = 0; channel < 3; channel++) {
+          averages[subblock][channel] += blockPixels[i][channel];
+        }
+      }
+
+      for (auto& average : averages) {
+        for (auto& channel : average) {
+          channel = (channel + 4) / 8;
+        }
+      }
+
+      uint32_t indices[PIXELS_PER_BLOCK];
+
+      //Individual mode stores each half's base colour in 4 bits per channel.
+      {
+        int32_t quantised[2][3];
+        int32_t bases[2][3];
+        for (uint32_t subblock = 0; subblock < 2; subblock++) {
+          for (uint32_t channel = 0; channel < 3; channel++) {
+            quantised[subblock][channel] = quantise(averages[subblock][channel], 15);
+            bases[subblock][channel] = (quantised[subblock][channel] << 4) | quantised[subblock][channel];
+          }
+        }
+
+        auto first = fitSubblock(blockPixels, members[0], bases[0], indices);
+        auto second = fitSubblock(blockPixels, members[1], bases[1], indices);
+        if (first.error + second.error < bestError) {
+          bestError = first.error + second.error;
+          bestBits = 0;
+          for (uint32_t channel = 0; channel < 3; channel++) {
+            bestBits |= static_cast<uint64_t>(quantised[0][channel]) << (60 - channel * 8);
+            bestBits |= static_cast<uint64_t>(quantised[1][channel]) << (56 - channel * 8);
+          }
+
+          bestBits |= (first.table << 37) | (second.table << 34) | (flip << 32) | packColourIndices(indices);
+        }
+      }
+
+      //Differential mode stores the first base colour in 5 bits per channel and the second as a 3 bit offset from it.
+      //Offsets that would leave the 0 to 31 range select the ETC2-only modes instead, so those halves are never stored this way.
+      {
+        int32_t quantised[2][3];
+        int32_t bases[2][3];
+        auto isRepresentable = true;
+        for (uint32_t subblock = 0; subblock < 2; subblock++) {
+          for (uint32_t channel = 0; channel < 3; channel++) {
+            quantised[subblock][channel] = quantise(averages[subblock][channel], 31);
+            bases[subblock][channel] = (quantised[subblock][channel] << 3) | (quantised[subblock][channel] >> 2);
+          }
+        }
+
+        for (uint32_t channel = 0; channel < 3; channel++) {
+          auto offset = quantised[1][channel] - quantised[0][channel];
+          isRepresentable = isRepresentable && offset >= -4 && offset <= 3;
+        }
+
+        if (isRepresentable) {
+          auto first = fitSubblock(blockPixels, members[0], bases[0], indices);
+          auto second = fitSubblock(blockPixels, members[1], bases[1], indices);
+          if (first.error + second.error < bestError) {
+            bestError = first.error + second.error;
+            bestBits = 0;
+            for (uint32_t channel = 0; channel < 3; channel++) {
+              auto offset = quantised[1][channel] - quantised[0][channel];
+              bestBits |= static_cast<uint64_t>(quantised[0][channel]) << (59 - channel * 8);
+              bestBits |= static_cast<uint64_t>(offset & 0x7) << (56 - channel * 8);
+            }
+
+            bestBits |= (first.table << 37) | (second.table << 34) | (1ull << 33) | (flip << 32) | packColourIndices(indices);
+          }
+        }
+      }
+    }
+
+    writeBigEndian(bestBits, block);
+  }
+
+  void Etc2Encoder::encodeAlphaBlock(const uint8_t* pixels, size_t rowStride, uint8_t* block) noexcept {
+    uint8_t blockPixels[PIXELS_PER_BLOCK][RgbaImage::BytesPerPixel];
+    gatherBlock(pixels, rowStride, blockPixels);
+
+    int32_t lowest = 255;
+    int32_t highest = 0;
+    for (auto& pixel : blockPixels) {
+      lowest = std::min(lowest, static_cast<int32_t>(pixel[3]));
+      highest = std::max(highest, static_cast<int32_t>(pixel[3]));
+    }
+
+    uint64_t bestBase = static_cast<uint64_t>(lowest);
+    uint64_t bestMultiplier = 1;
+    uint64_t bestTable = ZERO_ALPHA_MODIFIER_TABLE;
+    uint32_t bestIndices[PIXELS_PER_BLOCK];
+    std::fill(std::begin(bestIndices), std::end(bestIndices), ZERO_ALPHA_MODIFIER_INDEX);
+
+    if (lowest != highest) {
+      auto bestError = std::numeric_limits<uint32_t>::max();
+      uint32_t indices[PIXELS_PER_BLOCK];
+
+      //Only try the multipliers and base values that stretch each table most closely over the block's range of alpha.
+      for (uint64_t table = 0; table < 16; table++) {
+        auto lowestModifier = ALPHA_MODIFIER_TABLES[table][3];
+        auto highestModifier = ALPHA_MODIFIER_TABLES[table][7];
+        auto idealMultiplier = static_cast<int32_t>(static_cast<float>(highest - lowest) / static_cast<float>(highestModifier - lowestModifier));
+
+        for (auto multiplier = std::max(idealMultiplier, 1); multiplier <= std::min(idealMultiplier + 1, 15); multiplier++) {
+          auto idealBase = static_cast<int32_t>(std::lround((lowest + highest) / 2.0f - static_cast<float>((lowestModifier + highestModifier) * multiplier) / 2.0f));
+
+          for (auto base = std::max(idealBase - 1, 0); base <= std::min(idealBase + 1, 255); base++) {
+            uint32_t error = 0;
+            for (uint32_t i = 0; i < PIXELS_PER_BLOCK && error < bestError; i++) {
+              auto bestPixelError = std::numeric_limits<uint32_t>::max();
+              for (uint32_t index = 0; index < 8; index++) {
+                auto difference = clampByte(base + ALPHA_MODIFIER_TABLES[table][index] * multiplier) - static_cast<int32_t>(blockPixels[i][3]);
+                auto pixelError = static_cast<uint32_t>(difference * difference);
+                if (pixelError < bestPixelError) {
+                  bestPixelError = pixelError;
+                  indices[i] = index;
+                }
+              }
+
+              error += bestPixelError;
+            }
+
+            if (error < bestError) {
+              bestError = error;
+              bestBase = static_cast<uint64_t>(base);
+              bestMultiplier = static_cast<uint64_t>(multiplier);
+              bestTable = table;
+              std::copy(std::begin(indices), std::end(indices), std::begin(bestIndices));
+            }
+          }
+        }
+      }
+    }
+
+    auto bits = (bestBase << 56) | (bestMultiplier << 52) | (bestTable << 48);
+    for (uint32_t i = 0; i < PIXELS_PER_BLOCK; i++) {
+      bits |= static_cast<uint64_t>(bestIndices[i]) << (45 - i * 3);
+    }
+
+    writeBigEndian(bits, block);
+  }
+
+  static std::vector<uint8_t> encodeImage(const RgbaImage& image, bool hasAlpha) {
+    std::vector<uint8_t> result(Etc2Encoder::getEncodedSize(image.width, image.height, hasAlpha));
+    uint8_t blockPixels[PIXELS_PER_BLOCK * RgbaImage::BytesPerPixel];
+    auto rowStride = Etc2Encoder::BlockDimension * RgbaImage::BytesPerPixel;
+    auto output = result.data();
+
+    for (uint32_t blockY = 0; blockY < image.height; blockY += Etc2Encoder::BlockDimension) {
+      for (uint32_t blockX = 0; blockX < image.width; blockX += Etc2Encoder::BlockDimension) {
+        for (uint32_t y = 0; y < Etc2Encoder::BlockDimension; y++) {
+          for (uint32_t x = 0; x < Etc2Encoder::BlockDimension; x++) {
+            auto pixel = image.getPixel(std::min(blockX + x, image.width - 1), std::min(blockY + y, image.height - 1));
+            std::memcpy(blockPixels + y * rowStride + x * RgbaImage::BytesPerPixel, pixel, RgbaImage::BytesPerPixel);
+          }
+        }
+
+        //RGBA8 blocks are the alpha block followed by an ordinary RGB8 block.
+        if (hasAlpha) {
+          Etc2Encoder::encodeAlphaBlock(blockPixels, rowStride, output);
+          output += Etc2Encoder::Rgba8BlockSize - Etc2Encoder::Rgb8BlockSize;
+        }
+
+        Etc2Encoder::encodeRgb8Block(blockPixels, rowStride, output);
+        output += Etc2Encoder::Rgb8BlockSize;
+      }
+    }
+
+    return result;
+  }
+
+  std::vector<uint8_t> Etc2Encoder::encodeRgb8(const RgbaImage& image) {
+    return encodeImage(image, false);
+  }
+
+  std::vector<uint8_t> Etc2Encoder::encodeRgba8(const RgbaImage& image) {
+    return encodeImage(image, true);
+  }
+
+  size_t Etc2Encoder::getEncodedSize(uint32_t width, uint32_t height, bool hasAlpha) noexcept {
+    auto blockCount = static_cast<size_t>((width + BlockDimension - 1) / BlockDimension) * ((height + BlockDimension - 1) / BlockDimension);
+    return blockCount * (hasAlpha ? Rgba8BlockSize : Rgb8BlockSize);
+  }
+}
@@ -0,0 +1,117 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  FontLibrary::FontLibrary() :
+    _library(nullptr),
+    _libraryMutex(),
+    _mappedFiles(),
+    _logger(Utilities::Misc::CONSOLE_LOG_GFX) {
+    if (FT_Init_FreeType(&_library)) {
+      _logger.logError("Failed to initialise Freetype.");
+      throw Exceptions::InitialisationFailureException("Unable to continue! Freetype could not be initialised.");
+    }
+  }
+
+  std::shared_ptr<Utilities::MemoryMappedFile> FontLibrary::getMappedFile(const std::string& file) {
+    auto mappedFile = _mappedFiles.tryGet(file);
+    if (mappedFile != nullptr) return mappedFile;
+
+    mappedFile = std::make_shared<Utilities::MemoryMappedFile>(file);
+    _mappedFiles.insert(file, mappedFile);
+    return mappedFile;
+  }
+
+  std::shared_ptr<FT_FaceRec_> FontLibrary::createFace(const std::string& file, uint32_t pixelSize) {
+    //FreeType only allows one thread at a time to create or destroy faces from the same library.
+    std::scoped_lock<std::mutex> lock(_libraryMutex);
+
+    auto mappedFile = getMappedFile(file);
+    FT_Face face = nullptr;
+    if (FT_New_Memory_Face(_library, mappedFile->getData(), static_cast<FT_Long>(mappedFile->getSize()), 0, &face)) {
+      _logger.logError("FREETYPE - Failed to load font: {}", file);
+      throw Exceptions::IOException(file, "Unable to continue! Freetype could not read a font from the file.");
+    }
+
+    FT_Set_Pixel_Sizes(face, 0, static_cast<FT_UInt>(pixelSize));
+
+    //The face reads straight out of the mapping, so the deleter keeps both the mapping and this library alive until it is done.
+    auto library = shared_from_this();
+    return std::shared_ptr<FT_FaceRec_>(face, [library, mappedFile](FT_Face target) {
+      std::scoped_lock<std::mutex> deleterLock(library->_libraryMutex);
+      FT_Done_Face(target);
+    });
+  }
+
+  std::vector<RasterisedGlyph> FontLibrary::rasteriseGlyphs(const std::string& file, uint32_t pixelSize, const std::vector<char32_t>& codepoints,
+    uint32_t distanceFieldSpread) {
+    std::vector<RasterisedGlyph> glyphs(codepoints.size());
+    if (codepoints.empty()) return glyphs;
+
+    //A face costs a parse of the font's tables, so only go wide when there are enough glyphs to pay for it.
+    auto hardwareThreads = std::max<size_t>(static_cast<size_t>(std::thread::hardware_concurrency()), 1);
+    auto rasteriserCount = std::min({hardwareThreads, MaximumRasteriserCount, (codepoints.size() + 31) / 32});
+
+    //Open every face up front, so that a bad file is reported here instead of on a worker.
+    std::vector<std::shared_ptr<FT_FaceRec_>> faces;
+    for (size_t i = 0; i < rasteriserCount; i++) {
+      faces.push_back(createFace(file, pixelSize));
+    }
+
+    auto rasterise = [&](size_t rasteriserIndex) {
+      auto face = faces[rasteriserIndex].get();
+      for (size_t i = rasteriserIndex; i < codepoints.size(); i += rasteriserCount) {
+        glyphs[i].isSuccessful = tryRasteriseGlyph(face, codepoints[i], glyphs[i], distanceFieldSpread);
+      }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < rasteriserCount; i++) {
+      workers.emplace_back(rasterise, i);
+    }
+
+    rasterise(0);
+
+    for (auto& worker : workers) {
+      worker.join();
+    }
+
+    return glyphs;
+  }
+
+  bool FontLibrary::tryRasteriseGlyph(FT_Face face, char32_t codepoint, RasterisedGlyph& glyph, uint32_t distanceFieldSpread) {
+    glyph.codepoint = codepoint;
+    if (face == nullptr || FT_Load_Char(face, codepoint, FT_LOAD_RENDER)) {
+      return false;
+    }
+
+    auto& bitmap = face->glyph->bitmap;
+    glyph.width = static_cast<uint32_t>(bitmap.width);
+    glyph.height = static_cast<uint32_t>(bitmap.rows);
+    glyph.bearingX = face->glyph->bitmap_left;
+    glyph.bearingY = face->glyph->bitmap_top;
+    glyph.advance = GraphicsCharacterRenderDataHelper::getAdvanceDistance(face->glyph->advance.x);
+
+    //FreeType pads its rows, so copy them one at a time into a tightly packed buffer.
+    glyph.pixels.resize(static_cast<size_t>(glyph.width) * glyph.height);
+    for (uint32_t row = 0; row < glyph.height; row++) {
+      std::memcpy(glyph.pixels.data() + static_cast<size_t>(row) * glyph.width, bitmap.buffer + static_cast<ptrdiff_t>(row) * bitmap.pitch, glyph.width);
+    }
+
+    //Empty glyphs such as spaces only need their advance.
+    if (distanceFieldSpread == 0 || glyph.pixels.empty()) return true;
+
+    glyph.pixels = DistanceFieldGenerator::generate(glyph.pixels.data(), glyph.width, glyph.height, distanceFieldSpread);
+    glyph.width += distanceFieldSpread * 2;
+    glyph.height += distanceFieldSpread * 2;
+    glyph.bearingX -= static_cast<int32_t>(distanceFieldSpread);
+    glyph.bearingY += static_cast<int32_t>(distanceFieldSpread);
+
+    return true;
+  }
+
+  FontLibrary::~FontLibrary() {
+    FT_Done_FreeType(_library);
+  }
+}
@@ -7,7 +7,14 @@ namespace NovelRT::Graphics {
     _renderer(renderer),
     _id(id),
     _fontSize(0),
-    _fontFile("") {
+    _renderMode(FontRenderMode::Bitmap),
+    _fontFile(""),
+    _face(nullptr),
+    _atlasPages(),
+    _stagingPixels(),
+    _atlasPacker(nullptr),
+    _asciiCharacters(),
+    _extendedCharacters() {
 
   }
 
@@ -17,70 +24,161 @@ namespace NovelRT::Graphics {
       throw Exceptions::InvalidOperationException("Unable to continue! Cannot overwrite FontSet, please make a new FontSet.");
     }
 
-    if (_fontCharacters.size() != 0) {
-      _fontCharacters.clear();
-    }
+    _renderMode = FontRenderMode::Bitmap;
+    loadGlyphs(file, fontSize);
+  }
 
-    FT_Library freeTypeLoader;
-    if (FT_Init_FreeType(&freeTypeLoader)) {
-      _logger.logError("Failed to initialise Freetype.");
+  void FontSet::loadFontAsDistanceField(const std::string& file) {
+    if (!_fontFile.empty()) {
+      _logger.logError("This FontSet has already been initialised with data. Please make a new FontSet!");
+      throw Exceptions::InvalidOperationException("Unable to continue! Cannot overwrite FontSet, please make a new FontSet.");
     }
 
-    FT_Face face;
+    _renderMode = FontRenderMode::DistanceField;
+    loadGlyphs(file, static_cast<float>(DistanceFieldBaseSize));
+  }
+
+  void FontSet::loadGlyphs(const std::string& file, float fontSize) {
+    auto& fontLibrary = _renderer->getFontLibrary();
+    auto pixelSize = static_cast<uint32_t>(fontSize);
 
-    if (FT_New_Face(freeTypeLoader, file.c_str(), 0, &face)) {
-      _logger.logError("FREETYPE - Failed to load font: {}", file);
+    //This face is kept for kerning and for glyphs outside the ASCII range, which are rasterised on demand.
+    _face = fontLibrary->createFace(file, pixelSize);
+
+    std::vector<char32_t> codepoints(AsciiCharacterCount);
+    std::iota(codepoints.begin(), codepoints.end(), 0);
+    auto glyphs = fontLibrary->rasteriseGlyphs(file, pixelSize, codepoints, getDistanceFieldSpread());
+
+    _fontFile = file;
+    _fontSize = fontSize;
+
+    for (auto& glyph : glyphs) {
+      if (!glyph.isSuccessful || !tryPackGlyph(glyph, _asciiCharacters[glyph.codepoint])) {
+        _logger.logError("FREETYTPE: Failed to load Glyph");
+      }
     }
 
-    FT_Set_Pixel_Sizes(face, 0, static_cast<FT_UInt>(fontSize));
+    flushAtlasPage();
+  }
+
+  void FontSet::addAtlasPage() {
+    flushAtlasPage();
+
+    auto page = _renderer->getTexture();
+    _renderer->getGLStateCache().bindTexture2D(page->getTextureIdInternal());
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, AtlasPageSize, AtlasPageSize, 0, GL_RED, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    page->_size = Maths::GeoVector2F(static_cast<float>(AtlasPageSize), static_cast<float>(AtlasPageSize));
+
+    _atlasPages.push_back(page);
+    _atlasPacker = std::make_unique<SkylinePacker>(AtlasPageSize, AtlasPageSize);
+
+    //New pages are composed on the CPU and uploaded whole by flushAtlasPage. Starting from a cleared page also stops
+    //filtering from pulling whatever the driver left in the padding into the glyph edges.
+    _stagingPixels.assign(static_cast<size_t>(AtlasPageSize) * AtlasPageSize, 0);
+  }
+
+  void FontSet::flushAtlasPage() {
+    if (_stagingPixels.empty()) return;
 
+    _renderer->getGLStateCache().bindTexture2D(_atlasPages.back()->getTextureIdInternal());
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // Disable byte-alignment restriction
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, AtlasPageSize, AtlasPageSize, GL_RED, GL_UNSIGNED_BYTE, _stagingPixels.data());
+
+    _stagingPixels.clear();
+    _stagingPixels.shrink_to_fit();
+  }
 
+  bool FontSet::tryPackGlyph(const RasterisedGlyph& glyph, GraphicsCharacterRenderData& character) {
+    auto width = glyph.width;
+    auto height = glyph.height;
 
-    for (GLubyte c = 0; c < 128; c++) {
-      // Load character glyph
-      if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
-        _logger.logError("FREETYTPE: Failed to load Glyph");
-        continue;
+    if (_atlasPacker == nullptr) {
+      addAtlasPage();
+    }
+
+    uint32_t x = 0;
+    uint32_t y = 0;
+    if (!_atlasPacker->tryPack(width + GlyphPadding, height + GlyphPadding, x, y)) {
+      addAtlasPage();
+      if (!_atlasPacker->tryPack(width + GlyphPadding, height + GlyphPadding, x, y)) {
+        _logger.logError("Glyph {} is too large to fit in a font atlas page.", static_cast<uint32_t>(glyph.codepoint));
+        return false;
       }
-      // Generate texture
-      GLuint textureId = 0;
-      glGenTextures(1, &textureId);
-      glBindTexture(GL_TEXTURE_2D, textureId);
-      glTexImage2D(
-        GL_TEXTURE_2D,
-        0,
-        GL_RED,
-        face->glyph->bitmap.width,
-        face->glyph->bitmap.rows,
-        0,
-        GL_RED,
-        GL_UNSIGNED_BYTE,
-        face->glyph->bitmap.buffer
-      );
-      // Set texture options
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-      // Now store character for later use
-      GraphicsCharacterRenderData character = {
-          _renderer->getTexture(),
-          static_cast<uint32_t>(face->glyph->bitmap.width),
-          static_cast<uint32_t>(face->glyph->bitmap.rows),
-          face->glyph->bitmap_left,
-          face->glyph->bitmap_top,
-          GraphicsCharacterRenderDataHelper::getAdvanceDistance(face->glyph->advance.x)
-      };
-      character.texture->setTextureIdInternal(textureId);
-      _fontCharacters.insert(std::pair<GLchar, GraphicsCharacterRenderData>(c, character));
     }
-    FT_Done_Face(face);
-    FT_Done_FreeType(freeTypeLoader);
-    _fontFile = file;
-    _fontSize = fontSize;
 
+    auto& page = _atlasPages.back();
+    if (width > 0 && height > 0) {
+      if (!_stagingPixels.empty()) {
+        for (uint32_t row = 0; row < height; row++) {
+          std::memcpy(_stagingPixels.data() + (static_cast<size_t>(y) + row) * AtlasPageSize + x,
+            glyph.pixels.data() + static_cast<size_t>(row) * width, width);
+        }
+      }
+      else {
+        _renderer->getGLStateCache().bindTexture2D(page->getTextureIdInternal());
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLsizei>(width), static_cast<GLsizei>(height),
+          GL_RED, GL_UNSIGNED_BYTE, glyph.pixels.data());
+      }
+    }
+
+    auto pageSize = static_cast<float>(AtlasPageSize);
+    character = {
+        page,
+        width,
+        height,
+        glyph.bearingX,
+        glyph.bearingY,
+        glyph.advance,
+        Maths::GeoVector4F(x / pageSize, y / pageSize, width / pageSize, height / pageSize)
+    };
+
+    return true;
+  }
+
+  const GraphicsCharacterRenderData& FontSet::getCharacter(char32_t codepoint) {
+    if (_fontFile.empty()) {
+      throw Exceptions::CharacterNotFoundException(static_cast<char>(codepoint));
+    }
+
+    if (codepoint < AsciiCharacterCount) {
+      return _asciiCharacters[codepoint];
+    }
+
+    auto match = _extendedCharacters.find(codepoint);
+    if (match != _extendedCharacters.end()) {
+      return match->second;
+    }
+
+    GraphicsCharacterRenderData character;
+    RasterisedGlyph glyph;
+    if (!FontLibrary::tryRasteriseGlyph(_face.get(), codepoint, glyph, getDistanceFieldSpread()) || !tryPackGlyph(glyph, character)) {
+      //Remember the fallback too, so that a missing glyph is only looked up once.
+      character = _asciiCharacters[0];
+    }
+
+    flushAtlasPage();
+
+    return _extendedCharacters.emplace(codepoint, character).first->second;
+  }
+
+  int32_t FontSet::getKerning(char32_t left, char32_t right) const {
+    auto face = _face.get();
+    if (face == nullptr || !FT_HAS_KERNING(face)) {
+      return 0;
+    }
+
+    FT_Vector kerning;
+    if (FT_Get_Kerning(face, FT_Get_Char_Index(face, left), FT_Get_Char_Index(face, right), FT_KERNING_DEFAULT, &kerning)) {
+      return 0;
+    }
+
+    //FT_KERNING_DEFAULT gives grid fitted 26.6 fixed point values.
+    return static_cast<int32_t>(kerning.x >> 6);
   }
 
   FontSet::~FontSet() {
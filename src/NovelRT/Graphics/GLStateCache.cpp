@@ -0,0 +1,180 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  GLStateCache::GLStateCache() noexcept :
+    _program(UnknownBinding),
+    _vertexArray(UnknownBinding),
+    _texture2D(UnknownBinding),
+    _arrayBuffer(UnknownBinding),
+    _uniformBuffer(UnknownBinding),
+    _pixelUnpackBuffer(UnknownBinding),
+    _blendSourceFactor(UnknownBinding),
+    _blendDestinationFactor(UnknownBinding),
+    _blendSourceAlphaFactor(UnknownBinding),
+    _blendDestinationAlphaFactor(UnknownBinding),
+    _depthMask(UnknownBinding),
+    _capabilities(),
+    _issuedCallCount(0),
+    _elidedCallCount(0),
+    _lastFrameIssuedCallCount(0),
+    _lastFrameElidedCallCount(0) {}
+
+  GLuint* GLStateCache::getBufferBinding(GLenum target) noexcept {
+    switch (target) {
+      case GL_ARRAY_BUFFER:
+        return &_arrayBuffer;
+      case GL_UNIFORM_BUFFER:
+        return &_uniformBuffer;
+      case GL_PIXEL_UNPACK_BUFFER:
+        return &_pixelUnpackBuffer;
+      default:
+        return nullptr;
+    }
+  }
+
+  void GLStateCache::useProgram(GLuint program) {
+    if (_program == program) {
+      _elidedCallCount++;
+      return;
+    }
+
+    glUseProgram(program);
+    _program = program;
+    _issuedCallCount++;
+  }
+
+  void GLStateCache::bindVertexArray(GLuint vertexArray) {
+    if (_vertexArray == vertexArray) {
+      _elidedCallCount++;
+      return;
+    }
+
+    glBindVertexArray(vertexArray);
+    _vertexArray = vertexArray;
+    _issuedCallCount++;
+  }
+
+  void GLStateCache::bindTexture2D(GLuint texture) {
+    if (_texture2D == texture) {
+      _elidedCallCount++;
+      return;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, texture);
+    _texture2D = texture;
+    _issuedCallCount++;
+  }
+
+  void GLStateCache::bindBuffer(GLenum target, GLuint buffer) {
+    auto binding = getBufferBinding(target);
+    if (binding != nullptr && *binding == buffer) {
+      _elidedCallCount++;
+      return;
+    }
+
+    glBindBuffer(target, buffer);
+    if (binding != nullptr) {
+      *binding = buffer;
+    }
+
+    _issuedCallCount++;
+  }
+
+  void GLStateCache::setCapability(GLenum capability, bool isEnabled) {
+    auto match = _capabilities.find(capability);
+    if (match != _capabilities.end() && match->second == isEnabled) {
+      _elidedCallCount++;
+      return;
+    }
+
+    if (isEnabled) {
+      glEnable(capability);
+    }
+    else {
+      glDisable(capability);
+    }
+
+    _capabilities[capability] = isEnabled;
+    _issuedCallCount++;
+  }
+
+  void GLStateCache::blendFunc(GLenum sourceFactor, GLenum destinationFactor) {
+    blendFuncSeparate(sourceFactor, destinationFactor, sourceFactor, destinationFactor);
+  }
+
+  void GLStateCache::blendFuncSeparate(GLenum sourceFactor, GLenum destinationFactor, GLenum sourceAlphaFactor, GLenum destinationAlphaFactor) {
+    if (_blendSourceFactor == sourceFactor && _blendDestinationFactor == destinationFactor &&
+      _blendSourceAlphaFactor == sourceAlphaFactor && _blendDestinationAlphaFactor == destinationAlphaFactor) {
+      _elidedCallCount++;
+      return;
+    }
+
+    glBlendFuncSeparate(sourceFactor, destinationFactor, sourceAlphaFactor, destinationAlphaFactor);
+    _blendSourceFactor = sourceFactor;
+    _blendDestinationFactor = destinationFactor;
+    _blendSourceAlphaFactor = sourceAlphaFactor;
+    _blendDestinationAlphaFactor = destinationAlphaFactor;
+    _issuedCallCount++;
+  }
+
+  void GLStateCache::depthMask(GLboolean isEnabled) {
+    if (_depthMask == isEnabled) {
+      _elidedCallCount++;
+      return;
+    }
+
+    glDepthMask(isEnabled);
+    _depthMask = isEnabled;
+    _issuedCallCount++;
+  }
+
+  void GLStateCache::onProgramDeleted(GLuint program) noexcept {
+    if (_program == program) {
+      _program = UnknownBinding;
+    }
+  }
+
+  void GLStateCache::onVertexArrayDeleted(GLuint vertexArray) noexcept {
+    if (_vertexArray == vertexArray) {
+      _vertexArray = 0;
+    }
+  }
+
+  void GLStateCache::onTextureDeleted(GLuint texture) noexcept {
+    if (_texture2D == texture) {
+      _texture2D = 0;
+    }
+  }
+
+  void GLStateCache::onBufferDeleted(GLuint buffer) noexcept {
+    for (auto binding : { &_arrayBuffer, &_uniformBuffer, &_pixelUnpackBuffer }) {
+      if (*binding == buffer) {
+        *binding = 0;
+      }
+    }
+  }
+
+  void GLStateCache::invalidate() noexcept {
+    _program = UnknownBinding;
+    _vertexArray = UnknownBinding;
+    _texture2D = UnknownBinding;
+    _arrayBuffer = UnknownBinding;
+    _uniformBuffer = UnknownBinding;
+    _pixelUnpackBuffer = UnknownBinding;
+    _blendSourceFactor = UnknownBinding;
+    _blendDestinationFactor = UnknownBinding;
+    _blendSourceAlphaFactor = UnknownBinding;
+    _blendDestinationAlphaFactor = UnknownBinding;
+    _depthMask = UnknownBinding;
+    _capabilities.clear();
+  }
+
+  void GLStateCache::endFrame() noexcept {
+    _lastFrameIssuedCallCount = _issuedCallCount;
+    _lastFrameElidedCallCount = _elidedCallCount;
+    _issuedCallCount = 0;
+    _elidedCallCount = 0;
+  }
+}
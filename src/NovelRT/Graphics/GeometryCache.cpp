@@ -0,0 +1,88 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  const std::array<GLfloat, 12> GeometryCache::UnitQuadVertices = {
+    -0.5f, 0.5f, 0.0f,
+    0.5f, 0.5f, 0.0f,
+    0.5f, -0.5f, 0.0f,
+    -0.5f, -0.5f, 0.0f,
+  };
+
+  const std::array<GLushort, GeometryCache::UnitQuadIndexCount> GeometryCache::UnitQuadIndices = {
+    0, 2, 1,
+    0, 3, 2,
+  };
+
+  static GLuint generateVertexArray() {
+    GLuint tempVao;
+    glGenVertexArrays(1, &tempVao);
+    return tempVao;
+  }
+
+  static GLuint generateIndexBuffer() {
+    //The element buffer binding is VAO state, so stay off whatever VAO the caller has bound while we upload.
+    GLint previousVao;
+    glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &previousVao);
+    glBindVertexArray(0);
+
+    GLuint tempBuffer;
+    glGenBuffers(1, &tempBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, tempBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GeometryCache::UnitQuadIndices), GeometryCache::UnitQuadIndices.data(), GL_STATIC_DRAW);
+
+    glBindVertexArray(static_cast<GLuint>(previousVao));
+    return tempBuffer;
+  }
+
+  GeometryCache::GeometryCache(std::shared_ptr<GLStateCache> glState) noexcept :
+    _glState(glState),
+    _unitQuadVertexBuffer(Utilities::Lazy<GLuint>(std::function<GLuint()>([this] {
+      GLuint tempBuffer;
+      glGenBuffers(1, &tempBuffer);
+      _glState->bindBuffer(GL_ARRAY_BUFFER, tempBuffer);
+      glBufferData(GL_ARRAY_BUFFER, sizeof(GeometryCache::UnitQuadVertices), GeometryCache::UnitQuadVertices.data(), GL_STATIC_DRAW);
+      return tempBuffer;
+    }))),
+    _unitQuadIndexBuffer(Utilities::Lazy<GLuint>(generateIndexBuffer)),
+    _unitQuadVertexArray(Utilities::Lazy<GLuint>(generateVertexArray)) {}
+
+  void GeometryCache::attachUnitQuadToBoundVertexArray() {
+    auto indexBuffer = _unitQuadIndexBuffer.getActual();
+
+    _glState->bindBuffer(GL_ARRAY_BUFFER, _unitQuadVertexBuffer.getActual());
+    glEnableVertexAttribArray(VertexPositionLocation);
+    glVertexAttribPointer(VertexPositionLocation, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+  }
+
+  GLuint GeometryCache::getUnitQuadVertexArray() {
+    if (!_unitQuadVertexArray.isCreated()) {
+      _glState->bindVertexArray(_unitQuadVertexArray.getActual());
+      attachUnitQuadToBoundVertexArray();
+    }
+
+    return _unitQuadVertexArray.getActual();
+  }
+
+  GeometryCache::~GeometryCache() {
+    if (_unitQuadVertexArray.isCreated()) {
+      auto vao = _unitQuadVertexArray.getActual();
+      glDeleteVertexArrays(1, &vao);
+      _glState->onVertexArrayDeleted(vao);
+    }
+
+    if (_unitQuadIndexBuffer.isCreated()) {
+      auto buffer = _unitQuadIndexBuffer.getActual();
+      glDeleteBuffers(1, &buffer);
+      _glState->onBufferDeleted(buffer);
+    }
+
+    if (!_unitQuadVertexBuffer.isCreated()) return;
+
+    auto buffer = _unitQuadVertexBuffer.getActual();
+    glDeleteBuffers(1, &buffer);
+    _glState->onBufferDeleted(buffer);
+  }
+}
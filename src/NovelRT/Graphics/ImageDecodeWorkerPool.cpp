@@ -0,0 +1,123 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  ImageDecodeWorkerPool::ImageDecodeWorkerPool(size_t workerCount, size_t maxPooledImages) noexcept :
+    _workerCount(std::max<size_t>(workerCount, 1)),
+    _maxPooledImages(maxPooledImages),
+    _workers(),
+    _mutex(),
+    _requestAvailable(),
+    _requests(),
+    _results(),
+    _imagePool(),
+    _resultBytes(0),
+    _activeDecodeCount(0),
+    _isStopping(false) {}
+
+  void ImageDecodeWorkerPool::request(uint64_t requestId, const std::string& file) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _requests.push_back(Request{requestId, file});
+
+      if (_workers.empty()) {
+        for (size_t i = 0; i < _workerCount; i++) {
+          _workers.emplace_back(&ImageDecodeWorkerPool::runWorker, this);
+        }
+      }
+    }
+
+    _requestAvailable.notify_one();
+  }
+
+  void ImageDecodeWorkerPool::runWorker() {
+    while (true) {
+      Request request{};
+      RgbaImage image;
+
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _requestAvailable.wait(lock, [this] { return _isStopping || !_requests.empty(); });
+        if (_isStopping) return;
+
+        request = std::move(_requests.front());
+        _requests.pop_front();
+        _activeDecodeCount++;
+
+        if (!_imagePool.empty()) {
+          image = std::move(_imagePool.back());
+          _imagePool.pop_back();
+        }
+      }
+
+      auto isSuccessful = true;
+      auto alphaMode = TextureAlphaMode::Translucent;
+      try {
+        if (QoiCodec::isQoiFile(request.file)) {
+          QoiCodec::decodeFile(request.file, image);
+        }
+        else {
+          PngCodec::decodeFile(request.file, image);
+        }
+
+        //Scanning the alpha here keeps it off the render thread.
+        alphaMode = PixelConverter::classifyAlpha(image.pixels.data(), static_cast<size_t>(image.width) * image.height);
+      }
+      catch (const std::exception&) {
+        //The codec has already logged why. The owner decides what a failed load means for it.
+        isSuccessful = false;
+        image.width = 0;
+        image.height = 0;
+        image.pixels.clear();
+      }
+
+      std::lock_guard<std::mutex> lock(_mutex);
+      _activeDecodeCount--;
+      _resultBytes += image.pixels.size();
+      _results.push_back(Result{request.requestId, std::move(request.file), std::move(image), alphaMode, isSuccessful});
+    }
+  }
+
+  bool ImageDecodeWorkerPool::tryTakeResult(Result& result, size_t maxBytes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_results.empty()) return false;
+
+    auto& front = _results.front();
+    if (front.isSuccessful && front.image.pixels.size() > maxBytes) return false;
+
+    _resultBytes -= front.image.pixels.size();
+    result = std::move(front);
+    _results.pop_front();
+    return true;
+  }
+
+  void ImageDecodeWorkerPool::recycle(RgbaImage image) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_imagePool.size() >= _maxPooledImages) return;
+
+    _imagePool.push_back(std::move(image));
+  }
+
+  size_t ImageDecodeWorkerPool::getResultBytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _resultBytes;
+  }
+
+  size_t ImageDecodeWorkerPool::getPendingRequestCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _requests.size() + _activeDecodeCount;
+  }
+
+  ImageDecodeWorkerPool::~ImageDecodeWorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _isStopping = true;
+    }
+
+    _requestAvailable.notify_all();
+    for (auto& worker : _workers) {
+      worker.join();
+    }
+  }
+}
@@ -7,106 +7,96 @@ namespace NovelRT::Graphics {
     int32_t layer,
     ShaderProgram shaderProgram,
     std::shared_ptr<Camera> camera,
+    std::shared_ptr<RenderingService> renderer,
     std::shared_ptr<Texture> texture,
     RGBAConfig colourTint) :
     RenderObject(transform,
       layer,
       shaderProgram,
-      camera),
+      camera,
+      renderer),
     _texture(texture),
-    _uvBuffer(Utilities::Lazy<GLuint>(generateStandardBuffer)),
-    _colourTintBuffer(Utilities::Lazy<GLuint>(generateStandardBuffer)),
     _colourTint(colourTint),
+    _uvRect(Maths::GeoVector4F(0.0f, 0.0f, 1.0f, 1.0f)),
+    _contentRect(Maths::GeoVector4F(0.0f, 0.0f, 1.0f, 1.0f)),
+    _instanceData(),
+    _isInstanceTransformDirty(true),
     _logger(Utilities::Misc::CONSOLE_LOG_GFX) {}
 
    ImageRect::ImageRect(Transform transform,
      int32_t layer,
      ShaderProgram shaderProgram,
      std::shared_ptr<Camera> camera,
-     RGBAConfig colourTint) : ImageRect(transform, layer, shaderProgram, camera, nullptr, colourTint) {
+     std::shared_ptr<RenderingService> renderer,
+     RGBAConfig colourTint) : ImageRect(transform, layer, shaderProgram, camera, renderer, nullptr, colourTint) {
+   }
+
+   Maths::GeoMatrix4x4F ImageRect::getInstanceTransform() {
+     auto transform = getModelMatrix();
+     if (_contentRect != Maths::GeoVector4F(0.0f, 0.0f, 1.0f, 1.0f)) {
+       //Trimmed atlas regions only cover part of the image this rect is sized for, so shrink the quad down onto that part.
+       auto model = *reinterpret_cast<glm::mat4*>(&transform);
+       model = glm::translate(model, glm::vec3(_contentRect.x + (_contentRect.z / 2.0f) - 0.5f, _contentRect.y + (_contentRect.w / 2.0f) - 0.5f, 0.0f));
+       model = glm::scale(model, glm::vec3(_contentRect.z, _contentRect.w, 1.0f));
+       transform = Maths::GeoMatrix4x4F(model);
+     }
+
+     return transform;
+   }
+
+   GLuint ImageRect::getSpriteShaderProgramId() const noexcept {
+     //Cutout images draw in the opaque pass with blending off, so the default shader has to be swapped for one that discards.
+     auto shaderProgramId = _shaderProgram.shaderProgramId;
+     if (shaderProgramId == _renderer->_texturedRectProgram.shaderProgramId && _texture->getAlphaMode() == TextureAlphaMode::Cutout && !isTranslucent()) {
+       shaderProgramId = _renderer->_cutoutTexturedRectProgram.shaderProgramId;
+     }
+
+     return shaderProgramId;
    }
 
    void ImageRect::drawObject() {
      if (!getActive() || _texture == nullptr) return;
 
-     glUseProgram(_shaderProgram.shaderProgramId);
-     glBindBuffer(GL_UNIFORM_BUFFER, _shaderProgram.finalViewMatrixBufferUboId);
-     glBufferData(GL_UNIFORM_BUFFER, sizeof(Maths::GeoMatrix4x4F), &_finalViewMatrixData.getActual(), GL_STATIC_DRAW);
-
-     glBindTexture(GL_TEXTURE_2D, _texture->getTextureIdInternal());
-     glBindVertexArray(_vertexArrayObject.getActual());
-     glEnableVertexAttribArray(0);
-     glBindBuffer(GL_ARRAY_BUFFER, _vertexBuffer.getActual());
-     glVertexAttribPointer(
-       0,
-       3,
-       GL_FLOAT,
-       GL_FALSE,
-       0,
-       nullptr
-     );
-
-     glEnableVertexAttribArray(1);
-     glBindBuffer(GL_ARRAY_BUFFER, _uvBuffer.getActual());
-     glVertexAttribPointer(
-       1,
-       2,
-       GL_FLOAT,
-       GL_FALSE,
-       0,
-       nullptr
-     );
-
-     glEnableVertexAttribArray(2);
-     glBindBuffer(GL_ARRAY_BUFFER, _colourTintBuffer.getActual());
-     glVertexAttribPointer(
-       2,
-       4,
-       GL_FLOAT,
-       GL_FALSE,
-       0,
-       nullptr
-     );
-
-     glDrawArrays(GL_TRIANGLES, 0, 6);
-     glDisableVertexAttribArray(2);
-     glDisableVertexAttribArray(1);
-     glDisableVertexAttribArray(0);
-     glBindVertexArray(0);
+     if (_isInstanceTransformDirty) {
+       _instanceData.transform = getInstanceTransform();
+       _isInstanceTransformDirty = false;
+     }
+
+     //Shapes queued before this image have to reach the screen first, otherwise the batch would reorder them past us.
+     _renderer->getShapeBatch().flush();
+     _renderer->getSpriteBatch().submit(getSpriteShaderProgramId(), _texture, _instanceData);
+   }
+
+   void ImageRect::recordCommands(RenderCommandList& commands) {
+     if (!getActive() || _texture == nullptr) return;
+
+     //Other threads may be recording at the same time, so the cached transform is left for drawObject to fill in.
+     auto& instance = commands.addSprite(getSpriteShaderProgramId(), _texture);
+     instance = _instanceData;
+     instance.transform = getInstanceTransform();
+   }
+
+   bool ImageRect::isTranslucent() const noexcept {
+     return _colourTint.getA() < 255 || (_texture != nullptr && _texture->getAlphaMode() == TextureAlphaMode::Translucent);
+   }
+
+   GLuint ImageRect::getSortTextureId() noexcept {
+     return _texture == nullptr ? 0 : _texture->getTextureIdInternal();
+   }
+
+   void ImageRect::setTextureRegion(const TextureRegion& region) {
+     _texture = region.texture;
+     _uvRect = region.uvRect;
+     _contentRect = region.contentRect;
+     _isDirty = true;
    }
 
    void ImageRect::configureObjectBuffers() {
-     RenderObject::configureObjectBuffers();
-
-     _uvCoordinates = {
-         0.0f, 1.0f,
-         1.0f, 0.0f,
-         1.0f, 1.0f,
-         0.0f, 1.0f,
-         0.0f, 0.0f,
-         1.0f, 0.0f
-     };
-
-     glBindBuffer(GL_ARRAY_BUFFER, _uvBuffer.getActual());
-
-     glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * _uvCoordinates.size(), _uvCoordinates.data(), GL_STATIC_DRAW);
-
-     auto config = colourTint();
-     auto rScalar = config.getRScalar();
-     auto gScalar = config.getGScalar();
-     auto bScalar = config.getBScalar();
-     auto aScalar = config.getAScalar();
-
-     _colourTintData = {
-         rScalar, gScalar, bScalar, aScalar,
-         rScalar, gScalar, bScalar, aScalar,
-         rScalar, gScalar, bScalar, aScalar,
-         rScalar, gScalar, bScalar, aScalar,
-         rScalar, gScalar, bScalar, aScalar,
-         rScalar, gScalar, bScalar, aScalar,
-     };
-
-     glBindBuffer(GL_ARRAY_BUFFER, _colourTintBuffer.getActual());
-     glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * _colourTintData.size(), _colourTintData.data(), GL_STATIC_DRAW);
+     //ImageRects are drawn through the renderer's SpriteBatch, which owns the quad geometry. All we need to keep is our instance data.
+     //The model matrix is only copied in while drawing, once the TransformStore has rebuilt it.
+     _isInstanceTransformDirty = true;
+     _instanceData.uvRect = _uvRect;
+
+     _instanceData.colourTint = Maths::GeoVector4F(_colourTint.getRScalar(), _colourTint.getGScalar(), _colourTint.getBScalar(), _colourTint.getAScalar());
    }
 }
@@ -0,0 +1,121 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  MaxRectsPacker::MaxRectsPacker(uint32_t width, uint32_t height) noexcept :
+    _width(width),
+    _height(height),
+    _usedArea(0),
+    _freeRects{FreeRect{0, 0, width, height}} {}
+
+  bool MaxRectsPacker::tryPack(uint32_t width, uint32_t height, uint32_t& x, uint32_t& y) {
+    if (width == 0 || height == 0) {
+      x = 0;
+      y = 0;
+      return true;
+    }
+
+    //Best short side fit: pick the free rectangle that leaves the smallest gap along one side, then along the other.
+    auto bestIndex = _freeRects.size();
+    auto bestShortSide = std::numeric_limits<uint32_t>::max();
+    auto bestLongSide = std::numeric_limits<uint32_t>::max();
+    for (size_t i = 0; i < _freeRects.size(); i++) {
+      auto& freeRect = _freeRects[i];
+      if (freeRect.width < width || freeRect.height < height) continue;
+
+      auto leftoverX = freeRect.width - width;
+      auto leftoverY = freeRect.height - height;
+      auto shortSide = std::min(leftoverX, leftoverY);
+      auto longSide = std::max(leftoverX, leftoverY);
+      if (shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide)) {
+        bestIndex = i;
+        bestShortSide = shortSide;
+        bestLongSide = longSide;
+      }
+    }
+
+    if (bestIndex == _freeRects.size()) return false;
+
+    auto placed = FreeRect{_freeRects[bestIndex].x, _freeRects[bestIndex].y, width, height};
+    splitFreeRects(placed);
+    pruneFreeRects();
+
+    _usedArea += static_cast<uint64_t>(width) * height;
+    x = placed.x;
+    y = placed.y;
+    return true;
+  }
+
+  void MaxRectsPacker::splitFreeRects(const FreeRect& placed) {
+    auto placedRight = placed.x + placed.width;
+    auto placedBottom = placed.y + placed.height;
+
+    //Every free rectangle the placement overlaps is replaced by the (up to four) maximal pieces of it that are still free.
+    std::vector<FreeRect> pieces;
+    for (size_t i = 0; i < _freeRects.size();) {
+      auto freeRect = _freeRects[i];
+      auto freeRight = freeRect.x + freeRect.width;
+      auto freeBottom = freeRect.y + freeRect.height;
+
+      if (placed.x >= freeRight || placedRight <= freeRect.x || placed.y >= freeBottom || placedBottom <= freeRect.y) {
+        i++;
+        continue;
+      }
+
+      if (placed.x > freeRect.x) {
+        pieces.push_back(FreeRect{freeRect.x, freeRect.y, placed.x - freeRect.x, freeRect.height});
+      }
+
+      if (placedRight < freeRight) {
+        pieces.push_back(FreeRect{placedRight, freeRect.y, freeRight - placedRight, freeRect.height});
+      }
+
+      if (placed.y > freeRect.y) {
+        pieces.push_back(FreeRect{freeRect.x, freeRect.y, freeRect.width, placed.y - freeRect.y});
+      }
+
+      if (placedBottom < freeBottom) {
+        pieces.push_back(FreeRect{freeRect.x, placedBottom, freeRect.width, freeBottom - placedBottom});
+      }
+
+      _freeRects[i] = _freeRects.back();
+      _freeRects.pop_back();
+    }
+
+    _freeRects.insert(_freeRects.end(), pieces.begin(), pieces.end());
+  }
+
+  void MaxRectsPacker::pruneFreeRects() {
+    //Splitting leaves plenty of free rectangles that sit entirely inside another one. They can never be a better fit, so drop them.
+    auto contains = [](const FreeRect& outer, const FreeRect& inner) {
+      return inner.x >= outer.x && inner.y >= outer.y
+        && inner.x + inner.width <= outer.x + outer.width
+        && inner.y + inner.height <= outer.y + outer.height;
+    };
+
+    for (size_t i = 0; i < _freeRects.size();) {
+      auto isContained = false;
+      for (size_t j = i + 1; j < _freeRects.size();) {
+        if (contains(_freeRects[j], _freeRects[i])) {
+          isContained = true;
+          break;
+        }
+
+        if (contains(_freeRects[i], _freeRects[j])) {
+          _freeRects.erase(_freeRects.begin() + static_cast<std::ptrdiff_t>(j));
+          continue;
+        }
+
+        j++;
+      }
+
+      if (isContained) {
+        _freeRects.erase(_freeRects.begin() + static_cast<std::ptrdiff_t>(i));
+        continue;
+      }
+
+      i++;
+    }
+  }
+}
@@ -0,0 +1,104 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  static const GLuint INSTANCE_TRANSFORM_LOCATION = 1; //a mat4 attribute occupies four consecutive locations, 1 through 4.
+  static const GLuint INSTANCE_UV_RECT_LOCATION = 5;
+  static const GLuint INSTANCE_COLOUR_TINT_LOCATION = 6;
+
+  static GLuint generateVertexArray() {
+    GLuint tempVao;
+    glGenVertexArrays(1, &tempVao);
+    return tempVao;
+  }
+
+  static GLuint generateBuffer() {
+    GLuint tempBuffer;
+    glGenBuffers(1, &tempBuffer);
+    return tempBuffer;
+  }
+
+  OpenGLSpriteBatchBackend::OpenGLSpriteBatchBackend(std::shared_ptr<GLStateCache> glState, std::shared_ptr<GeometryCache> geometryCache) noexcept :
+    _glState(glState),
+    _geometryCache(geometryCache),
+    _vertexArrayObject(Utilities::Lazy<GLuint>(generateVertexArray)),
+    _instanceBuffer(Utilities::Lazy<GLuint>(generateBuffer)),
+    _instanceBufferCapacity(0) {}
+
+  void OpenGLSpriteBatchBackend::configureVertexArray() {
+    _glState->bindVertexArray(_vertexArrayObject.getActual());
+    _geometryCache->attachUnitQuadToBoundVertexArray();
+
+    _glState->bindBuffer(GL_ARRAY_BUFFER, _instanceBuffer.getActual());
+    for (GLuint i = 0; i < 4; i++) {
+      glEnableVertexAttribArray(INSTANCE_TRANSFORM_LOCATION + i);
+      glVertexAttribDivisor(INSTANCE_TRANSFORM_LOCATION + i, 1);
+    }
+    glEnableVertexAttribArray(INSTANCE_UV_RECT_LOCATION);
+    glVertexAttribDivisor(INSTANCE_UV_RECT_LOCATION, 1);
+    glEnableVertexAttribArray(INSTANCE_COLOUR_TINT_LOCATION);
+    glVertexAttribDivisor(INSTANCE_COLOUR_TINT_LOCATION, 1);
+  }
+
+  void OpenGLSpriteBatchBackend::bindInstanceAttributes(size_t firstInstance) {
+    //GLES 3.0 has no base instance support, so each group re-points the instance attributes at its own range instead.
+    auto stride = static_cast<GLsizei>(sizeof(SpriteInstanceData));
+    auto baseOffset = firstInstance * sizeof(SpriteInstanceData);
+
+    for (GLuint i = 0; i < 4; i++) {
+      auto columnOffset = baseOffset + offsetof(SpriteInstanceData, transform) + (i * sizeof(Maths::GeoVector4F));
+      glVertexAttribPointer(INSTANCE_TRANSFORM_LOCATION + i, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const GLvoid*>(columnOffset));
+    }
+
+    glVertexAttribPointer(INSTANCE_UV_RECT_LOCATION, 4, GL_FLOAT, GL_FALSE, stride,
+      reinterpret_cast<const GLvoid*>(baseOffset + offsetof(SpriteInstanceData, uvRect)));
+    glVertexAttribPointer(INSTANCE_COLOUR_TINT_LOCATION, 4, GL_FLOAT, GL_FALSE, stride,
+      reinterpret_cast<const GLvoid*>(baseOffset + offsetof(SpriteInstanceData, colourTint)));
+  }
+
+  void OpenGLSpriteBatchBackend::submit(const std::vector<SpriteInstanceData>& instances, const std::vector<SpriteBatchGroup>& groups) {
+    if (instances.empty()) return;
+
+    if (!_vertexArrayObject.isCreated()) {
+      configureVertexArray();
+    }
+
+    _glState->bindVertexArray(_vertexArrayObject.getActual());
+    _glState->bindBuffer(GL_ARRAY_BUFFER, _instanceBuffer.getActual());
+
+    auto requiredSize = sizeof(SpriteInstanceData) * instances.size();
+    if (requiredSize > _instanceBufferCapacity) {
+      _instanceBufferCapacity = requiredSize;
+      glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(requiredSize), instances.data(), GL_STREAM_DRAW);
+    }
+    else {
+      //Orphan the previous frame's storage so the driver does not have to wait on it before we overwrite it.
+      glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(_instanceBufferCapacity), nullptr, GL_STREAM_DRAW);
+      glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(requiredSize), instances.data());
+    }
+
+    for (auto& group : groups) {
+      if (group.instanceCount == 0) continue;
+
+      _glState->useProgram(group.shaderProgramId);
+      _glState->bindTexture2D(group.texture->getTextureIdInternal());
+      bindInstanceAttributes(group.firstInstance);
+      glDrawElementsInstanced(GL_TRIANGLES, GeometryCache::UnitQuadIndexCount, GL_UNSIGNED_SHORT, nullptr, static_cast<GLsizei>(group.instanceCount));
+    }
+  }
+
+  OpenGLSpriteBatchBackend::~OpenGLSpriteBatchBackend() {
+    if (_instanceBuffer.isCreated()) {
+      auto buffer = _instanceBuffer.getActual();
+      glDeleteBuffers(1, &buffer);
+      _glState->onBufferDeleted(buffer);
+    }
+
+    if (!_vertexArrayObject.isCreated()) return;
+
+    auto vao = _vertexArrayObject.getActual();
+    glDeleteVertexArrays(1, &vao);
+    _glState->onVertexArrayDeleted(vao);
+  }
+}
@@ -0,0 +1,342 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define NOVELRT_PARTICLEEMITTER_AVX2
+#define NOVELRT_PARTICLEEMITTER_SSE2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define NOVELRT_PARTICLEEMITTER_SSE2
+#endif
+
+namespace NovelRT::Graphics {
+  static const float DegreesToRadians = 0.01745329251994329577f;
+  static const float ShortestLifetime = 0.001f;
+  static const float LastTableIndex = static_cast<float>(ParticleEmitter::CurveTableSize - 1);
+
+  static inline size_t getTableIndex(float age, float inverseLifetime) noexcept {
+    return static_cast<size_t>(std::min(age * inverseLifetime, 1.0f) * LastTableIndex + 0.5f);
+  }
+
+#if defined(NOVELRT_PARTICLEEMITTER_SSE2)
+  static inline float getHorizontalMinimum(__m128 value) noexcept {
+    value = _mm_min_ps(value, _mm_movehl_ps(value, value));
+    return _mm_cvtss_f32(_mm_min_ss(value, _mm_shuffle_ps(value, value, 1)));
+  }
+
+  static inline float getHorizontalMaximum(__m128 value) noexcept {
+    value = _mm_max_ps(value, _mm_movehl_ps(value, value));
+    return _mm_cvtss_f32(_mm_max_ss(value, _mm_shuffle_ps(value, value, 1)));
+  }
+#endif
+
+  ParticleEmitter::ParticleEmitter(std::shared_ptr<Texture> texture, const ParticleEmitterSettings& settings, uint64_t seed) :
+    _texture(texture),
+    _settings(settings),
+    _positionX(),
+    _positionY(),
+    _velocityX(),
+    _velocityY(),
+    _rotation(),
+    _angularVelocity(),
+    _age(),
+    _inverseLifetime(),
+    _particleCount(0),
+    _speedTable(),
+    _sizeTable(),
+    _colourTable(),
+    _maxParticleExtent(0.0f),
+    _minimum(Maths::GeoVector2F::zero()),
+    _maximum(Maths::GeoVector2F::zero()),
+    _emissionAccumulator(0.0f),
+    //xorshift gets stuck on zero, so the seed is mixed with a constant that can never cancel it out completely.
+    _randomState(seed ^ 0x9E3779B97F4A7C15ULL),
+    _isEmitting(true) {
+    setSettings(settings);
+  }
+
+  float ParticleEmitter::nextRandom() noexcept {
+    _randomState ^= _randomState >> 12;
+    _randomState ^= _randomState << 25;
+    _randomState ^= _randomState >> 27;
+    return static_cast<float>((_randomState * 0x2545F4914F6CDD1DULL) >> 40) * (1.0f / 16777216.0f);
+  }
+
+  float ParticleEmitter::getRandomInRange(float minimum, float maximum) noexcept {
+    return minimum + (maximum - minimum) * nextRandom();
+  }
+
+  void ParticleEmitter::setSettings(const ParticleEmitterSettings& value) {
+    _settings = value;
+
+    auto capacity = static_cast<size_t>(_settings.maxParticles);
+    for (auto* stream : { &_positionX, &_positionY, &_velocityX, &_velocityY, &_rotation, &_angularVelocity, &_age, &_inverseLifetime }) {
+      stream->resize(capacity);
+    }
+
+    _particleCount = std::min(_particleCount, capacity);
+    bakeCurves();
+  }
+
+  void ParticleEmitter::bakeCurves() {
+    _speedTable.resize(CurveTableSize);
+    _sizeTable.resize(CurveTableSize);
+    _colourTable.resize(CurveTableSize);
+    _maxParticleExtent = 0.0f;
+
+    for (size_t i = 0; i < CurveTableSize; i++) {
+      auto time = static_cast<float>(i) / LastTableIndex;
+      _speedTable[i] = _settings.speedOverLifetime.evaluate(time);
+      _sizeTable[i] = _settings.sizeOverLifetime.evaluate(time);
+      _colourTable[i] = _settings.colourOverLifetime.evaluate(time);
+
+      //Half the diagonal, which is as far as a corner reaches from the centre at any rotation.
+      _maxParticleExtent = std::max(_maxParticleExtent, _sizeTable[i].getMagnitude() / 2.0f);
+    }
+  }
+
+  void ParticleEmitter::update(float seconds, Maths::GeoVector2F position) noexcept {
+    if (seconds <= 0.0f) return;
+
+    integrate(seconds);
+    removeDeadParticles();
+
+    if (!_isEmitting) return;
+
+    _emissionAccumulator += _settings.emissionRate * seconds;
+    auto count = std::floor(_emissionAccumulator);
+    _emissionAccumulator -= count;
+    emit(static_cast<uint32_t>(count), position);
+  }
+
+  void ParticleEmitter::burst(uint32_t count, Maths::GeoVector2F position) noexcept {
+    if (_particleCount == 0) {
+      _minimum = Maths::GeoVector2F(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+      _maximum = Maths::GeoVector2F(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+    }
+
+    emit(count, position);
+  }
+
+  void ParticleEmitter::integrate(float seconds) noexcept {
+    auto count = _particleCount;
+    auto accelerationX = _settings.acceleration.x * seconds;
+    auto accelerationY = _settings.acceleration.y * seconds;
+    auto minimumX = std::numeric_limits<float>::max();
+    auto minimumY = std::numeric_limits<float>::max();
+    auto maximumX = std::numeric_limits<float>::lowest();
+    auto maximumY = std::numeric_limits<float>::lowest();
+    auto positionX = _positionX.data();
+    auto positionY = _positionY.data();
+    auto velocityX = _velocityX.data();
+    auto velocityY = _velocityY.data();
+    auto rotation = _rotation.data();
+    auto angularVelocity = _angularVelocity.data();
+    auto age = _age.data();
+    auto inverseLifetime = _inverseLifetime.data();
+    auto speedTable = _speedTable.data();
+    size_t i = 0;
+
+#if defined(NOVELRT_PARTICLEEMITTER_AVX2)
+    {
+      auto delta = _mm256_set1_ps(seconds);
+      auto deltaVelocityX = _mm256_set1_ps(accelerationX);
+      auto deltaVelocityY = _mm256_set1_ps(accelerationY);
+      auto one = _mm256_set1_ps(1.0f);
+      auto lastIndex = _mm256_set1_ps(LastTableIndex);
+      auto half = _mm256_set1_ps(0.5f);
+      auto lowestX = _mm256_set1_ps(minimumX);
+      auto lowestY = lowestX;
+      auto highestX = _mm256_set1_ps(maximumX);
+      auto highestY = highestX;
+
+      for (; i + 8 <= count; i += 8) {
+        auto particleAge = _mm256_add_ps(_mm256_loadu_ps(age + i), delta);
+        _mm256_storeu_ps(age + i, particleAge);
+
+        auto time = _mm256_min_ps(_mm256_mul_ps(particleAge, _mm256_loadu_ps(inverseLifetime + i)), one);
+        auto index = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(time, lastIndex), half));
+        auto distance = _mm256_mul_ps(_mm256_i32gather_ps(speedTable, index, 4), delta);
+
+        auto particleVelocityX = _mm256_add_ps(_mm256_loadu_ps(velocityX + i), deltaVelocityX);
+        auto particleVelocityY = _mm256_add_ps(_mm256_loadu_ps(velocityY + i), deltaVelocityY);
+        _mm256_storeu_ps(velocityX + i, particleVelocityX);
+        _mm256_storeu_ps(velocityY + i, particleVelocityY);
+
+        auto particleX = _mm256_add_ps(_mm256_loadu_ps(positionX + i), _mm256_mul_ps(particleVelocityX, distance));
+        auto particleY = _mm256_add_ps(_mm256_loadu_ps(positionY + i), _mm256_mul_ps(particleVelocityY, distance));
+        _mm256_storeu_ps(positionX + i, particleX);
+        _mm256_storeu_ps(positionY + i, particleY);
+
+        _mm256_storeu_ps(rotation + i, _mm256_add_ps(_mm256_loadu_ps(rotation + i), _mm256_mul_ps(_mm256_loadu_ps(angularVelocity + i), delta)));
+
+        lowestX = _mm256_min_ps(lowestX, particleX);
+        lowestY = _mm256_min_ps(lowestY, particleY);
+        highestX = _mm256_max_ps(highestX, particleX);
+        highestY = _mm256_max_ps(highestY, particleY);
+      }
+
+      minimumX = getHorizontalMinimum(_mm_min_ps(_mm256_castps256_ps128(lowestX), _mm256_extractf128_ps(lowestX, 1)));
+      minimumY = getHorizontalMinimum(_mm_min_ps(_mm256_castps256_ps128(lowestY), _mm256_extractf128_ps(lowestY, 1)));
+      maximumX = getHorizontalMaximum(_mm_max_ps(_mm256_castps256_ps128(highestX), _mm256_extractf128_ps(highestX, 1)));
+      maximumY = getHorizontalMaximum(_mm_max_ps(_mm256_castps256_ps128(highestY), _mm256_extractf128_ps(highestY, 1)));
+    }
+#endif
+
+#if defined(NOVELRT_PARTICLEEMITTER_SSE2)
+    {
+      auto delta = _mm_set1_ps(seconds);
+      auto deltaVelocityX = _mm_set1_ps(accelerationX);
+      auto deltaVelocityY = _mm_set1_ps(accelerationY);
+      auto one = _mm_set1_ps(1.0f);
+      auto lastIndex = _mm_set1_ps(LastTableIndex);
+      auto half = _mm_set1_ps(0.5f);
+      auto lowestX = _mm_set1_ps(minimumX);
+      auto lowestY = _mm_set1_ps(minimumY);
+      auto highestX = _mm_set1_ps(maximumX);
+      auto highestY = _mm_set1_ps(maximumY);
+      alignas(16) int32_t indices[4];
+
+      for (; i + 4 <= count; i += 4) {
+        auto particleAge = _mm_add_ps(_mm_loadu_ps(age + i), delta);
+        _mm_storeu_ps(age + i, particleAge);
+
+        //SSE2 has no gather, so the table is read one lane at a time.
+        auto time = _mm_min_ps(_mm_mul_ps(particleAge, _mm_loadu_ps(inverseLifetime + i)), one);
+        _mm_store_si128(reinterpret_cast<__m128i*>(indices), _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(time, lastIndex), half)));
+        auto speed = _mm_setr_ps(speedTable[indices[0]], speedTable[indices[1]], speedTable[indices[2]], speedTable[indices[3]]);
+        auto distance = _mm_mul_ps(speed, delta);
+
+        auto particleVelocityX = _mm_add_ps(_mm_loadu_ps(velocityX + i), deltaVelocityX);
+        auto particleVelocityY = _mm_add_ps(_mm_loadu_ps(velocityY + i), deltaVelocityY);
+        _mm_storeu_ps(velocityX + i, particleVelocityX);
+        _mm_storeu_ps(velocityY + i, particleVelocityY);
+
+        auto particleX = _mm_add_ps(_mm_loadu_ps(positionX + i), _mm_mul_ps(particleVelocityX, distance));
+        auto particleY = _mm_add_ps(_mm_loadu_ps(positionY + i), _mm_mul_ps(particleVelocityY, distance));
+        _mm_storeu_ps(positionX + i, particleX);
+        _mm_storeu_ps(positionY + i, particleY);
+
+        _mm_storeu_ps(rotation + i, _mm_add_ps(_mm_loadu_ps(rotation + i), _mm_mul_ps(_mm_loadu_ps(angularVelocity + i), delta)));
+
+        lowestX = _mm_min_ps(lowestX, particleX);
+        lowestY = _mm_min_ps(lowestY, particleY);
+        highestX = _mm_max_ps(highestX, particleX);
+        highestY = _mm_max_ps(highestY, particleY);
+      }
+
+      minimumX = getHorizontalMinimum(lowestX);
+      minimumY = getHorizontalMinimum(lowestY);
+      maximumX = getHorizontalMaximum(highestX);
+      maximumY = getHorizontalMaximum(highestY);
+    }
+#endif
+
+    for (; i < count; i++) {
+      age[i] += seconds;
+      auto distance = speedTable[getTableIndex(age[i], inverseLifetime[i])] * seconds;
+      velocityX[i] += accelerationX;
+      velocityY[i] += accelerationY;
+      positionX[i] += velocityX[i] * distance;
+      positionY[i] += velocityY[i] * distance;
+      rotation[i] += angularVelocity[i] * seconds;
+
+      minimumX = std::min(minimumX, positionX[i]);
+      minimumY = std::min(minimumY, positionY[i]);
+      maximumX = std::max(maximumX, positionX[i]);
+      maximumY = std::max(maximumY, positionY[i]);
+    }
+
+    _minimum = Maths::GeoVector2F(minimumX, minimumY);
+    _maximum = Maths::GeoVector2F(maximumX, maximumY);
+  }
+
+  void ParticleEmitter::removeDeadParticles() noexcept {
+    size_t i = 0;
+    while (i < _particleCount) {
+      if (_age[i] * _inverseLifetime[i] < 1.0f) {
+        i++;
+        continue;
+      }
+
+      //The last particle takes the dead one's place, and is checked again in case it has died too.
+      auto last = --_particleCount;
+      _positionX[i] = _positionX[last];
+      _positionY[i] = _positionY[last];
+      _velocityX[i] = _velocityX[last];
+      _velocityY[i] = _velocityY[last];
+      _rotation[i] = _rotation[last];
+      _angularVelocity[i] = _angularVelocity[last];
+      _age[i] = _age[last];
+      _inverseLifetime[i] = _inverseLifetime[last];
+    }
+  }
+
+  void ParticleEmitter::emit(uint32_t count, Maths::GeoVector2F position) noexcept {
+    auto origin = position + _settings.offset;
+    auto emitCount = std::min<size_t>(count, _positionX.size() - _particleCount);
+
+    for (size_t emitted = 0; emitted < emitCount; emitted++) {
+      auto i = _particleCount++;
+      _positionX[i] = origin.x + (nextRandom() - 0.5f) * _settings.spawnAreaSize.x;
+      _positionY[i] = origin.y + (nextRandom() - 0.5f) * _settings.spawnAreaSize.y;
+      _velocityX[i] = getRandomInRange(_settings.minVelocity.x, _settings.maxVelocity.x);
+      _velocityY[i] = getRandomInRange(_settings.minVelocity.y, _settings.maxVelocity.y);
+      _rotation[i] = getRandomInRange(_settings.minRotation, _settings.maxRotation);
+      _angularVelocity[i] = getRandomInRange(_settings.minAngularVelocity, _settings.maxAngularVelocity);
+      _age[i] = 0.0f;
+      _inverseLifetime[i] = 1.0f / std::max(getRandomInRange(_settings.minLifetime, _settings.maxLifetime), ShortestLifetime);
+
+      _minimum = Maths::GeoVector2F(std::min(_minimum.x, _positionX[i]), std::min(_minimum.y, _positionY[i]));
+      _maximum = Maths::GeoVector2F(std::max(_maximum.x, _positionX[i]), std::max(_maximum.y, _positionY[i]));
+    }
+  }
+
+  void ParticleEmitter::writeInstances(SpriteInstanceData* target, float depth) const noexcept {
+    for (size_t i = 0; i < _particleCount; i++) {
+      auto tableIndex = getTableIndex(_age[i], _inverseLifetime[i]);
+      auto size = _sizeTable[tableIndex];
+      auto sine = 0.0f;
+      auto cosine = 1.0f;
+      if (_rotation[i] != 0.0f) {
+        sine = std::sin(_rotation[i] * DegreesToRadians);
+        cosine = std::cos(_rotation[i] * DegreesToRadians);
+      }
+
+      auto& instance = target[i];
+      instance.transform = Maths::GeoMatrix4x4F(
+        Maths::GeoVector4F(cosine * size.x, sine * size.x, 0.0f, 0.0f),
+        Maths::GeoVector4F(-sine * size.y, cosine * size.y, 0.0f, 0.0f),
+        Maths::GeoVector4F(0.0f, 0.0f, 1.0f, 0.0f),
+        Maths::GeoVector4F(_positionX[i], _positionY[i], depth, 1.0f));
+      instance.uvRect = _settings.uvRect;
+      instance.colourTint = _colourTable[tableIndex];
+    }
+  }
+
+  void ParticleEmitter::clear() noexcept {
+    _particleCount = 0;
+    _emissionAccumulator = 0.0f;
+  }
+
+  Maths::GeoBounds ParticleEmitter::getBounds() const noexcept {
+    if (_particleCount == 0) return Maths::GeoBounds(Maths::GeoVector2F::zero(), Maths::GeoVector2F::zero(), 0.0f);
+
+    auto extent = Maths::GeoVector2F(_maxParticleExtent, _maxParticleExtent);
+    auto minimum = _minimum - extent;
+    auto maximum = _maximum + extent;
+    return Maths::GeoBounds((minimum + maximum) / 2.0f, maximum - minimum, 0.0f);
+  }
+
+  const char* ParticleEmitter::getInstructionSet() noexcept {
+#if defined(NOVELRT_PARTICLEEMITTER_AVX2)
+    return "AVX2";
+#elif defined(NOVELRT_PARTICLEEMITTER_SSE2)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+  }
+}
@@ -0,0 +1,138 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  ParticleSystem::ParticleSystem(Transform transform, int32_t layer, ShaderProgram shaderProgram, std::shared_ptr<Camera> camera, std::shared_ptr<RenderingService> renderer) :
+    RenderObject(transform, layer, shaderProgram, camera, renderer),
+    _emitters(),
+    _instances(),
+    _runner(nullptr),
+    _updateHandler(Utilities::EventHandler<Timing::Timestamp>([=](Timing::Timestamp delta) { onUpdate(delta); })) {}
+
+  ParticleEmitter& ParticleSystem::addEmitter(std::shared_ptr<Texture> texture, const ParticleEmitterSettings& settings) {
+    //Every emitter gets its own seed, so that two emitters with the same settings do not move in lockstep.
+    _emitters.emplace_back(std::make_unique<ParticleEmitter>(texture, settings, static_cast<uint64_t>(_emitters.size()) + 1));
+    _isDirty = true;
+    return *_emitters.back();
+  }
+
+  void ParticleSystem::update(Timing::Timestamp delta) {
+    auto seconds = delta.getSecondsFloat();
+    auto position = std::as_const(*this).transform().position;
+    auto hadParticles = getParticleCount() != 0;
+
+    for (auto& emitter : _emitters) {
+      emitter->update(seconds, position);
+    }
+
+    //A system with nothing alive before or after has nothing new to draw, so it leaves idle frames alone.
+    if (hadParticles || getParticleCount() != 0) {
+      _isDirty = true;
+    }
+  }
+
+  void ParticleSystem::onUpdate(Timing::Timestamp delta) {
+    update(delta);
+
+    if (isAlive()) {
+      _runner->requestUpdateWithin(Timing::Timestamp::zero());
+    }
+  }
+
+  void ParticleSystem::play(NovelRunner* runner) {
+    if (_runner != nullptr) return;
+
+    _runner = runner;
+    _runner->Update += _updateHandler;
+  }
+
+  void ParticleSystem::stop() {
+    if (_runner == nullptr) return;
+
+    _runner->Update -= _updateHandler;
+    _runner = nullptr;
+  }
+
+  size_t ParticleSystem::getParticleCount() const noexcept {
+    size_t count = 0;
+    for (const auto& emitter : _emitters) {
+      count += emitter->getParticleCount();
+    }
+
+    return count;
+  }
+
+  bool ParticleSystem::isAlive() const noexcept {
+    return std::any_of(_emitters.begin(), _emitters.end(), [](const auto& emitter) { return emitter->isEmitting() || emitter->getParticleCount() != 0; });
+  }
+
+  void ParticleSystem::configureObjectBuffers() {
+    //Particles are written straight into the sprite batch every time the system is drawn, so there is nothing to keep between frames.
+  }
+
+  void ParticleSystem::drawObject() {
+    if (!getActive()) return;
+
+    //Shapes queued before this system have to reach the screen first, otherwise the batch would reorder them past us.
+    _renderer->getShapeBatch().flush();
+
+    auto depth = static_cast<float>(layer());
+    for (const auto& emitter : _emitters) {
+      auto count = emitter->getParticleCount();
+      if (count == 0 || emitter->getTexture() == nullptr) continue;
+
+      if (_instances.size() < count) {
+        _instances.resize(count);
+      }
+
+      emitter->writeInstances(_instances.data(), depth);
+      _renderer->getSpriteBatch().submit(_shaderProgram.shaderProgramId, emitter->getTexture(), _instances.data(), count);
+    }
+  }
+
+  void ParticleSystem::recordCommands(RenderCommandList& commands) {
+    if (!getActive()) return;
+
+    auto depth = static_cast<float>(layer());
+    for (const auto& emitter : _emitters) {
+      auto count = emitter->getParticleCount();
+      if (count == 0 || emitter->getTexture() == nullptr) continue;
+
+      emitter->writeInstances(commands.addSprites(_shaderProgram.shaderProgramId, emitter->getTexture(), count), depth);
+    }
+  }
+
+  bool ParticleSystem::isTranslucent() const noexcept {
+    //Particles overlap each other and usually fade out, so they always blend in the order they are written.
+    return true;
+  }
+
+  GLuint ParticleSystem::getSortTextureId() noexcept {
+    if (_emitters.empty() || _emitters.front()->getTexture() == nullptr) return 0;
+    return _emitters.front()->getTexture()->getTextureIdInternal();
+  }
+
+  Maths::GeoBounds ParticleSystem::getCullingBounds() const {
+    auto hasParticles = false;
+    auto minimum = Maths::GeoVector2F::zero();
+    auto maximum = Maths::GeoVector2F::zero();
+
+    for (const auto& emitter : _emitters) {
+      if (emitter->getParticleCount() == 0) continue;
+
+      auto bounds = emitter->getBounds();
+      auto emitterMinimum = bounds.position - (bounds.size / 2.0f);
+      auto emitterMaximum = bounds.position + (bounds.size / 2.0f);
+      minimum = hasParticles ? Maths::GeoVector2F(std::min(minimum.x, emitterMinimum.x), std::min(minimum.y, emitterMinimum.y)) : emitterMinimum;
+      maximum = hasParticles ? Maths::GeoVector2F(std::max(maximum.x, emitterMaximum.x), std::max(maximum.y, emitterMaximum.y)) : emitterMaximum;
+      hasParticles = true;
+    }
+
+    return Maths::GeoBounds((minimum + maximum) / 2.0f, maximum - minimum, 0.0f);
+  }
+
+  ParticleSystem::~ParticleSystem() {
+    stop();
+  }
+}
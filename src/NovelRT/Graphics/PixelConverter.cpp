@@ -0,0 +1,311 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+#if defined(__SSSE3__) || defined(__AVX__)
+#include <tmmintrin.h>
+#define NOVELRT_PIXELCONVERTER_SSSE3
+#define NOVELRT_PIXELCONVERTER_SSE2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define NOVELRT_PIXELCONVERTER_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define NOVELRT_PIXELCONVERTER_NEON
+#endif
+
+namespace NovelRT::Graphics {
+  //Each conversion runs its SIMD loop over as many whole blocks as it can, then hands the remaining pixels to the scalar loop.
+
+  static inline uint8_t premultiplyChannel(uint32_t colour, uint32_t alpha) noexcept {
+    //Exact round(colour * alpha / 255) without a division. The SIMD kernels use the same sequence on 16 bit lanes.
+    auto product = colour * alpha + 128;
+    return static_cast<uint8_t>((product + (product >> 8)) >> 8);
+  }
+
+  static void rgbToRgbaScalar(const uint8_t* source, uint8_t* destination, size_t pixelCount) noexcept {
+    for (size_t i = 0; i < pixelCount; i++) {
+      destination[0] = source[0];
+      destination[1] = source[1];
+      destination[2] = source[2];
+      destination[3] = 255;
+      source += 3;
+      destination += 4;
+    }
+  }
+
+  static void grayToRgbaScalar(const uint8_t* source, uint8_t* destination, size_t pixelCount) noexcept {
+    for (size_t i = 0; i < pixelCount; i++) {
+      destination[0] = source[i];
+      destination[1] = source[i];
+      destination[2] = source[i];
+      destination[3] = 255;
+      destination += 4;
+    }
+  }
+
+  static void grayAlphaToRgbaScalar(const uint8_t* source, uint8_t* destination, size_t pixelCount) noexcept {
+    for (size_t i = 0; i < pixelCount; i++) {
+      destination[0] = source[0];
+      destination[1] = source[0];
+      destination[2] = source[0];
+      destination[3] = source[1];
+      source += 2;
+      destination += 4;
+    }
+  }
+
+  static void premultiplyAlphaScalar(uint8_t* pixels, size_t pixelCount) noexcept {
+    for (size_t i = 0; i < pixelCount; i++) {
+      auto alpha = pixels[3];
+      pixels[0] = premultiplyChannel(pixels[0], alpha);
+      pixels[1] = premultiplyChannel(pixels[1], alpha);
+      pixels[2] = premultiplyChannel(pixels[2], alpha);
+      pixels += 4;
+    }
+  }
+
+  static void swizzleScalar(uint8_t* pixels, size_t pixelCount, const std::array<uint8_t, 4>& order) noexcept {
+    for (size_t i = 0; i < pixelCount; i++) {
+      uint8_t pixel[4] = { pixels[0], pixels[1], pixels[2], pixels[3] };
+      pixels[0] = pixel[order[0]];
+      pixels[1] = pixel[order[1]];
+      pixels[2] = pixel[order[2]];
+      pixels[3] = pixel[order[3]];
+      pixels += 4;
+    }
+  }
+
+  static TextureAlphaMode classifyAlphaScalar(const uint8_t* pixels, size_t pixelCount, bool hasTransparency) noexcept {
+    for (size_t i = 0; i < pixelCount; i++) {
+      auto alpha = pixels[i * 4 + 3];
+      if (alpha == 255) continue;
+      if (alpha != 0) return TextureAlphaMode::Translucent;
+
+      hasTransparency = true;
+    }
+
+    return hasTransparency ? TextureAlphaMode::Cutout : TextureAlphaMode::Opaque;
+  }
+
+  void PixelConverter::rgbToRgba(const uint8_t* source, uint8_t* destination, size_t pixelCount) noexcept {
+    size_t i = 0;
+
+#if defined(NOVELRT_PIXELCONVERTER_SSSE3)
+    //Each load reads four pixels and the first byte of a fifth, so stop while at least six pixels are left to keep the read in bounds.
+    auto spread = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    auto opaque = _mm_set1_epi32(static_cast<int32_t>(0xFF000000u));
+    for (; i + 6 <= pixelCount; i += 4) {
+      auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 3));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 4), _mm_or_si128(_mm_shuffle_epi8(pixels, spread), opaque));
+    }
+#elif defined(NOVELRT_PIXELCONVERTER_SSE2)
+    //Without a byte shuffle, each pixel is read as four bytes and the stray fourth byte is overwritten by the alpha.
+    auto colourMask = _mm_set1_epi32(0x00FFFFFF);
+    auto opaque = _mm_set1_epi32(static_cast<int32_t>(0xFF000000u));
+    for (; i + 5 <= pixelCount; i += 4) {
+      int32_t pixel[4];
+      std::memcpy(&pixel[0], source + i * 3, 4);
+      std::memcpy(&pixel[1], source + i * 3 + 3, 4);
+      std::memcpy(&pixel[2], source + i * 3 + 6, 4);
+      std::memcpy(&pixel[3], source + i * 3 + 9, 4);
+      auto pixels = _mm_setr_epi32(pixel[0], pixel[1], pixel[2], pixel[3]);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 4), _mm_or_si128(_mm_and_si128(pixels, colourMask), opaque));
+    }
+#elif defined(NOVELRT_PIXELCONVERTER_NEON)
+    auto opaque = vdupq_n_u8(255);
+    for (; i + 16 <= pixelCount; i += 16) {
+      auto pixels = vld3q_u8(source + i * 3);
+      uint8x16x4_t result = {{ pixels.val[0], pixels.val[1], pixels.val[2], opaque }};
+      vst4q_u8(destination + i * 4, result);
+    }
+#endif
+
+    rgbToRgbaScalar(source + i * 3, destination + i * 4, pixelCount - i);
+  }
+
+  void PixelConverter::grayToRgba(const uint8_t* source, uint8_t* destination, size_t pixelCount) noexcept {
+    size_t i = 0;
+
+#if defined(NOVELRT_PIXELCONVERTER_SSE2)
+    auto opaque = _mm_set1_epi32(static_cast<int32_t>(0xFF000000u));
+    for (; i + 16 <= pixelCount; i += 16) {
+      auto gray = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+      auto lowPairs = _mm_unpacklo_epi8(gray, gray);
+      auto highPairs = _mm_unpackhi_epi8(gray, gray);
+      auto output = reinterpret_cast<__m128i*>(destination + i * 4);
+      _mm_storeu_si128(output, _mm_or_si128(_mm_unpacklo_epi16(lowPairs, lowPairs), opaque));
+      _mm_storeu_si128(output + 1, _mm_or_si128(_mm_unpackhi_epi16(lowPairs, lowPairs), opaque));
+      _mm_storeu_si128(output + 2, _mm_or_si128(_mm_unpacklo_epi16(highPairs, highPairs), opaque));
+      _mm_storeu_si128(output + 3, _mm_or_si128(_mm_unpackhi_epi16(highPairs, highPairs), opaque));
+    }
+#elif defined(NOVELRT_PIXELCONVERTER_NEON)
+    auto opaque = vdupq_n_u8(255);
+    for (; i + 16 <= pixelCount; i += 16) {
+      auto gray = vld1q_u8(source + i);
+      uint8x16x4_t result = {{ gray, gray, gray, opaque }};
+      vst4q_u8(destination + i * 4, result);
+    }
+#endif
+
+    grayToRgbaScalar(source + i, destination + i * 4, pixelCount - i);
+  }
+
+  void PixelConverter::grayAlphaToRgba(const uint8_t* source, uint8_t* destination, size_t pixelCount) noexcept {
+    size_t i = 0;
+
+#if defined(NOVELRT_PIXELCONVERTER_SSE2)
+    //Doubling the grey byte of each pixel gives "gg", and interleaving that with the original "ga" gives "ggga".
+    auto grayMask = _mm_set1_epi16(0x00FF);
+    for (; i + 8 <= pixelCount; i += 8) {
+      auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 2));
+      auto gray = _mm_and_si128(pixels, grayMask);
+      auto doubledGray = _mm_or_si128(gray, _mm_slli_epi16(gray, 8));
+      auto output = reinterpret_cast<__m128i*>(destination + i * 4);
+      _mm_storeu_si128(output, _mm_unpacklo_epi16(doubledGray, pixels));
+      _mm_storeu_si128(output + 1, _mm_unpackhi_epi16(doubledGray, pixels));
+    }
+#elif defined(NOVELRT_PIXELCONVERTER_NEON)
+    for (; i + 16 <= pixelCount; i += 16) {
+      auto pixels = vld2q_u8(source + i * 2);
+      uint8x16x4_t result = {{ pixels.val[0], pixels.val[0], pixels.val[0], pixels.val[1] }};
+      vst4q_u8(destination + i * 4, result);
+    }
+#endif
+
+    grayAlphaToRgbaScalar(source + i * 2, destination + i * 4, pixelCount - i);
+  }
+
+  void PixelConverter::premultiplyAlpha(uint8_t* pixels, size_t pixelCount) noexcept {
+    size_t i = 0;
+
+#if defined(NOVELRT_PIXELCONVERTER_SSE2)
+    auto zero = _mm_setzero_si128();
+    auto rounding = _mm_set1_epi16(128);
+    auto alphaMask = _mm_set1_epi32(static_cast<int32_t>(0xFF000000u));
+    for (; i + 4 <= pixelCount; i += 4) {
+      auto block = reinterpret_cast<__m128i*>(pixels + i * 4);
+      auto source = _mm_loadu_si128(block);
+      auto low = _mm_unpacklo_epi8(source, zero);
+      auto high = _mm_unpackhi_epi8(source, zero);
+      auto lowAlpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(low, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+      auto highAlpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(high, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+      low = _mm_add_epi16(_mm_mullo_epi16(low, lowAlpha), rounding);
+      high = _mm_add_epi16(_mm_mullo_epi16(high, highAlpha), rounding);
+      low = _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 8)), 8);
+      high = _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 8)), 8);
+      auto result = _mm_packus_epi16(low, high);
+      _mm_storeu_si128(block, _mm_or_si128(_mm_andnot_si128(alphaMask, result), _mm_and_si128(alphaMask, source)));
+    }
+#elif defined(NOVELRT_PIXELCONVERTER_NEON)
+    auto rounding = vdupq_n_u16(128);
+    for (; i + 16 <= pixelCount; i += 16) {
+      auto block = vld4q_u8(pixels + i * 4);
+      for (int channel = 0; channel < 3; channel++) {
+        auto low = vaddq_u16(vmull_u8(vget_low_u8(block.val[channel]), vget_low_u8(block.val[3])), rounding);
+        auto high = vaddq_u16(vmull_u8(vget_high_u8(block.val[channel]), vget_high_u8(block.val[3])), rounding);
+        block.val[channel] = vcombine_u8(vshrn_n_u16(vaddq_u16(low, vshrq_n_u16(low, 8)), 8), vshrn_n_u16(vaddq_u16(high, vshrq_n_u16(high, 8)), 8));
+      }
+      vst4q_u8(pixels + i * 4, block);
+    }
+#endif
+
+    premultiplyAlphaScalar(pixels + i * 4, pixelCount - i);
+  }
+
+  void PixelConverter::swizzle(uint8_t* pixels, size_t pixelCount, std::array<uint8_t, 4> order) noexcept {
+    for (auto& channel : order) {
+      channel &= 3;
+    }
+
+    size_t i = 0;
+
+#if defined(NOVELRT_PIXELCONVERTER_SSSE3)
+    alignas(16) int8_t shuffle[16];
+    for (int pixel = 0; pixel < 4; pixel++) {
+      for (int channel = 0; channel < 4; channel++) {
+        shuffle[pixel * 4 + channel] = static_cast<int8_t>(pixel * 4 + order[channel]);
+      }
+    }
+
+    auto mask = _mm_load_si128(reinterpret_cast<const __m128i*>(shuffle));
+    for (; i + 4 <= pixelCount; i += 4) {
+      auto block = reinterpret_cast<__m128i*>(pixels + i * 4);
+      _mm_storeu_si128(block, _mm_shuffle_epi8(_mm_loadu_si128(block), mask));
+    }
+#elif defined(NOVELRT_PIXELCONVERTER_SSE2)
+    //SSE2 has no byte shuffle, so only swapping red and blue, by far the most common order, gets a fast path.
+    if (order == std::array<uint8_t, 4>{ 2, 1, 0, 3 }) {
+      auto greenAlphaMask = _mm_set1_epi32(static_cast<int32_t>(0xFF00FF00u));
+      auto redBlueMask = _mm_set1_epi32(0x00FF00FF);
+      for (; i + 4 <= pixelCount; i += 4) {
+        auto block = reinterpret_cast<__m128i*>(pixels + i * 4);
+        auto source = _mm_loadu_si128(block);
+        auto redBlue = _mm_and_si128(source, redBlueMask);
+        auto swapped = _mm_or_si128(_mm_slli_epi32(redBlue, 16), _mm_srli_epi32(redBlue, 16));
+        _mm_storeu_si128(block, _mm_or_si128(_mm_and_si128(source, greenAlphaMask), swapped));
+      }
+    }
+#elif defined(NOVELRT_PIXELCONVERTER_NEON)
+    for (; i + 16 <= pixelCount; i += 16) {
+      auto block = vld4q_u8(pixels + i * 4);
+      uint8x16x4_t result = {{ block.val[order[0]], block.val[order[1]], block.val[order[2]], block.val[order[3]] }};
+      vst4q_u8(pixels + i * 4, result);
+    }
+#endif
+
+    swizzleScalar(pixels + i * 4, pixelCount - i, order);
+  }
+
+  TextureAlphaMode PixelConverter::classifyAlpha(const uint8_t* pixels, size_t pixelCount) noexcept {
+    size_t i = 0;
+    auto hasTransparency = false;
+
+#if defined(NOVELRT_PIXELCONVERTER_SSE2)
+    auto zero = _mm_setzero_si128();
+    auto alphaMask = _mm_set1_epi32(static_cast<int32_t>(0xFF000000u));
+    auto transparent = _mm_setzero_si128();
+    for (; i + 4 <= pixelCount; i += 4) {
+      auto alpha = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i * 4)), alphaMask);
+      auto isTransparent = _mm_cmpeq_epi32(alpha, zero);
+      if (_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi32(alpha, alphaMask), isTransparent)) != 0xFFFF) {
+        return TextureAlphaMode::Translucent;
+      }
+
+      transparent = _mm_or_si128(transparent, isTransparent);
+    }
+
+    hasTransparency = _mm_movemask_epi8(transparent) != 0;
+#elif defined(NOVELRT_PIXELCONVERTER_NEON)
+    auto opaqueAlpha = vdupq_n_u8(255);
+    auto transparent = vdupq_n_u8(0);
+    for (; i + 16 <= pixelCount; i += 16) {
+      auto alpha = vld4q_u8(pixels + i * 4).val[3];
+      auto isTransparent = vceqq_u8(alpha, vdupq_n_u8(0));
+      auto isEither = vreinterpretq_u64_u8(vorrq_u8(vceqq_u8(alpha, opaqueAlpha), isTransparent));
+      if ((vgetq_lane_u64(isEither, 0) & vgetq_lane_u64(isEither, 1)) != ~0ULL) {
+        return TextureAlphaMode::Translucent;
+      }
+
+      transparent = vorrq_u8(transparent, isTransparent);
+    }
+
+    auto transparentLanes = vreinterpretq_u64_u8(transparent);
+    hasTransparency = (vgetq_lane_u64(transparentLanes, 0) | vgetq_lane_u64(transparentLanes, 1)) != 0;
+#endif
+
+    return classifyAlphaScalar(pixels + i * 4, pixelCount - i, hasTransparency);
+  }
+
+  const char* PixelConverter::getInstructionSet() noexcept {
+#if defined(NOVELRT_PIXELCONVERTER_SSSE3)
+    return "SSSE3";
+#elif defined(NOVELRT_PIXELCONVERTER_SSE2)
+    return "SSE2";
+#elif defined(NOVELRT_PIXELCONVERTER_NEON)
+    return "NEON";
+#else
+    return "Scalar";
+#endif
+  }
+}
@@ -0,0 +1,157 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  static FILE* openFile(const std::string& file, const char* mode) {
+    FILE* cFile = nullptr;
+#if defined(__STDC_LIB_EXT1__) || defined(_MSC_VER)
+    if (fopen_s(&cFile, file.c_str(), mode) != 0) {
+      cFile = nullptr;
+    }
+#else
+    cFile = fopen(file.c_str(), mode);
+#endif
+    return cFile;
+  }
+
+  RgbaImage PngCodec::decodeFile(const std::string& file) {
+    RgbaImage image;
+    decodeFile(file, image);
+    return image;
+  }
+
+  void PngCodec::decodeFile(const std::string& file, RgbaImage& image) {
+    LoggingService logger(Utilities::Misc::CONSOLE_LOG_GFX);
+
+    auto cFile = openFile(file, "rb");
+    if (cFile == nullptr) {
+      logger.logError("Image file cannot be opened! Please ensure the path is correct and that the file is not locked.");
+      throw Exceptions::FileNotFoundException(file, "Unable to continue! File failed to load for texture. Please ensure the path is correct and that the file is not locked.");
+    }
+
+    auto png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr); //TODO: Figure out how the error function ptr works
+
+    if (png == nullptr) {
+      fclose(cFile);
+      logger.logError("Image file cannot be opened! Please ensure the path is correct and that the file is not locked.");
+      throw Exceptions::FileNotFoundException(file, "Unable to continue! File failed to load for texture. Please ensure the path is correct and that the file is not locked.");
+    }
+
+    auto info = png_create_info_struct(png);
+
+    if (info == nullptr) {
+      png_destroy_read_struct(&png, nullptr, nullptr);
+      fclose(cFile);
+      logger.logError("Image at path {} failed to provide an info struct! Aborting...", file);
+      throw Exceptions::IOException(file, "Unable to continue! File failed to provide an info struct.");
+    }
+
+    std::vector<png_bytep> rowPointers;
+
+    if (setjmp(png_jmpbuf(png))) { //This is how libpng does error handling.
+      png_destroy_read_struct(&png, &info, nullptr);
+      fclose(cFile);
+      logger.logError("Image at path {} appears to be corrupted! Aborting...", file);
+      throw Exceptions::IOException(file, "Unable to continue! File appears to be corrupted.");
+    }
+
+    png_init_io(png, cFile);
+    png_read_info(png, info);
+
+    ImageData data;
+    data.width = png_get_image_width(png, info);
+    data.height = png_get_image_height(png, info);
+    data.colourType = png_get_color_type(png, info);
+    data.bitDepth = png_get_bit_depth(png, info);
+
+    //libpng only has to bring every sample to 8 bits here. Rows are read in whatever layout that leaves, and PixelConverter
+    //expands them to RGBA for the whole image at once, which is much faster than libpng's per row filler and grey transforms.
+    if (data.bitDepth == 16) png_set_strip_16(png);
+
+    if (data.colourType == PNG_COLOR_TYPE_PALETTE) png_set_palette_to_rgb(png);
+
+    if (data.colourType == PNG_COLOR_TYPE_GRAY && data.bitDepth < 8) png_set_expand_gray_1_2_4_to_8(png);
+
+    if (png_get_valid(png, info, PNG_INFO_tRNS)) png_set_tRNS_to_alpha(png);
+
+    //Allows us to get the final image data, not interlaced.
+    png_set_interlace_handling(png);
+    png_read_update_info(png, info);
+
+    auto channels = static_cast<size_t>(png_get_channels(png, info));
+    auto pixelCount = static_cast<size_t>(data.width) * data.height;
+    image.width = data.width;
+    image.height = data.height;
+    image.pixels.resize(pixelCount * RgbaImage::BytesPerPixel);
+
+    //Narrower rows are packed into the end of the pixel buffer, so they can be expanded in place without a second buffer.
+    auto nativePixels = image.pixels.data() + (image.pixels.size() - pixelCount * channels);
+    rowPointers.resize(data.height);
+    for (uint32_t i = 0; i < data.height; i++) {
+      rowPointers[i] = nativePixels + static_cast<size_t>(i) * data.width * channels;
+    }
+
+    //Read all the rows (data will flow into the pixel buffer)
+    png_read_image(png, rowPointers.data());
+    png_read_end(png, info);  //Finish reading the file - this will also check for corruption
+
+    switch (channels) {
+      case 1:
+        PixelConverter::grayToRgba(nativePixels, image.pixels.data(), pixelCount);
+        break;
+      case 2:
+        PixelConverter::grayAlphaToRgba(nativePixels, image.pixels.data(), pixelCount);
+        break;
+      case 3:
+        PixelConverter::rgbToRgba(nativePixels, image.pixels.data(), pixelCount);
+        break;
+      default:
+        break;
+    }
+
+    png_destroy_read_struct(&png, &info, nullptr);
+    fclose(cFile);
+  }
+
+  void PngCodec::encodeFile(const std::string& file, const RgbaImage& image) {
+    LoggingService logger(Utilities::Misc::CONSOLE_LOG_GFX);
+
+    auto cFile = openFile(file, "wb");
+    if (cFile == nullptr) {
+      logger.logError("Image file {} cannot be opened for writing!", file);
+      throw Exceptions::IOException(file, "Unable to continue! File could not be opened for writing.");
+    }
+
+    auto png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+    auto info = png == nullptr ? nullptr : png_create_info_struct(png);
+
+    if (info == nullptr) {
+      png_destroy_write_struct(&png, nullptr);
+      fclose(cFile);
+      logger.logError("Failed to create the libpng write structs for {}.", file);
+      throw Exceptions::IOException(file, "Unable to continue! libpng could not be initialised for writing.");
+    }
+
+    std::vector<png_bytep> rowPointers(image.height);
+    for (uint32_t i = 0; i < image.height; i++) {
+      rowPointers[i] = const_cast<png_bytep>(image.getPixel(0, i));
+    }
+
+    if (setjmp(png_jmpbuf(png))) {
+      png_destroy_write_struct(&png, &info);
+      fclose(cFile);
+      logger.logError("Failed to encode the image at path {}.", file);
+      throw Exceptions::IOException(file, "Unable to continue! The image could not be encoded.");
+    }
+
+    png_init_io(png, cFile);
+    png_set_IHDR(png, info, image.width, image.height, 8, PNG_COLOR_TYPE_RGBA, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_write_info(png, info);
+    png_write_image(png, rowPointers.data());
+    png_write_end(png, nullptr);
+
+    png_destroy_write_struct(&png, &info);
+    fclose(cFile);
+  }
+}
@@ -0,0 +1,274 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  //See https://qoiformat.org/qoi-specification.pdf. Every pixel is either a run of the previous one, a slot of a 64 entry
+  //table of recently seen pixels, a small difference from the previous one, or stored as is.
+  static const uint8_t QOI_OP_INDEX = 0x00;
+  static const uint8_t QOI_OP_DIFF = 0x40;
+  static const uint8_t QOI_OP_LUMA = 0x80;
+  static const uint8_t QOI_OP_RUN = 0xC0;
+  static const uint8_t QOI_OP_RGB = 0xFE;
+  static const uint8_t QOI_OP_RGBA = 0xFF;
+  static const uint8_t QOI_OP_MASK = 0xC0;
+  static const uint8_t QOI_END_MARKER[] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+  static const size_t QOI_MAXIMUM_RUN = 62;
+  static const size_t QOI_MAXIMUM_PIXELS = 400'000'000;
+
+  struct QoiPixel {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+    uint8_t a;
+
+    inline bool operator==(const QoiPixel& other) const noexcept {
+      return r == other.r && g == other.g && b == other.b && a == other.a;
+    }
+
+    inline bool operator!=(const QoiPixel& other) const noexcept {
+      return !(*this == other);
+    }
+  };
+
+  static inline uint32_t getIndexSlot(const QoiPixel& pixel) noexcept {
+    return (pixel.r * 3u + pixel.g * 5u + pixel.b * 7u + pixel.a * 11u) % 64u;
+  }
+
+  static inline uint32_t readBigEndian(const uint8_t* data) noexcept {
+    return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) | (static_cast<uint32_t>(data[2]) << 8) | data[3];
+  }
+
+  static inline void writeBigEndian(uint8_t* data, uint32_t value) noexcept {
+    data[0] = static_cast<uint8_t>(value >> 24);
+    data[1] = static_cast<uint8_t>(value >> 16);
+    data[2] = static_cast<uint8_t>(value >> 8);
+    data[3] = static_cast<uint8_t>(value);
+  }
+
+  bool QoiCodec::tryReadHeader(const uint8_t* data, size_t size, uint32_t& width, uint32_t& height) noexcept {
+    if (size < HeaderSize + sizeof(QOI_END_MARKER) || std::memcmp(data, "qoif", 4) != 0) return false;
+
+    auto headerWidth = readBigEndian(data + 4);
+    auto headerHeight = readBigEndian(data + 8);
+    auto channels = data[12];
+    auto colourSpace = data[13];
+    if (headerWidth == 0 || headerHeight == 0 || (channels != 3 && channels != 4) || colourSpace > 1) return false;
+
+    //Each byte of chunk data can describe at most one run, so anything claiming more pixels than that is corrupted.
+    //Checking here keeps a damaged file from asking for gigabytes of pixels.
+    auto pixelCount = static_cast<uint64_t>(headerWidth) * headerHeight;
+    auto chunkBytes = static_cast<uint64_t>(size - HeaderSize - sizeof(QOI_END_MARKER));
+    if (pixelCount > QOI_MAXIMUM_PIXELS || pixelCount > chunkBytes * QOI_MAXIMUM_RUN) return false;
+
+    width = headerWidth;
+    height = headerHeight;
+    return true;
+  }
+
+  bool QoiCodec::tryDecode(const uint8_t* data, size_t size, uint8_t* destination) noexcept {
+    uint32_t width;
+    uint32_t height;
+    if (!tryReadHeader(data, size, width, height)) return false;
+
+    QoiPixel index[64] = {};
+    QoiPixel pixel = { 0, 0, 0, 255 };
+
+    //The end marker is eight bytes long and no chunk is longer than five, so a chunk that starts before the marker can be
+    //read in full without checking again.
+    auto chunk = data + HeaderSize;
+    auto chunkEnd = data + size - sizeof(QOI_END_MARKER);
+    auto output = destination;
+    auto outputEnd = destination + static_cast<size_t>(width) * height * RgbaImage::BytesPerPixel;
+
+    while (output < outputEnd) {
+      if (chunk >= chunkEnd) return false;
+
+      auto op = *chunk++;
+      if (op == QOI_OP_RGB) {
+        pixel.r = chunk[0];
+        pixel.g = chunk[1];
+        pixel.b = chunk[2];
+        chunk += 3;
+      }
+      else if (op == QOI_OP_RGBA) {
+        pixel.r = chunk[0];
+        pixel.g = chunk[1];
+        pixel.b = chunk[2];
+        pixel.a = chunk[3];
+        chunk += 4;
+      }
+      else {
+        switch (op & QOI_OP_MASK) {
+          case QOI_OP_INDEX:
+            pixel = index[op];
+            break;
+          case QOI_OP_DIFF:
+            pixel.r = static_cast<uint8_t>(pixel.r + ((op >> 4) & 0x03) - 2);
+            pixel.g = static_cast<uint8_t>(pixel.g + ((op >> 2) & 0x03) - 2);
+            pixel.b = static_cast<uint8_t>(pixel.b + (op & 0x03) - 2);
+            break;
+          case QOI_OP_LUMA: {
+            auto greenDifference = (op & 0x3F) - 32;
+            auto redBlue = *chunk++;
+            pixel.r = static_cast<uint8_t>(pixel.r + greenDifference - 8 + ((redBlue >> 4) & 0x0F));
+            pixel.g = static_cast<uint8_t>(pixel.g + greenDifference);
+            pixel.b = static_cast<uint8_t>(pixel.b + greenDifference - 8 + (redBlue & 0x0F));
+            break;
+          }
+          case QOI_OP_RUN:
+          default: {
+            //The run repeats the previous pixel, so the pixel itself does not change. It still goes into the index below,
+            //because the very first pixel of an image is only ever written there by a run.
+            auto runEnd = std::min(output + (static_cast<size_t>(op & 0x3F) + 1) * RgbaImage::BytesPerPixel, outputEnd);
+            for (; output < runEnd; output += RgbaImage::BytesPerPixel) {
+              std::memcpy(output, &pixel, sizeof(pixel));
+            }
+
+            index[getIndexSlot(pixel)] = pixel;
+            continue;
+          }
+        }
+      }
+
+      index[getIndexSlot(pixel)] = pixel;
+      std::memcpy(output, &pixel, sizeof(pixel));
+      output += RgbaImage::BytesPerPixel;
+    }
+
+    return true;
+  }
+
+  RgbaImage QoiCodec::decodeFile(const std::string& file) {
+    RgbaImage image;
+    decodeFile(file, image);
+    return image;
+  }
+
+  void QoiCodec::decodeFile(const std::string& file, RgbaImage& image) {
+    Utilities::MemoryMappedFile mappedFile(file);
+    LoggingService logger(Utilities::Misc::CONSOLE_LOG_GFX);
+
+    uint32_t width;
+    uint32_t height;
+    if (!tryReadHeader(mappedFile.getData(), mappedFile.getSize(), width, height)) {
+      logger.logError("Image at path {} is not a valid QOI file! Aborting...", file);
+      throw Exceptions::IOException(file, "Unable to continue! File is not a valid QOI image.");
+    }
+
+    image.width = width;
+    image.height = height;
+    image.pixels.resize(static_cast<size_t>(width) * height * RgbaImage::BytesPerPixel);
+
+    if (!tryDecode(mappedFile.getData(), mappedFile.getSize(), image.pixels.data())) {
+      logger.logError("Image at path {} appears to be corrupted! Aborting...", file);
+      throw Exceptions::IOException(file, "Unable to continue! File appears to be corrupted.");
+    }
+  }
+
+  std::vector<uint8_t> QoiCodec::encode(const RgbaImage& image) {
+    if (image.width == 0 || image.height == 0) {
+      LoggingService logger(Utilities::Misc::CONSOLE_LOG_GFX);
+      logger.logError("Cannot encode an empty image as QOI.");
+      throw Exceptions::InvalidOperationException("Unable to continue! The image to encode is empty.");
+    }
+
+    auto pixelCount = static_cast<size_t>(image.width) * image.height;
+
+    //Sized for the worst case, where every pixel is stored in full, then trimmed once the real size is known.
+    std::vector<uint8_t> result(HeaderSize + pixelCount * 5 + sizeof(QOI_END_MARKER));
+    auto output = result.data();
+
+    std::memcpy(output, "qoif", 4);
+    writeBigEndian(output + 4, image.width);
+    writeBigEndian(output + 8, image.height);
+    output[12] = 4;
+    output[13] = 0;
+    output += HeaderSize;
+
+    QoiPixel index[64] = {};
+    QoiPixel previous = { 0, 0, 0, 255 };
+    size_t run = 0;
+
+    for (size_t i = 0; i < pixelCount; i++) {
+      QoiPixel pixel;
+      std::memcpy(&pixel, image.pixels.data() + i * RgbaImage::BytesPerPixel, sizeof(pixel));
+
+      if (pixel == previous) {
+        run++;
+        if (run == QOI_MAXIMUM_RUN || i == pixelCount - 1) {
+          *output++ = static_cast<uint8_t>(QOI_OP_RUN | (run - 1));
+          run = 0;
+        }
+
+        continue;
+      }
+
+      if (run > 0) {
+        *output++ = static_cast<uint8_t>(QOI_OP_RUN | (run - 1));
+        run = 0;
+      }
+
+      auto slot = getIndexSlot(pixel);
+      if (index[slot] == pixel) {
+        *output++ = static_cast<uint8_t>(QOI_OP_INDEX | slot);
+      }
+      else {
+        index[slot] = pixel;
+
+        if (pixel.a == previous.a) {
+          auto redDifference = static_cast<int8_t>(pixel.r - previous.r);
+          auto greenDifference = static_cast<int8_t>(pixel.g - previous.g);
+          auto blueDifference = static_cast<int8_t>(pixel.b - previous.b);
+          auto redGreenDifference = redDifference - greenDifference;
+          auto blueGreenDifference = blueDifference - greenDifference;
+
+          if (redDifference > -3 && redDifference < 2 && greenDifference > -3 && greenDifference < 2 && blueDifference > -3 && blueDifference < 2) {
+            *output++ = static_cast<uint8_t>(QOI_OP_DIFF | ((redDifference + 2) << 4) | ((greenDifference + 2) << 2) | (blueDifference + 2));
+          }
+          else if (redGreenDifference > -9 && redGreenDifference < 8 && greenDifference > -33 && greenDifference < 32 &&
+            blueGreenDifference > -9 && blueGreenDifference < 8) {
+            *output++ = static_cast<uint8_t>(QOI_OP_LUMA | (greenDifference + 32));
+            *output++ = static_cast<uint8_t>(((redGreenDifference + 8) << 4) | (blueGreenDifference + 8));
+          }
+          else {
+            *output++ = QOI_OP_RGB;
+            *output++ = pixel.r;
+            *output++ = pixel.g;
+            *output++ = pixel.b;
+          }
+        }
+        else {
+          *output++ = QOI_OP_RGBA;
+          *output++ = pixel.r;
+          *output++ = pixel.g;
+          *output++ = pixel.b;
+          *output++ = pixel.a;
+        }
+      }
+
+      previous = pixel;
+    }
+
+    std::memcpy(output, QOI_END_MARKER, sizeof(QOI_END_MARKER));
+    output += sizeof(QOI_END_MARKER);
+    result.resize(static_cast<size_t>(output - result.data()));
+    return result;
+  }
+
+  void QoiCodec::encodeFile(const std::string& file, const RgbaImage& image) {
+    auto bytes = encode(image);
+
+    std::ofstream stream(file, std::ios::out | std::ios::binary | std::ios::trunc);
+    stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!stream) {
+      LoggingService logger(Utilities::Misc::CONSOLE_LOG_GFX);
+      logger.logError("Image file {} could not be written.", file);
+      throw Exceptions::IOException(file, "Unable to continue! The image could not be written.");
+    }
+  }
+
+  bool QoiCodec::isQoiFile(const std::string& file) {
+    return std::filesystem::path(file).extension() == ".qoi";
+  }
+}
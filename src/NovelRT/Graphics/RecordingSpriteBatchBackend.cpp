@@ -0,0 +1,28 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  RecordingSpriteBatchBackend::RecordingSpriteBatchBackend() noexcept :
+    _recordedGroups(),
+    _recordedInstances(),
+    _submissionCount(0) {}
+
+  void RecordingSpriteBatchBackend::submit(const std::vector<SpriteInstanceData>& instances, const std::vector<SpriteBatchGroup>& groups) {
+    auto instanceOffset = _recordedInstances.size();
+    _recordedInstances.insert(_recordedInstances.end(), instances.begin(), instances.end());
+
+    for (auto group : groups) {
+      group.firstInstance += instanceOffset;
+      _recordedGroups.push_back(group);
+    }
+
+    _submissionCount++;
+  }
+
+  void RecordingSpriteBatchBackend::reset() noexcept {
+    _recordedGroups.clear();
+    _recordedInstances.clear();
+    _submissionCount = 0;
+  }
+}
@@ -0,0 +1,73 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  RenderCommandList::RenderCommandList() noexcept :
+    _commands(),
+    _spriteInstances(),
+    _shapeVertices() {}
+
+  void RenderCommandList::beginPass(RenderPass pass) {
+    RenderCommand command;
+    command.type = RenderCommandType::BeginPass;
+    command.pass = pass;
+    _commands.push_back(command);
+  }
+
+  SpriteInstanceData& RenderCommandList::addSprite(GLuint shaderProgramId, const std::shared_ptr<Texture>& texture) {
+    return *addSprites(shaderProgramId, texture, 1);
+  }
+
+  SpriteInstanceData* RenderCommandList::addSprites(GLuint shaderProgramId, const std::shared_ptr<Texture>& texture, size_t count) {
+    auto isMergeable = !_commands.empty()
+      && _commands.back().type == RenderCommandType::DrawSprites
+      && _commands.back().shaderProgramId == shaderProgramId
+      && _commands.back().texture == texture;
+
+    if (!isMergeable) {
+      RenderCommand command;
+      command.type = RenderCommandType::DrawSprites;
+      command.shaderProgramId = shaderProgramId;
+      command.texture = texture;
+      command.first = _spriteInstances.size();
+      _commands.push_back(command);
+    }
+
+    _commands.back().count += count;
+    _spriteInstances.resize(_spriteInstances.size() + count);
+    return _spriteInstances.data() + (_spriteInstances.size() - count);
+  }
+
+  ShapeVertex* RenderCommandList::addShapeVertices(GLuint shaderProgramId, size_t count) {
+    auto isMergeable = !_commands.empty()
+      && _commands.back().type == RenderCommandType::DrawShapes
+      && _commands.back().shaderProgramId == shaderProgramId;
+
+    if (!isMergeable) {
+      RenderCommand command;
+      command.type = RenderCommandType::DrawShapes;
+      command.shaderProgramId = shaderProgramId;
+      command.first = _shapeVertices.size();
+      _commands.push_back(command);
+    }
+
+    _commands.back().count += count;
+    _shapeVertices.resize(_shapeVertices.size() + count);
+    return _shapeVertices.data() + (_shapeVertices.size() - count);
+  }
+
+  void RenderCommandList::addObject(RenderObject* object) {
+    RenderCommand command;
+    command.type = RenderCommandType::DrawObject;
+    command.object = object;
+    _commands.push_back(command);
+  }
+
+  void RenderCommandList::clear() noexcept {
+    //Clearing the commands also lets go of the textures they held on to.
+    _commands.clear();
+    _spriteInstances.clear();
+    _shapeVertices.clear();
+  }
+}
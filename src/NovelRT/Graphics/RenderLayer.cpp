@@ -0,0 +1,166 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  RenderLayer::RenderLayer(int32_t layer, ShaderProgram shaderProgram, std::shared_ptr<Camera> camera, std::shared_ptr<RenderingService> renderer) :
+    RenderObject(Transform(), layer, shaderProgram, camera, renderer),
+    _renderQueue(&renderer->getSpriteBatch(), &renderer->getShapeBatch(), &renderer->getWorkerPool()),
+    _isRetained(true),
+    _needsRebuild(true),
+    _rebuildCount(0),
+    _texture(nullptr),
+    _framebuffer(Utilities::Lazy<GLuint>(std::function<GLuint()>([] {
+      GLuint tempHandle;
+      glGenFramebuffers(1, &tempHandle);
+      return tempHandle;
+    }))),
+    _depthBuffer(Utilities::Lazy<GLuint>(std::function<GLuint()>([] {
+      GLuint tempHandle;
+      glGenRenderbuffers(1, &tempHandle);
+      return tempHandle;
+    }))),
+    _instanceData(),
+    _logger(Utilities::Misc::CONSOLE_LOG_GFX) {
+    //Blending stays on for both passes in here. Opaque sprites blend to the same colour anyway, and the alpha they accumulate
+    //is what lets the layer's texture be composited.
+    _renderQueue.PassStarted += ([this](auto pass) {
+        _renderer->getSpriteBatch().flush();
+        _renderer->getShapeBatch().flush();
+        _renderer->getGLStateCache().depthMask(pass == RenderPass::Opaque ? GL_TRUE : GL_FALSE);
+      });
+  }
+
+  void RenderLayer::submit(RenderObject* object, int32_t layer, bool isTranslucent, GLuint shaderProgramId, GLuint textureId) {
+    _renderQueue.submit(object, layer, isTranslucent, shaderProgramId, textureId);
+  }
+
+  void RenderLayer::cancel(const RenderObject* object) noexcept {
+    _renderQueue.cancel(object);
+  }
+
+  void RenderLayer::setRetained(bool value) noexcept {
+    if (_isRetained == value) return;
+
+    _isRetained = value;
+    _needsRebuild = true;
+  }
+
+  void RenderLayer::submitComposite(Maths::GeoBounds visibleBounds) {
+    if (!_isRetained || _renderQueue.getPendingCount() == 0) return;
+
+    const auto& current = std::as_const(*this).transform();
+    if (current.position != visibleBounds.position || current.scale != visibleBounds.size) {
+      auto& target = transform();
+      target.position = visibleBounds.position;
+      target.scale = visibleBounds.size;
+    }
+
+    executeObjectBehaviour();
+  }
+
+  bool RenderLayer::render(const SpatialIndex* cullingIndex, Maths::GeoVector2F targetSize, GLuint mainFramebuffer, bool forceRebuild) {
+    //A member that joined, left, was shown, hidden or moved to another layer changes the picture as surely as a dirty one does.
+    if (!_renderQueue.matchesLastSubmissions()) {
+      _needsRebuild = true;
+    }
+
+    if (!_isRetained || _renderQueue.getPendingCount() == 0) {
+      _renderQueue.clear();
+      return false;
+    }
+
+    if (_texture == nullptr || _texture->getSize() != targetSize) {
+      resizeTarget(static_cast<uint32_t>(targetSize.x), static_cast<uint32_t>(targetSize.y));
+      _needsRebuild = true;
+    }
+
+    if (!_needsRebuild && !forceRebuild) {
+      _renderQueue.clear();
+      return false;
+    }
+
+    auto& glState = _renderer->getGLStateCache();
+    glBindFramebuffer(GL_FRAMEBUFFER, _framebuffer.getActual());
+    glState.depthMask(GL_TRUE);
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+
+    //Blending straight alpha over a transparent target would multiply alpha by itself, so alpha is accumulated separately and
+    //the texture ends up premultiplied. The composite shader divides it back out.
+    glState.blendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    _renderQueue.execute(cullingIndex);
+    _renderer->getSpriteBatch().flush();
+    _renderer->getShapeBatch().flush();
+    glState.blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, mainFramebuffer);
+    _needsRebuild = false;
+    _rebuildCount++;
+    return true;
+  }
+
+  void RenderLayer::resizeTarget(uint32_t width, uint32_t height) {
+    //Immutable storage cannot change size, so a resized layer gets a new texture and the old one goes once the last frame using it is done.
+    _texture = _renderer->getTexture();
+    _texture->allocateRenderTarget(width, height);
+
+    glBindRenderbuffer(GL_RENDERBUFFER, _depthBuffer.getActual());
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, static_cast<GLsizei>(width), static_cast<GLsizei>(height));
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, _framebuffer.getActual());
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _texture->getTextureIdInternal(), 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, _depthBuffer.getActual());
+
+    auto status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+      _logger.logError("A render layer's framebuffer is incomplete. Status: {:#x}", status);
+      throw Exceptions::InitialisationFailureException("Unable to continue! A render layer's framebuffer could not be created.", static_cast<int32_t>(status));
+    }
+  }
+
+  void RenderLayer::drawObject() {
+    if (!getActive() || _texture == nullptr) return;
+
+    _instanceData.transform = getModelMatrix();
+    _renderer->getShapeBatch().flush();
+    _renderer->getSpriteBatch().submit(_shaderProgram.shaderProgramId, _texture, _instanceData);
+  }
+
+  void RenderLayer::recordCommands(RenderCommandList& commands) {
+    if (!getActive() || _texture == nullptr) return;
+
+    auto& instance = commands.addSprite(_shaderProgram.shaderProgramId, _texture);
+    instance = _instanceData;
+    instance.transform = getModelMatrix();
+  }
+
+  void RenderLayer::configureObjectBuffers() {
+    //GL stores the bottom row of a framebuffer first, whereas textures loaded from images start at the top, so sample it upside down.
+    _instanceData.uvRect = Maths::GeoVector4F(0.0f, 1.0f, 1.0f, -1.0f);
+    _instanceData.colourTint = Maths::GeoVector4F(1.0f, 1.0f, 1.0f, 1.0f);
+  }
+
+  bool RenderLayer::isTranslucent() const noexcept {
+    return true;
+  }
+
+  GLuint RenderLayer::getSortTextureId() noexcept {
+    return _texture == nullptr ? 0 : _texture->getTextureIdInternal();
+  }
+
+  RenderLayer::~RenderLayer() {
+    _renderer->handleRenderLayerPreDestruction(this);
+
+    if (_framebuffer.isCreated()) {
+      auto framebuffer = _framebuffer.getActual();
+      glDeleteFramebuffers(1, &framebuffer);
+    }
+
+    if (_depthBuffer.isCreated()) {
+      auto depthBuffer = _depthBuffer.getActual();
+      glDeleteRenderbuffers(1, &depthBuffer);
+    }
+  }
+}
@@ -4,83 +4,100 @@
 
 namespace NovelRT::Graphics {
 
-  RenderObject::RenderObject(Transform transform, int32_t layer, ShaderProgram shaderProgram, std::shared_ptr<Camera> camera) :
+  RenderObject::RenderObject(Transform transform, int32_t layer, ShaderProgram shaderProgram, std::shared_ptr<Camera> camera, std::shared_ptr<RenderingService> renderer) :
     WorldObject(transform, layer),
-    _vertexBuffer(Utilities::Lazy<GLuint>(std::function<GLuint()>(generateStandardBuffer))),
-    _vertexArrayObject(Utilities::Lazy<GLuint>(std::function<GLuint()>([] {
-    GLuint tempVao;
-    glGenVertexArrays(1, &tempVao);
-    return tempVao;
-      }))),
+    _visibleCullId(0),
+    _transformHandle(renderer == nullptr ? TransformStore::InvalidHandle : renderer->getTransformStore().allocate()),
     _shaderProgram(shaderProgram),
     _bufferInitialised(false),
     _camera(camera),
-    _finalViewMatrixData(Utilities::Lazy<Maths::GeoMatrix4x4F>(std::function<Maths::GeoMatrix4x4F()>(std::bind(&RenderObject::generateViewData, this)))){}
+    _renderer(renderer),
+    _renderLayer(nullptr) {
+    _isDirty = true;
+  }
 
   void RenderObject::executeObjectBehaviour() {
-    if (_camera->getFrameState() != CameraFrameState::Unmodified) _isDirty = true;
-
+    //Camera changes are picked up by the per-frame camera UBO, so only our own transform can make us dirty.
     if (_isDirty) {
-      _finalViewMatrixData.reset();
+      const auto& objectTransform = std::as_const(*this).transform();
+      _renderer->getTransformStore().set(_transformHandle, objectTransform.position, objectTransform.rotation, getModelScale(), static_cast<float>(layer()));
       _bufferInitialised = false;
       _isDirty = false;
     }
 
     if (!_bufferInitialised) {
       configureObjectBuffers();
+      _renderer->getSpatialIndex().update(this, getCullingBounds());
       _bufferInitialised = true;
+
+      //Anything that makes us reconfigure changes what is drawn, and neither retained layers nor idle frames redraw unless told to.
+      _renderer->invalidateFrame();
+      if (_renderLayer != nullptr) {
+        _renderLayer->invalidate();
+      }
     }
-    drawObject();
+
+    if (_renderLayer != nullptr && _renderLayer->isRetained()) {
+      _renderLayer->submit(this, layer(), isTranslucent(), _shaderProgram.shaderProgramId, getSortTextureId());
+      return;
+    }
+
+    _renderer->getRenderQueue().submit(this, layer(), isTranslucent(), _shaderProgram.shaderProgramId, getSortTextureId());
   }
 
-  void RenderObject::configureObjectBuffers() {
-    auto topLeft = Maths::GeoVector2F(-0.5f, 0.5f);
-    auto bottomRight = Maths::GeoVector2F(0.5f, -0.5f);
-    auto topRight = Maths::GeoVector2F(0.5f, 0.5f);
-    auto bottomLeft = Maths::GeoVector2F(-0.5f, -0.5f);
-    _vertexBufferData = {
-        topLeft.x, topLeft.y, 0.0f,
-        bottomRight.x, bottomRight.y, 0.0f,
-        topRight.x, topRight.y, 0.0f,
-        topLeft.x, topLeft.y, 0.0f,
-        bottomLeft.x, bottomLeft.y, 0.0f,
-        bottomRight.x, bottomRight.y, 0.0f,
-    };
-
-    _vertexArrayObject.getActual(); //this is just here to force initialisation.
-
-    // The following commands will talk about our 'vertexbuffer' buffer
-    glBindBuffer(GL_ARRAY_BUFFER, _vertexBuffer.getActual());
-
-    // Give our vertices to OpenGL.
-    glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * _vertexBufferData.size(), _vertexBufferData.data(), GL_STATIC_DRAW);
+  void RenderObject::setRenderLayer(std::shared_ptr<RenderLayer> value) {
+    if (_renderLayer == value) return;
+
+    if (_renderLayer != nullptr) {
+      _renderLayer->cancel(this);
+    }
+
+    if (_renderer != nullptr) {
+      _renderer->getRenderQueue().cancel(this);
+    }
+
+    _renderLayer = value;
   }
 
-  RenderObject::~RenderObject() {
-    if (!_vertexArrayObject.isCreated()) return;
+  Maths::GeoBounds RenderObject::getCullingBounds() const {
+    auto bounds = transform().getAABB();
+    if (transform().rotation != 0.0f) {
+      //getAABB ignores rotation, and a rotated square can reach up to sqrt(2) times further out than an upright one.
+      bounds.size = bounds.size * 1.41421356f;
+    }
+
+    return bounds;
+  }
 
-    auto vao = _vertexArrayObject.getActual();
-    glDeleteVertexArrays(1, &vao);
+  void RenderObject::recordCommands(RenderCommandList& commands) {
+    commands.addObject(this);
   }
 
-  GLuint RenderObject::generateStandardBuffer() {
-    GLuint tempBuffer;
-    glGenBuffers(1, &tempBuffer);
-    return tempBuffer;
+  bool RenderObject::isTranslucent() const noexcept {
+    return false;
   }
 
-  Maths::GeoMatrix4x4F RenderObject::generateViewData() {
-    auto position = *reinterpret_cast<glm::vec2*>(&(transform().position));
-    auto defaultIdentity = Maths::GeoMatrix4x4F::getDefaultIdentity();
-    auto resultMatrix = *reinterpret_cast<glm::mat4*>(&defaultIdentity);
-    resultMatrix = glm::translate(resultMatrix, glm::vec3(position, layer()));
-    resultMatrix = glm::rotate(resultMatrix, glm::radians(transform().rotation), glm::vec3(0.0f, 0.0f, 1.0f));
-    resultMatrix = glm::scale(resultMatrix, glm::vec3(*reinterpret_cast<glm::vec2*>(&(transform().scale)), 1.0f));
-    auto cameraUboMatrix = _camera->getCameraUboMatrix();
-    return Maths::GeoMatrix4x4F(glm::transpose(*reinterpret_cast<glm::mat4*>(&cameraUboMatrix) * resultMatrix));
+  GLuint RenderObject::getSortTextureId() noexcept {
+    return 0;
   }
 
-  Maths::GeoMatrix4x4F RenderObject::generateCameraBlock() {
-    return _camera->getCameraUboMatrix();
+  Maths::GeoVector2F RenderObject::getModelScale() const {
+    return transform().scale;
+  }
+
+  const Maths::GeoMatrix4x4F& RenderObject::getModelMatrix() {
+    return _renderer->getTransformStore().getModelMatrix(_transformHandle);
+  }
+
+  RenderObject::~RenderObject() {
+    if (_renderLayer != nullptr) {
+      _renderLayer->cancel(this);
+    }
+
+    if (_renderer == nullptr) return;
+
+    _renderer->getRenderQueue().cancel(this);
+    _renderer->getSpatialIndex().remove(this);
+    _renderer->getTransformStore().release(_transformHandle);
   }
 }
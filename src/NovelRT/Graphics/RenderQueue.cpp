@@ -0,0 +1,303 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  RenderQueue::RenderQueue(SpriteBatch* spriteBatch, ShapeBatch* shapeBatch, RenderWorkerPool* workerPool) noexcept :
+    _spriteBatch(spriteBatch),
+    _shapeBatch(shapeBatch),
+    _workerPool(workerPool),
+    _entries(),
+    _scratch(),
+    _submissions(),
+    _lastSubmissions(),
+    _commandLists(),
+    _chunkStatistics(),
+    _recordedListCount(0),
+    _hasSubmissionChanged(false),
+    _isExecuting(false),
+    _submittedCount(0),
+    _culledCount(0),
+    _stateChangeCount(0),
+    _opaqueOverdraw(0.0f),
+    _translucentOverdraw(0.0f),
+    _lastSortTime(Timing::Timestamp::zero()),
+    _lastRecordTime(Timing::Timestamp::zero()),
+    PassStarted() {}
+
+  static Timing::Timestamp getTimeSince(std::chrono::steady_clock::time_point start) noexcept {
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    return Timing::Timestamp(static_cast<uint64_t>(duration.count()) / (1'000'000'000 / Timing::TicksPerSecond));
+  }
+
+  static uint32_t countStateChanges(uint64_t previousKey, uint64_t key) noexcept {
+    uint32_t count = 0;
+    if (RenderQueue::getShaderProgramId(key) != RenderQueue::getShaderProgramId(previousKey)) count++;
+    if (RenderQueue::getTextureId(key) != RenderQueue::getTextureId(previousKey)) count++;
+    return count;
+  }
+
+  static float getCoveredArea(Maths::GeoBounds bounds, Maths::GeoBounds view) noexcept {
+    auto minimum = bounds.position - bounds.getExtents();
+    auto maximum = bounds.position + bounds.getExtents();
+    auto viewMinimum = view.position - view.getExtents();
+    auto viewMaximum = view.position + view.getExtents();
+
+    auto width = std::min(maximum.x, viewMaximum.x) - std::max(minimum.x, viewMinimum.x);
+    auto height = std::min(maximum.y, viewMaximum.y) - std::max(minimum.y, viewMinimum.y);
+    return width > 0.0f && height > 0.0f ? width * height : 0.0f;
+  }
+
+  uint64_t RenderQueue::createSortKey(int32_t layer, bool isTranslucent, GLuint shaderProgramId, GLuint textureId, uint32_t sequence) noexcept {
+    //Layers are biased into an unsigned range. Layer 0 is nearest the camera, so opaque objects keep that order and draw front to
+    //back, while translucent objects invert it and draw back to front.
+    auto clampedLayer = std::clamp(layer, static_cast<int32_t>(std::numeric_limits<int16_t>::min()), static_cast<int32_t>(std::numeric_limits<int16_t>::max()));
+    auto layerField = isTranslucent
+      ? static_cast<uint64_t>(std::numeric_limits<int16_t>::max() - clampedLayer)
+      : static_cast<uint64_t>(clampedLayer - std::numeric_limits<int16_t>::min());
+
+    auto sequenceField = std::min<uint64_t>(sequence, (1ULL << SequenceBits) - 1);
+
+    uint64_t key = isTranslucent ? 1ULL : 0ULL;
+    key = (key << LayerBits) | layerField;
+    key = (key << ShaderBits) | (shaderProgramId & ((1ULL << ShaderBits) - 1));
+    key = (key << TextureBits) | (textureId & ((1ULL << TextureBits) - 1));
+    key = (key << SequenceBits) | sequenceField;
+    return key;
+  }
+
+  void RenderQueue::sortEntries(std::vector<Entry>& entries, std::vector<Entry>& scratch) {
+    if (entries.size() < 2) return;
+
+    scratch.resize(entries.size());
+
+    //Bytes that never change across the keys cannot affect the order, so find them up front and skip their passes.
+    uint64_t differingBits = 0;
+    for (auto& entry : entries) {
+      differingBits |= entry.key ^ entries[0].key;
+    }
+
+    auto* source = &entries;
+    auto* destination = &scratch;
+
+    for (uint32_t shift = 0; shift < 64; shift += 8) {
+      if (((differingBits >> shift) & 0xFF) == 0) continue;
+
+      std::array<size_t, 256> offsets{};
+      for (auto& entry : *source) {
+        offsets[(entry.key >> shift) & 0xFF]++;
+      }
+
+      size_t total = 0;
+      for (auto& offset : offsets) {
+        auto count = offset;
+        offset = total;
+        total += count;
+      }
+
+      for (auto& entry : *source) {
+        (*destination)[offsets[(entry.key >> shift) & 0xFF]++] = entry;
+      }
+
+      std::swap(source, destination);
+    }
+
+    if (source != &entries) {
+      entries.swap(scratch);
+    }
+  }
+
+  void RenderQueue::submit(RenderObject* object, int32_t layer, bool isTranslucent, GLuint shaderProgramId, GLuint textureId) {
+    if (_isExecuting) {
+      object->drawObject();
+      return;
+    }
+
+    auto key = createSortKey(layer, isTranslucent, shaderProgramId, textureId, static_cast<uint32_t>(_entries.size()));
+    _entries.push_back(Entry{key, object});
+
+    //Objects submit in the same order every frame while nothing changes, so comparing against the last list in step is enough.
+    Submission submission{object, key, object->getActive()};
+    auto index = _submissions.size();
+    if (index >= _lastSubmissions.size() || !(_lastSubmissions[index] == submission)) {
+      _hasSubmissionChanged = true;
+    }
+
+    _submissions.push_back(submission);
+  }
+
+  void RenderQueue::rememberSubmissions() noexcept {
+    _lastSubmissions.swap(_submissions);
+    _submissions.clear();
+    _hasSubmissionChanged = false;
+  }
+
+  void RenderQueue::cancel(const RenderObject* object) noexcept {
+    //Another object may take over the cancelled one's address, so it must not be mistaken for the same submission later on.
+    _hasSubmissionChanged = true;
+
+    //A cancelled entry keeps its place in the queue but is skipped, which is cheaper than erasing from the middle.
+    for (auto& entry : _entries) {
+      if (entry.object == object) {
+        entry.object = nullptr;
+      }
+    }
+  }
+
+  void RenderQueue::recordChunk(size_t first, size_t last, const SpatialIndex* cullingIndex, Maths::GeoBounds view, RenderCommandList& commands,
+    ChunkStatistics& statistics) {
+    statistics = ChunkStatistics{0, 0, 0, 0.0f, 0.0f, nullptr, nullptr};
+    auto canRecordBatches = _spriteBatch != nullptr && _shapeBatch != nullptr;
+
+    for (auto index = first; index < last; index++) {
+      const auto& entry = _entries[index];
+      if (entry.object == nullptr) continue;
+
+      if (cullingIndex != nullptr && !cullingIndex->isVisible(entry.object)) {
+        statistics.culledCount++;
+        continue;
+      }
+
+      //Every list starts its own pass, as the list before it may have ended in either one. Replaying skips the repeats.
+      auto pass = getRenderPass(entry.key);
+      if (statistics.lastDrawn == nullptr || pass != getRenderPass(statistics.lastDrawn->key)) {
+        commands.beginPass(pass);
+      }
+
+      if (statistics.lastDrawn != nullptr) {
+        statistics.stateChangeCount += countStateChanges(statistics.lastDrawn->key, entry.key);
+      }
+
+      if (cullingIndex != nullptr) {
+        (pass == RenderPass::Opaque ? statistics.opaqueArea : statistics.translucentArea) += getCoveredArea(entry.object->getCullingBounds(), view);
+      }
+
+      if (canRecordBatches) {
+        entry.object->recordCommands(commands);
+      }
+      else {
+        commands.addObject(entry.object);
+      }
+
+      if (statistics.firstDrawn == nullptr) {
+        statistics.firstDrawn = &entry;
+      }
+
+      statistics.lastDrawn = &entry;
+      statistics.submittedCount++;
+    }
+  }
+
+  void RenderQueue::record(const SpatialIndex* cullingIndex) {
+    auto sortStart = std::chrono::steady_clock::now();
+    sortEntries(_entries, _scratch);
+    _lastSortTime = getTimeSince(sortStart);
+
+    auto recordStart = std::chrono::steady_clock::now();
+    auto view = cullingIndex != nullptr ? cullingIndex->getLastCullBounds() : Maths::GeoBounds(Maths::GeoVector2F::zero(), Maths::GeoVector2F::zero(), 0.0f);
+
+    //Each task records a contiguous run of the sorted entries, so replaying the lists one after another keeps the sorted order.
+    auto entryCount = _entries.size();
+    auto taskCount = _workerPool == nullptr ? 1 : std::clamp<size_t>(entryCount / MinimumEntriesPerTask, 1, _workerPool->getWorkerCount() + 1);
+    if (_commandLists.size() < taskCount) {
+      _commandLists.resize(taskCount);
+    }
+
+    _chunkStatistics.resize(taskCount);
+    auto recordTask = [&](size_t task) {
+      recordChunk(entryCount * task / taskCount, entryCount * (task + 1) / taskCount, cullingIndex, view, _commandLists[task], _chunkStatistics[task]);
+    };
+
+    if (taskCount == 1) {
+      recordTask(0);
+    }
+    else {
+      _workerPool->run(taskCount, recordTask);
+    }
+
+    _recordedListCount = taskCount;
+    _submittedCount = 0;
+    _culledCount = 0;
+    _stateChangeCount = 0;
+    auto opaqueArea = 0.0f;
+    auto translucentArea = 0.0f;
+    const Entry* previous = nullptr;
+    for (const auto& statistics : _chunkStatistics) {
+      _submittedCount += statistics.submittedCount;
+      _culledCount += statistics.culledCount;
+      _stateChangeCount += statistics.stateChangeCount;
+      opaqueArea += statistics.opaqueArea;
+      translucentArea += statistics.translucentArea;
+
+      if (statistics.firstDrawn == nullptr) continue;
+
+      //The change from one run into the next was not seen by either task.
+      if (previous != nullptr) {
+        _stateChangeCount += countStateChanges(previous->key, statistics.firstDrawn->key);
+      }
+
+      previous = statistics.lastDrawn;
+    }
+
+    auto viewArea = view.size.x * view.size.y;
+    _opaqueOverdraw = viewArea > 0.0f ? opaqueArea / viewArea : 0.0f;
+    _translucentOverdraw = viewArea > 0.0f ? translucentArea / viewArea : 0.0f;
+
+    rememberSubmissions();
+    _entries.clear();
+    _lastRecordTime = getTimeSince(recordStart);
+  }
+
+  void RenderQueue::replay() {
+    _isExecuting = true;
+    auto hasStartedPass = false;
+    auto currentPass = RenderPass::Opaque;
+
+    for (size_t listIndex = 0; listIndex < _recordedListCount; listIndex++) {
+      auto& commands = _commandLists[listIndex];
+      for (const auto& command : commands.getCommands()) {
+        switch (command.type) {
+          case RenderCommandType::BeginPass:
+            if (!hasStartedPass || command.pass != currentPass) {
+              hasStartedPass = true;
+              currentPass = command.pass;
+              PassStarted(command.pass);
+            }
+            break;
+          case RenderCommandType::DrawSprites:
+            //Shapes queued before these sprites have to reach the screen first, otherwise the batches would reorder them.
+            _shapeBatch->flush();
+            _spriteBatch->submit(command.shaderProgramId, command.texture, commands.getSpriteInstances().data() + command.first, command.count);
+            break;
+          case RenderCommandType::DrawShapes:
+            _spriteBatch->flush();
+            _shapeBatch->submit(command.shaderProgramId, commands.getShapeVertices().data() + command.first, command.count);
+            break;
+          case RenderCommandType::DrawObject:
+            command.object->drawObject();
+            break;
+        }
+      }
+
+      commands.clear();
+    }
+
+    _isExecuting = false;
+    _recordedListCount = 0;
+  }
+
+  void RenderQueue::execute(const SpatialIndex* cullingIndex) {
+    record(cullingIndex);
+    replay();
+  }
+
+  void RenderQueue::clear() noexcept {
+    for (size_t i = 0; i < _recordedListCount; i++) {
+      _commandLists[i].clear();
+    }
+
+    _recordedListCount = 0;
+    _entries.clear();
+    rememberSubmissions();
+  }
+}
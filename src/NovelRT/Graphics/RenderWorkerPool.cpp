@@ -0,0 +1,98 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  RenderWorkerPool::RenderWorkerPool(size_t workerCount) noexcept :
+    _workerCount(workerCount),
+    _workers(),
+    _mutex(),
+    _workAvailable(),
+    _workFinished(),
+    _task(nullptr),
+    _taskCount(0),
+    _nextTask(0),
+    _busyWorkerCount(0),
+    _generation(0),
+    _isStopping(false) {}
+
+  size_t RenderWorkerPool::getDefaultWorkerCount() noexcept {
+    //The texture decoders and font rasterisers have threads of their own, so there is no point going wider than this.
+    auto hardwareThreads = static_cast<size_t>(std::thread::hardware_concurrency());
+    return std::clamp<size_t>(hardwareThreads > 1 ? hardwareThreads - 1 : 0, 0, 7);
+  }
+
+  void RenderWorkerPool::runTasks() {
+    for (auto index = _nextTask.fetch_add(1); index < _taskCount; index = _nextTask.fetch_add(1)) {
+      (*_task)(index);
+    }
+  }
+
+  void RenderWorkerPool::runWorker() {
+    uint64_t lastGeneration = 0;
+
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _workAvailable.wait(lock, [&] { return _isStopping || _generation != lastGeneration; });
+        if (_isStopping) return;
+
+        lastGeneration = _generation;
+      }
+
+      runTasks();
+
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (--_busyWorkerCount == 0) {
+        _workFinished.notify_one();
+      }
+    }
+  }
+
+  void RenderWorkerPool::run(size_t taskCount, const std::function<void(size_t)>& task) {
+    if (taskCount == 0) return;
+
+    if (_workerCount == 0 || taskCount == 1) {
+      for (size_t i = 0; i < taskCount; i++) {
+        task(i);
+      }
+
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_workers.empty()) {
+        for (size_t i = 0; i < _workerCount; i++) {
+          _workers.emplace_back(&RenderWorkerPool::runWorker, this);
+        }
+      }
+
+      _task = &task;
+      _taskCount = taskCount;
+      _nextTask = 0;
+      _busyWorkerCount = _workerCount;
+      _generation++;
+    }
+
+    _workAvailable.notify_all();
+    runTasks();
+
+    //Every worker has to check in, even one that found nothing left to do, before the task can go out of scope.
+    std::unique_lock<std::mutex> lock(_mutex);
+    _workFinished.wait(lock, [this] { return _busyWorkerCount == 0; });
+    _task = nullptr;
+  }
+
+  RenderWorkerPool::~RenderWorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _isStopping = true;
+    }
+
+    _workAvailable.notify_all();
+    for (auto& worker : _workers) {
+      worker.join();
+    }
+  }
+}
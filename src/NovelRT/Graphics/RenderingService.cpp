@@ -3,22 +3,67 @@
 #include <NovelRT.h>
 
 namespace NovelRT::Graphics {
+  static std::string getCacheKey(const std::string& file) {
+    //"./a/../b.png" and "b.png" are the same file, so they should share a cache entry.
+    return std::filesystem::path(file).lexically_normal().generic_string();
+  }
+
   RenderingService::RenderingService(std::shared_ptr<Windowing::WindowingService> windowingService) noexcept :
     _logger(LoggingService(Utilities::Misc::CONSOLE_LOG_GFX)),
     _windowingService(windowingService),
-    _cameraObjectRenderUbo(std::function<GLuint()>([] {
+    _cameraObjectRenderUbo(std::function<GLuint()>([this] {
       GLuint tempHandle;
       glGenBuffers(1, &tempHandle);
-      glBindBuffer(GL_UNIFORM_BUFFER, tempHandle);
+      _glState->bindBuffer(GL_UNIFORM_BUFFER, tempHandle);
       glBufferData(GL_UNIFORM_BUFFER, sizeof(Maths::GeoMatrix4x4F), nullptr, GL_STATIC_DRAW);
-      glBindBuffer(GL_UNIFORM_BUFFER, 0);
+      //Binding a range also binds the buffer to the generic GL_UNIFORM_BUFFER target, which is where the cache already has it.
       glBindBufferRange(GL_UNIFORM_BUFFER, 0, tempHandle, 0, sizeof(Maths::GeoMatrix4x4F));
       return tempHandle;
     })),
     _camera(nullptr),
-    _framebufferColour(RGBAConfig(0,0,102,255)) {
+    _framebufferColour(RGBAConfig(0,0,102,255)),
+    _glState(std::make_shared<GLStateCache>()),
+    _geometryCache(std::make_shared<GeometryCache>(_glState)),
+    _spriteBatch(SpriteBatch(std::make_unique<OpenGLSpriteBatchBackend>(_glState, _geometryCache))),
+    _shapeBatch(_glState),
+    _workerPool(RenderWorkerPool::getDefaultWorkerCount()),
+    _renderQueue(&_spriteBatch, &_shapeBatch, &_workerPool),
+    _spatialIndex(),
+    _transformStore(),
+    _renderLayers(),
+    _lastFrameRenderLayerRebuildCount(0),
+    _screenTransition(_glState),
+    _textureLoader(_glState),
+    _placeholderTexture(),
+    _fontLibrary(nullptr),
+    _offscreenFramebuffer(Utilities::Lazy<GLuint>(std::function<GLuint()>([] {
+      GLuint tempHandle;
+      glGenFramebuffers(1, &tempHandle);
+      return tempHandle;
+    }))),
+    _offscreenColourBuffer(Utilities::Lazy<GLuint>(std::function<GLuint()>([] {
+      GLuint tempHandle;
+      glGenRenderbuffers(1, &tempHandle);
+      return tempHandle;
+    }))),
+    _offscreenDepthBuffer(Utilities::Lazy<GLuint>(std::function<GLuint()>([] {
+      GLuint tempHandle;
+      glGenRenderbuffers(1, &tempHandle);
+      return tempHandle;
+    }))),
+    _frameCount(0),
+    _pendingFrameCaptures(),
+    _isFrameInvalidated(true),
+    _isIdleFrameSkippingEnabled(true),
+    _wasLastFrameSkipped(false),
+    _skippedFrameCount(0) {
     _windowingService->WindowResized += ([this](auto input) {
         initialiseRenderPipeline(false, &input);
+        invalidateFrame();
+      });
+
+    _windowingService->WindowRefreshRequested += ([this] {
+        invalidateFrame();
       });
   }
 
@@ -33,9 +78,9 @@ namespace NovelRT::Graphics {
 
     if (completeLaunch) {
       _camera = Camera::createDefaultOrthographicProjection(windowSize);
-      glfwMakeContextCurrent(_windowingService->getWindow()); //lmao
+      _windowingService->makeContextCurrent();
 
-      if (!gladLoadGLES2Loader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress))) {
+      if (!gladLoadGLES2Loader(_windowingService->getProcAddressLoader())) {
         _logger.logError("Failed to initialise glad.");
         throw Exceptions::InitialisationFailureException("Unable to continue! The engine cannot start without glad.");
       }
@@ -52,61 +97,82 @@ namespace NovelRT::Graphics {
       std::string glShading = reinterpret_cast<const char*>(glGetString(GL_SHADING_LANGUAGE_VERSION));
       _logger.logInfo("GL_SHADING_LANGUAGE_VERSION: {}", glShading);
 
-      glEnable(GL_DEPTH_TEST);
+      // Headless contexts have no default framebuffer worth drawing to, so everything renders into an FBO that stays bound.
+      if (_windowingService->isHeadless()) {
+        resizeOffscreenFramebuffer(windowSize);
+      }
+
+      auto shaderCacheDirPath = Utilities::Misc::getExecutableDirPath() / "Cache" / "Shaders";
+      _shaderProgramCache = std::make_unique<ShaderProgramCache>(shaderCacheDirPath, glRenderer, glVersion);
+
+      _glState->enable(GL_DEPTH_TEST);
       glDepthFunc(GL_LESS);
 
-      glEnable(GL_BLEND);
-      glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+      _glState->enable(GL_BLEND);
+      _glState->blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+      //Passes only change GL state, so there is nothing for them to do until there is a context to change.
+      _renderQueue.PassStarted += ([this](auto pass) {
+          beginRenderPass(pass);
+        });
 
       _basicFillRectProgram = loadShaders("BasicVertexShader.glsl", "BasicFragmentShader.glsl");
       _texturedRectProgram = loadShaders("TexturedVertexShader.glsl", "TexturedFragmentShader.glsl");
+      _cutoutTexturedRectProgram = loadShaders("TexturedVertexShader.glsl", "TexturedFragmentShader.glsl", {"ALPHA_CUTOUT"});
       _fontProgram = loadShaders("FontVertexShader.glsl", "FontFragmentShader.glsl");
+      _distanceFieldFontProgram = loadShaders("FontVertexShader.glsl", "FontFragmentShader.glsl", {"DISTANCE_FIELD"});
+      _renderLayerProgram = loadShaders("TexturedVertexShader.glsl", "TexturedFragmentShader.glsl", {"UNPREMULTIPLY_ALPHA"});
+      _screenTransition.setPrograms({
+        loadShaders("TransitionVertexShader.glsl", "TransitionFragmentShader.glsl", {"FADE"}),
+        loadShaders("TransitionVertexShader.glsl", "TransitionFragmentShader.glsl"),
+        loadShaders("TransitionVertexShader.glsl", "TransitionFragmentShader.glsl", {"MASK_WIPE"}),
+        loadShaders("TransitionVertexShader.glsl", "TransitionFragmentShader.glsl", {"BLUR"})
+      });
     }
     else {
       _camera->forceResize(windowSize);
+
+      if (_windowingService->isHeadless()) {
+        resizeOffscreenFramebuffer(windowSize);
+      }
+
       glViewport(0, 0, static_cast<GLsizei>(windowSize.x), static_cast<GLsizei>(windowSize.y));
     }
 
     return true;
   }
 
-  ShaderProgram RenderingService::loadShaders(const std::string& vertexFileName, const std::string& fragmentFileName) {
+  void RenderingService::resizeOffscreenFramebuffer(Maths::GeoVector2F windowSize) {
+    auto width = static_cast<GLsizei>(windowSize.x);
+    auto height = static_cast<GLsizei>(windowSize.y);
 
-    // Create the shaders
-    GLuint vertexShaderId = glCreateShader(GL_VERTEX_SHADER);
-    GLuint fragmentShaderId = glCreateShader(GL_FRAGMENT_SHADER);
-
-    std::filesystem::path executableDirPath = Utilities::Misc::getExecutableDirPath();
-    std::filesystem::path shadersDirPath = executableDirPath / "Resources" / "Shaders";
+    glBindRenderbuffer(GL_RENDERBUFFER, _offscreenColourBuffer.getActual());
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, _offscreenDepthBuffer.getActual());
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
 
-    // Read the Vertex Shader code from the file
-    std::string vertexShaderCode;
+    glBindFramebuffer(GL_FRAMEBUFFER, _offscreenFramebuffer.getActual());
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, _offscreenColourBuffer.getActual());
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, _offscreenDepthBuffer.getActual());
 
-    std::ifstream VertexShaderStream(shadersDirPath / vertexFileName, std::ios::in);
-    if (VertexShaderStream.is_open()) {
-      std::stringstream sstr;
-      sstr << VertexShaderStream.rdbuf();
-      vertexShaderCode = sstr.str();
-      VertexShaderStream.close();
-    }
-    else {
-      _logger.logError("Target Vertex Shader file cannot be opened! Please ensure the path is correct and that the file is not locked.");
-      throw Exceptions::FileNotFoundException("Target Vertex Shader file cannot be opened! Please ensure the path is correct and that the file is not locked.", vertexFileName);
+    auto status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+      _logger.logError("The offscreen framebuffer is incomplete. Status: {:#x}", status);
+      throw Exceptions::InitialisationFailureException("Unable to continue! The offscreen framebuffer could not be created.", static_cast<int32_t>(status));
     }
 
-    // Read the Fragment Shader code from the file
-    std::string fragmentShaderCode;
-    std::ifstream fragmentShaderStream(shadersDirPath / fragmentFileName, std::ios::in);
-    if (fragmentShaderStream.is_open()) {
-      std::stringstream stringStream;
-      stringStream << fragmentShaderStream.rdbuf();
-      fragmentShaderCode = stringStream.str();
-      fragmentShaderStream.close();
-    }
-    else {
-      _logger.logError("Target Fragment Shader file cannot be opened! Please ensure the path is correct and that the file is not locked.");
-      throw Exceptions::FileNotFoundException("Target Fragment Shader file cannot be opened! Please ensure the path is correct and that the file is not locked.", fragmentFileName);
-    }
+    glViewport(0, 0, width, height);
+  }
+
+  void RenderingService::linkShaders(GLuint programId,
+    const std::string& vertexFileName,
+    const std::string& vertexShaderCode,
+    const std::string& fragmentFileName,
+    const std::string& fragmentShaderCode) {
+    // Create the shaders
+    GLuint vertexShaderId = glCreateShader(GL_VERTEX_SHADER);
+    GLuint fragmentShaderId = glCreateShader(GL_FRAGMENT_SHADER);
 
     GLint Result = GL_FALSE;
     int infoLogLength;
@@ -145,7 +211,10 @@ namespace NovelRT::Graphics {
 
     // Link the program
     _logger.logInfo("Linking program...");
-    GLuint programId = glCreateProgram();
+    if (_shaderProgramCache != nullptr && _shaderProgramCache->isSupported()) {
+      glProgramParameteri(programId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
     glAttachShader(programId, vertexShaderId);
     glAttachShader(programId, fragmentShaderId);
     glLinkProgram(programId);
@@ -165,10 +234,63 @@ namespace NovelRT::Graphics {
 
     glDeleteShader(vertexShaderId);
     glDeleteShader(fragmentShaderId);
+  }
+
+  ShaderProgram RenderingService::loadShaders(const std::string& vertexFileName, const std::string& fragmentFileName, const std::vector<std::string>& defines) {
+    std::filesystem::path executableDirPath = Utilities::Misc::getExecutableDirPath();
+    std::filesystem::path shadersDirPath = executableDirPath / "Resources" / "Shaders";
+
+    // Read the Vertex Shader code from the file
+    std::string vertexShaderCode;
+
+    std::ifstream VertexShaderStream(shadersDirPath / vertexFileName, std::ios::in);
+    if (VertexShaderStream.is_open()) {
+      std::stringstream sstr;
+      sstr << VertexShaderStream.rdbuf();
+      vertexShaderCode = sstr.str();
+      VertexShaderStream.close();
+    }
+    else {
+      _logger.logError("Target Vertex Shader file cannot be opened! Please ensure the path is correct and that the file is not locked.");
+      throw Exceptions::FileNotFoundException("Target Vertex Shader file cannot be opened! Please ensure the path is correct and that the file is not locked.", vertexFileName);
+    }
+
+    // Read the Fragment Shader code from the file
+    std::string fragmentShaderCode;
+    std::ifstream fragmentShaderStream(shadersDirPath / fragmentFileName, std::ios::in);
+    if (fragmentShaderStream.is_open()) {
+      std::stringstream stringStream;
+      stringStream << fragmentShaderStream.rdbuf();
+      fragmentShaderCode = stringStream.str();
+      fragmentShaderStream.close();
+    }
+    else {
+      _logger.logError("Target Fragment Shader file cannot be opened! Please ensure the path is correct and that the file is not locked.");
+      throw Exceptions::FileNotFoundException("Target Fragment Shader file cannot be opened! Please ensure the path is correct and that the file is not locked.", fragmentFileName);
+    }
+
+    vertexShaderCode = ShaderProgramCache::applyDefines(vertexShaderCode, defines);
+    fragmentShaderCode = ShaderProgramCache::applyDefines(fragmentShaderCode, defines);
+
+    GLuint programId = glCreateProgram();
+    if (_shaderProgramCache != nullptr) {
+      auto cacheKey = _shaderProgramCache->getKey(vertexShaderCode, fragmentShaderCode);
+      if (!_shaderProgramCache->tryLoad(cacheKey, programId)) {
+        //tryLoad may have left a rejected binary in the program, so start again with a clean one.
+        glDeleteProgram(programId);
+        programId = glCreateProgram();
+        linkShaders(programId, vertexFileName, vertexShaderCode, fragmentFileName, fragmentShaderCode);
+        _shaderProgramCache->store(cacheKey, programId);
+      }
+    }
+    else {
+      linkShaders(programId, vertexFileName, vertexShaderCode, fragmentFileName, fragmentShaderCode);
+    }
 
     ShaderProgram returnProg;
     returnProg.shaderProgramId = programId;
-    returnProg.finalViewMatrixBufferUboId = _cameraObjectRenderUbo.getActual();
+    returnProg.cameraMatrixBufferUboId = _cameraObjectRenderUbo.getActual();
+    returnProg.modelTransformUniformLocation = glGetUniformLocation(programId, "modelTransform");
     bindCameraUboForProgram(programId);
 
     return returnProg;
@@ -184,43 +306,223 @@ namespace NovelRT::Graphics {
   }
 
   void RenderingService::tearDown() const {
-    glDeleteProgram(_basicFillRectProgram.shaderProgramId);
-    glDeleteProgram(_texturedRectProgram.shaderProgramId);
+    for (auto programId : { _basicFillRectProgram.shaderProgramId, _texturedRectProgram.shaderProgramId, _cutoutTexturedRectProgram.shaderProgramId,
+      _fontProgram.shaderProgramId, _distanceFieldFontProgram.shaderProgramId, _renderLayerProgram.shaderProgramId }) {
+      glDeleteProgram(programId);
+      _glState->onProgramDeleted(programId);
+    }
+
+    for (const auto& program : _screenTransition._programs) {
+      glDeleteProgram(program.shaderProgramId);
+      _glState->onProgramDeleted(program.shaderProgramId);
+    }
   }
 
-  void RenderingService::beginFrame() const {
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
-    glClearColor(_framebufferColour.getRScalar(), _framebufferColour.getGScalar(), _framebufferColour.getBScalar(), _framebufferColour.getAScalar());
+  void RenderingService::beginFrame() {
+    //ModifiedInLast is included so that changes made while the previous frame was being drawn are not missed.
+    if (_camera->getFrameState() != CameraFrameState::Unmodified) {
+      uploadCameraUbo();
+    }
+
     _camera->initialiseCameraForFrame();
+    _textureLoader.processUploads();
+  }
+
+  void RenderingService::uploadCameraUbo() {
+    auto cameraMatrix = _camera->getCameraUboMatrix();
+    _glState->bindBuffer(GL_UNIFORM_BUFFER, _cameraObjectRenderUbo.getActual());
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(Maths::GeoMatrix4x4F), &cameraMatrix);
+  }
+
+  void RenderingService::endFrame() {
+    //Retained layers are queued as single quads before anything is culled, so that they are culled and sorted like any other object.
+    if (_camera != nullptr) {
+      auto visibleBounds = _camera->getVisibleBounds();
+      for (auto renderLayer : _renderLayers) {
+        renderLayer->submitComposite(visibleBounds);
+      }
+    }
+
+    _transformStore.update(&_workerPool);
+
+    if (_camera != nullptr) {
+      _spatialIndex.cull(_camera->getVisibleBounds());
+      renderRetainedLayers();
+    }
+
+    //The last frame is still on screen, so a frame that would come out the same does not need drawing or presenting at all.
+    if (isFrameUnchanged()) {
+      _renderQueue.clear();
+      _wasLastFrameSkipped = true;
+      _skippedFrameCount++;
+      _frameCount++;
+      return;
+    }
+
+    if (_screenTransition.isActive()) {
+      //The scene that is transitioning in is only drawn when it changes. The rest of the time, its submissions are thrown away.
+      auto drawFrame = [this] { drawQueuedFrame(); };
+      if (!_screenTransition.render(drawFrame, !isSceneUnchanged(), _windowingService->getWindowSize(), getMainFramebuffer())) {
+        _renderQueue.clear();
+      }
+    }
+    else {
+      drawQueuedFrame();
+    }
+
+    _screenTransition._hasChanged = false;
+
+    auto capture = _pendingFrameCaptures.find(_frameCount);
+    if (capture != _pendingFrameCaptures.end()) {
+      PngCodec::encodeFile(capture->second, readFramebuffer());
+      _logger.logInfo("Frame {} captured to {}", _frameCount, capture->second);
+      _pendingFrameCaptures.erase(capture);
+    }
+
+    _windowingService->swapBuffers();
+    _glState->endFrame();
+    _isFrameInvalidated = false;
+    _wasLastFrameSkipped = false;
+    _frameCount++;
+
+    //Raised last, so that the outgoing scene can be taken down from the handler without pulling anything out from under the frame.
+    if (_screenTransition._wasOutgoingFrameCaptured) {
+      _screenTransition._wasOutgoingFrameCaptured = false;
+      _screenTransition.OutgoingFrameCaptured();
+    }
+  }
+
+  void RenderingService::drawQueuedFrame() {
+    //Clearing waits until now so that skipped frames never touch the framebuffer. glClear only clears depth while depth writes
+    //are on, and a RenderLayer's translucent pass may have just turned them off.
+    _glState->depthMask(GL_TRUE);
+    glClearColor(_framebufferColour.getRScalar(), _framebufferColour.getGScalar(), _framebufferColour.getBScalar(), _framebufferColour.getAScalar());
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+    _renderQueue.execute(_camera != nullptr ? &_spatialIndex : nullptr);
+    _spriteBatch.flush();
+    _shapeBatch.flush();
+
+    //Everything outside the queue expects to blend and write depth.
+    _glState->enable(GL_BLEND);
+    _glState->depthMask(GL_TRUE);
+  }
+
+  bool RenderingService::isSceneUnchanged() const noexcept {
+    if (_isFrameInvalidated || !_renderQueue.matchesLastSubmissions()) return false;
+    if (_lastFrameRenderLayerRebuildCount > 0 || _textureLoader.getLastFrameUploadedBytes() > 0) return false;
+
+    return _camera == nullptr || _camera->getFrameState() == CameraFrameState::Unmodified;
+  }
+
+  bool RenderingService::isFrameUnchanged() const noexcept {
+    if (!_isIdleFrameSkippingEnabled || !isSceneUnchanged() || _screenTransition._hasChanged) return false;
+
+    return _pendingFrameCaptures.find(_frameCount) == _pendingFrameCaptures.end();
+  }
+
+  GLuint RenderingService::getMainFramebuffer() {
+    return _windowingService->isHeadless() ? _offscreenFramebuffer.getActual() : 0;
+  }
+
+  void RenderingService::renderRetainedLayers() {
+    _lastFrameRenderLayerRebuildCount = 0;
+    if (_renderLayers.empty()) return;
+
+    //Layers draw through the same camera as everything else, so moving it moves what is in them. beginFrame has already moved
+    //the camera's state on by this point, which means ModifiedInLast still catches a change made while the last frame was drawn.
+    auto forceRebuild = _camera->getFrameState() != CameraFrameState::Unmodified || _textureLoader.getLastFrameUploadedBytes() > 0;
+    auto mainFramebuffer = getMainFramebuffer();
+    auto windowSize = _windowingService->getWindowSize();
+
+    for (auto renderLayer : _renderLayers) {
+      if (renderLayer->render(&_spatialIndex, windowSize, mainFramebuffer, forceRebuild)) {
+        _lastFrameRenderLayerRebuildCount++;
+      }
+    }
+  }
+
+  void RenderingService::beginRenderPass(RenderPass pass) {
+    //Sprites and shapes from the last pass are still batched up, and have to be drawn with the state they were queued under.
+    _spriteBatch.flush();
+    _shapeBatch.flush();
+
+    if (pass == RenderPass::Opaque) {
+      _glState->disable(GL_BLEND);
+      _glState->depthMask(GL_TRUE);
+    }
+    else {
+      _glState->enable(GL_BLEND);
+      _glState->depthMask(GL_FALSE);
+    }
+  }
+
+  RgbaImage RenderingService::readFramebuffer() {
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    RgbaImage image(static_cast<uint32_t>(viewport[2]), static_cast<uint32_t>(viewport[3]));
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(viewport[0], viewport[1], viewport[2], viewport[3], GL_RGBA, GL_UNSIGNED_BYTE, image.pixels.data());
+
+    // GL reads bottom row first.
+    auto rowSize = static_cast<size_t>(image.width) * RgbaImage::BytesPerPixel;
+    for (uint32_t row = 0; row < image.height / 2; row++) {
+      std::swap_ranges(image.getPixel(0, row), image.getPixel(0, row) + rowSize, image.getPixel(0, image.height - 1 - row));
+    }
+
+    return image;
   }
 
-  void RenderingService::endFrame() const {
-    glfwSwapBuffers(_windowingService->getWindow());
+  void RenderingService::captureFrame(uint64_t frameNumber, const std::string& file) {
+    if (frameNumber < _frameCount) {
+      _logger.logError("Frame {} cannot be captured because it has already been presented.", frameNumber);
+      throw Exceptions::InvalidOperationException("Frame " + std::to_string(frameNumber) + " has already been presented.");
+    }
+
+    _pendingFrameCaptures[frameNumber] = file;
   }
 
   std::unique_ptr<ImageRect> RenderingService::createImageRect(Transform transform,
     int32_t layer,
     const std::string& filePath,
     RGBAConfig colourTint) {
-    return std::make_unique<ImageRect>(transform, layer, _texturedRectProgram, getCamera(), getTexture(filePath), colourTint);
+    return std::make_unique<ImageRect>(transform, layer, _texturedRectProgram, getCamera(), shared_from_this(), getTexture(filePath), colourTint);
   }
 
   std::unique_ptr<ImageRect> RenderingService::createImageRect(Transform transform,
     int32_t layer,
     RGBAConfig colourTint) {
-    return std::make_unique<ImageRect>(transform, layer, _texturedRectProgram, getCamera(), colourTint);
+    return std::make_unique<ImageRect>(transform, layer, _texturedRectProgram, getCamera(), shared_from_this(), colourTint);
   }
 
   std::unique_ptr<TextRect> RenderingService::createTextRect(Transform transform,
     int32_t layer,
     RGBAConfig colourConfig,
     float fontSize,
-    const std::string& fontFilePath) {
-    return std::make_unique<TextRect>(transform, layer, _fontProgram, getCamera(), getFontSet(fontFilePath, fontSize), colourConfig);
+    const std::string& fontFilePath,
+    FontRenderMode renderMode) {
+    auto program = renderMode == FontRenderMode::DistanceField ? _distanceFieldFontProgram : _fontProgram;
+    auto textRect = std::make_unique<TextRect>(transform, layer, program, getCamera(), shared_from_this(), getFontSet(fontFilePath, fontSize, renderMode), colourConfig);
+    textRect->setFontSize(fontSize);
+    return textRect;
   }
 
   std::unique_ptr<BasicFillRect> RenderingService::createBasicFillRect(Transform transform, int32_t layer, RGBAConfig colourConfig) {
-    return std::make_unique<BasicFillRect>(transform, layer, getCamera(), _basicFillRectProgram, colourConfig);
+    return std::make_unique<BasicFillRect>(transform, layer, getCamera(), _basicFillRectProgram, shared_from_this(), colourConfig);
+  }
+
+  std::unique_ptr<Canvas2D> RenderingService::createCanvas(int32_t layer) {
+    return std::make_unique<Canvas2D>(layer, _basicFillRectProgram, getCamera(), shared_from_this());
+  }
+
+  std::unique_ptr<ParticleSystem> RenderingService::createParticleSystem(Transform transform, int32_t layer) {
+    return std::make_unique<ParticleSystem>(transform, layer, _texturedRectProgram, getCamera(), shared_from_this());
+  }
+
+  std::shared_ptr<RenderLayer> RenderingService::createRenderLayer(int32_t layer) {
+    auto renderLayer = std::make_shared<RenderLayer>(layer, _renderLayerProgram, getCamera(), shared_from_this());
+    _renderLayers.push_back(renderLayer.get());
+    return renderLayer;
   }
 
   std::shared_ptr<Camera> RenderingService::getCamera() const {
@@ -228,59 +530,153 @@ namespace NovelRT::Graphics {
   }
 
   void RenderingService::bindCameraUboForProgram(GLuint shaderProgramId) {
-    GLuint uboIndex = glGetUniformBlockIndex(shaderProgramId, "finalViewMatrixBuffer");
+    GLuint uboIndex = glGetUniformBlockIndex(shaderProgramId, "cameraMatrixBuffer");
+    if (uboIndex == GL_INVALID_INDEX) return;
+
     glUniformBlockBinding(shaderProgramId, uboIndex, 0);
   }
 
   void RenderingService::handleTexturePreDestruction(Texture* target) {
-    _textureCache.erase(target->getId());
+    if (target->getTextureFile().empty()) return;
+
+    _textureCache.removeIfExpired(getCacheKey(target->getTextureFile()));
   }
 
   void RenderingService::handleFontSetPreDestruction(FontSet* target) {
-    _fontCache.erase(target->getId());
+    if (target->getFontFile().empty()) return;
+
+    _fontCache.removeIfExpired(FontCacheKey{getCacheKey(target->getFontFile()), target->getFontSize(), target->getRenderMode()});
+  }
+
+  void RenderingService::handleRenderLayerPreDestruction(RenderLayer* target) {
+    _renderLayers.erase(std::remove(_renderLayers.begin(), _renderLayers.end(), target), _renderLayers.end());
+  }
+
+  std::shared_ptr<Texture> RenderingService::getPlaceholderTexture() {
+    //Held weakly so the cache does not keep it alive; every loading texture holds a strong reference in the meantime.
+    auto placeholder = _placeholderTexture.lock();
+    if (placeholder != nullptr) return placeholder;
+
+    RgbaImage transparentPixel(1, 1);
+    placeholder = getTexture();
+    placeholder->loadRgbaImageAsTexture(transparentPixel);
+    _placeholderTexture = placeholder;
+    return placeholder;
   }
 
   std::shared_ptr<Texture> RenderingService::getTexture(const std::string& fileTarget) {
-    if (!fileTarget.empty()) {
-      for(auto& pair : _textureCache) {
-        auto result = pair.second.lock();
-        if (result->getTextureFile() != fileTarget) continue;
+    //Textures without a file are never shared, so they are not worth indexing.
+    if (fileTarget.empty()) {
+      return std::make_shared<Texture>(shared_from_this(), Atom::getNextTextureId());
+    }
 
-        return result;
-      }
+    auto cacheKey = getCacheKey(fileTarget);
+    auto result = _textureCache.tryGet(cacheKey);
+    if (result != nullptr) return result;
 
-      auto returnValue = std::make_shared<Texture>(shared_from_this(), Atom::getNextTextureId());
-      std::weak_ptr<Texture> valueForMap = returnValue;
-      _textureCache.emplace(returnValue->getId(), valueForMap);
-      returnValue->loadPngAsTexture(fileTarget);
-      return returnValue;
+    result = std::make_shared<Texture>(shared_from_this(), Atom::getNextTextureId());
+    if (TextureContainer::isContainerFile(fileTarget)) {
+      result->loadContainerAsTexture(fileTarget);
+    }
+    else if (QoiCodec::isQoiFile(fileTarget)) {
+      result->loadQoiAsTexture(fileTarget);
+    }
+    else {
+      result->loadPngAsTexture(fileTarget);
     }
 
-    //DRY, I know, but Im really not fussed rn
-    auto returnValue = std::make_shared<Texture>(shared_from_this(), Atom::getNextTextureId());
-    std::weak_ptr<Texture> valueForMap = returnValue;
-    _textureCache.emplace(returnValue->getId(), valueForMap);
+    _textureCache.insert(cacheKey, result);
+    return result;
+  }
 
-    return returnValue;
+  std::shared_ptr<Texture> RenderingService::getTextureAsync(const std::string& fileTarget) {
+    auto cacheKey = getCacheKey(fileTarget);
+    auto result = _textureCache.tryGet(cacheKey);
+    if (result != nullptr) return result;
+
+    //Texture containers need no decoding, so there is nothing to gain by loading them in the background.
+    if (TextureContainer::isContainerFile(fileTarget)) {
+      return getTexture(fileTarget);
+    }
+
+    result = getTexture();
+    result->_textureFile = fileTarget;
+    result->_placeholder = getPlaceholderTexture();
+    _textureLoader.request(result, fileTarget);
+    _textureCache.insert(cacheKey, result);
+    return result;
   }
 
-  std::shared_ptr<FontSet> RenderingService::getFontSet(const std::string& fileTarget, float fontSize) {
-    if (!fileTarget.empty()) {
-      for (auto& pair : _fontCache) {
-        auto result = pair.second.lock();
-        if (result->getFontFile() != fileTarget || result->getFontSize() != fontSize) continue;
+  const std::shared_ptr<FontLibrary>& RenderingService::getFontLibrary() {
+    if (_fontLibrary == nullptr) {
+      _fontLibrary = std::make_shared<FontLibrary>();
+    }
 
-        return result;
-      }
+    return _fontLibrary;
+  }
+
+  std::shared_ptr<FontSet> RenderingService::getFontSet(const std::string& fileTarget, float fontSize, FontRenderMode renderMode) {
+    //Distance field fonts are always rasterised at the same size, so every requested size shares one FontSet.
+    auto isDistanceField = renderMode == FontRenderMode::DistanceField;
+    auto cacheKey = FontCacheKey{getCacheKey(fileTarget), isDistanceField ? static_cast<float>(FontSet::DistanceFieldBaseSize) : fontSize, renderMode};
+    auto result = _fontCache.tryGet(cacheKey);
+    if (result != nullptr) return result;
+
+    result = std::make_shared<FontSet>(shared_from_this(), Atom::getNextFontSetId());
+    if (isDistanceField) {
+      result->loadFontAsDistanceField(fileTarget);
+    }
+    else {
+      result->loadFontAsTextureSet(fileTarget, fontSize);
+    }
+
+    _fontCache.insert(cacheKey, result);
+    return result;
+  }
+
+  std::shared_ptr<SpriteAtlas> RenderingService::createSpriteAtlas(const std::vector<std::string>& imageFiles, uint32_t pageSize, uint32_t padding, bool shouldTrim) {
+    SpriteAtlasBuilder builder(pageSize, padding, shouldTrim);
+    for (auto& imageFile : imageFiles) {
+      builder.addImage(imageFile, PngCodec::decodeFile(imageFile));
+    }
+
+    builder.build();
+
+    std::vector<std::shared_ptr<Texture>> pages;
+    for (auto& pageImage : builder.getPages()) {
+      auto page = getTexture();
+      page->loadRgbaImageAsTexture(pageImage);
+      pages.push_back(page);
+    }
+
+    return std::make_shared<SpriteAtlas>(std::move(pages), builder.getRegions());
+  }
+
+  std::shared_ptr<SpriteAtlas> RenderingService::loadSpriteAtlas(const std::string& manifestFile) {
+    std::ifstream manifest(manifestFile);
+    if (!manifest.is_open()) {
+      _logger.logError("Sprite atlas manifest {} cannot be opened! Please ensure the path is correct and that the file is not locked.", manifestFile);
+      throw Exceptions::FileNotFoundException(manifestFile, "Unable to continue! The sprite atlas manifest could not be opened.");
+    }
+
+    std::vector<std::string> pageFiles;
+    std::vector<SpriteAtlasRegion> regions;
+    if (!SpriteAtlasBuilder::tryReadManifest(manifest, pageFiles, regions)) {
+      _logger.logError("Sprite atlas manifest {} is malformed! Aborting...", manifestFile);
+      throw Exceptions::IOException(manifestFile, "Unable to continue! The sprite atlas manifest is malformed.");
+    }
+
+    auto manifestDirectory = std::filesystem::path(manifestFile).parent_path();
+    std::vector<std::shared_ptr<Texture>> pages;
+    for (auto& pageFile : pageFiles) {
+      pages.push_back(getTexture((manifestDirectory / pageFile).string()));
     }
 
-    auto returnValue = std::make_shared<FontSet>(shared_from_this(), Atom::getNextFontSetId());
-    _fontCache.emplace(returnValue->getId(), std::weak_ptr<FontSet>(returnValue));
-    returnValue->loadFontAsTextureSet(fileTarget, fontSize);
-    return returnValue;
+    return std::make_shared<SpriteAtlas>(std::move(pages), std::move(regions));
   }
 
   void RenderingService::setBackgroundColour(RGBAConfig colour) {
     _framebufferColour = colour;
+    invalidateFrame();
   }
 }
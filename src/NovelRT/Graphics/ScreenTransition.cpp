@@ -0,0 +1,253 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  ScreenTransition::ScreenTransition(std::shared_ptr<GLStateCache> glState) noexcept :
+    _glState(glState),
+    _programs(),
+    _programLocations(),
+    _effect(ScreenTransitionEffect::Crossfade),
+    _state(ScreenTransitionState::Idle),
+    _duration(Timing::Timestamp::zero()),
+    _elapsed(Timing::Timestamp::zero()),
+    _progress(0.0f),
+    _fadeColour(RGBAConfig(0, 0, 0, 255)),
+    _mask(nullptr),
+    _softness(0.1f),
+    _maxBlurLevel(5.0f),
+    _hasChanged(false),
+    _wasOutgoingFrameCaptured(false),
+    _captureCount(0),
+    _outgoingFramebuffer(0),
+    _outgoingTexture(0),
+    _outgoingSize(Maths::GeoVector2F::zero()),
+    _incomingFramebuffer(0),
+    _incomingTexture(0),
+    _incomingSize(Maths::GeoVector2F::zero()),
+    _depthBuffer(0),
+    _depthBufferSize(Maths::GeoVector2F::zero()),
+    _vertexArray(0),
+    _logger(Utilities::Misc::CONSOLE_LOG_GFX) {}
+
+  void ScreenTransition::setPrograms(const std::array<ShaderProgram, 4>& programs) {
+    _programs = programs;
+
+    for (size_t i = 0; i < _programs.size(); i++) {
+      auto programId = _programs[i].shaderProgramId;
+      _programLocations[i] = ProgramLocations{glGetUniformLocation(programId, "progress"), glGetUniformLocation(programId, "fadeColour"),
+        glGetUniformLocation(programId, "softness"), glGetUniformLocation(programId, "maxBlurLevel")};
+
+      //Units 1 and 2 are bound directly while the pass is drawn, since the state cache only tracks unit 0.
+      _glState->useProgram(programId);
+      glUniform1i(glGetUniformLocation(programId, "incomingFrame"), 0);
+      glUniform1i(glGetUniformLocation(programId, "outgoingFrame"), 1);
+      glUniform1i(glGetUniformLocation(programId, "transitionMask"), 2);
+    }
+  }
+
+  void ScreenTransition::start(ScreenTransitionEffect effect, Timing::Timestamp duration) {
+    if (effect == ScreenTransitionEffect::MaskWipe && _mask == nullptr) {
+      _logger.logError("A mask wipe cannot start without a mask.");
+      throw Exceptions::InvalidOperationException("A mask wipe cannot start without a mask.");
+    }
+
+    _effect = effect;
+    _duration = duration;
+    _elapsed = Timing::Timestamp::zero();
+    _progress = 0.0f;
+    _state = ScreenTransitionState::CapturingOutgoing;
+    _hasChanged = true;
+  }
+
+  void ScreenTransition::update(Timing::Timestamp delta) {
+    if (!isActive()) return;
+
+    _elapsed += delta;
+    if (_elapsed >= _duration) {
+      finish();
+      return;
+    }
+
+    setProgress(static_cast<float>(_elapsed.getSecondsDouble() / _duration.getSecondsDouble()));
+  }
+
+  void ScreenTransition::finish() {
+    if (!isActive()) return;
+
+    _progress = 1.0f;
+    _state = ScreenTransitionState::Idle;
+    _hasChanged = true;
+    Finished();
+  }
+
+  void ScreenTransition::setProgress(float value) noexcept {
+    auto progress = std::clamp(value, 0.0f, 1.0f);
+    if (_progress == progress) return;
+
+    _progress = progress;
+    _hasChanged = true;
+  }
+
+  void ScreenTransition::setFadeColour(RGBAConfig value) noexcept {
+    _fadeColour = value;
+    _hasChanged = true;
+  }
+
+  void ScreenTransition::setMask(std::shared_ptr<Texture> value) noexcept {
+    _mask = value;
+    _hasChanged = true;
+  }
+
+  void ScreenTransition::setSoftness(float value) noexcept {
+    _softness = std::max(value, 0.0f);
+    _hasChanged = true;
+  }
+
+  void ScreenTransition::setMaxBlurLevel(float value) noexcept {
+    _maxBlurLevel = std::clamp(value, 0.0f, static_cast<float>(MaxBlurLevelLimit));
+    _hasChanged = true;
+  }
+
+  bool ScreenTransition::render(const std::function<void()>& drawFrame, bool hasFrameChanged, Maths::GeoVector2F targetSize, GLuint mainFramebuffer) {
+    if (_depthBuffer == 0 || _depthBufferSize != targetSize) {
+      if (_depthBuffer == 0) {
+        glGenRenderbuffers(1, &_depthBuffer);
+      }
+
+      glBindRenderbuffer(GL_RENDERBUFFER, _depthBuffer);
+      glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, static_cast<GLsizei>(targetSize.x), static_cast<GLsizei>(targetSize.y));
+      glBindRenderbuffer(GL_RENDERBUFFER, 0);
+      _depthBufferSize = targetSize;
+    }
+
+    auto isDrawn = false;
+    if (_state == ScreenTransitionState::CapturingOutgoing) {
+      resizeTarget(_outgoingFramebuffer, _outgoingTexture, _outgoingSize, targetSize);
+      capture(drawFrame, _outgoingFramebuffer, _outgoingTexture, mainFramebuffer);
+      _state = ScreenTransitionState::CapturingIncoming;
+      _wasOutgoingFrameCaptured = true;
+      isDrawn = true;
+    }
+    else if (_state == ScreenTransitionState::CapturingIncoming || hasFrameChanged || _incomingSize != targetSize) {
+      //The outgoing frame can never be drawn again, so after a resize it is stretched rather than captured again.
+      resizeTarget(_incomingFramebuffer, _incomingTexture, _incomingSize, targetSize);
+      capture(drawFrame, _incomingFramebuffer, _incomingTexture, mainFramebuffer);
+      _state = ScreenTransitionState::Running;
+      isDrawn = true;
+    }
+
+    drawComposite(mainFramebuffer);
+    return isDrawn;
+  }
+
+  void ScreenTransition::resizeTarget(GLuint& framebuffer, GLuint& texture, Maths::GeoVector2F& currentSize, Maths::GeoVector2F targetSize) {
+    if (texture != 0 && currentSize == targetSize) return;
+
+    //Immutable storage cannot change size, so a resized target gets a new texture.
+    if (texture != 0) {
+      glDeleteTextures(1, &texture);
+      _glState->onTextureDeleted(texture);
+    }
+
+    if (framebuffer == 0) {
+      glGenFramebuffers(1, &framebuffer);
+    }
+
+    //Every frame gets the mip levels the Blur effect reads, although they are only generated for blurs.
+    auto width = static_cast<GLsizei>(targetSize.x);
+    auto height = static_cast<GLsizei>(targetSize.y);
+    auto levelCount = static_cast<GLsizei>(std::min<uint32_t>(MaxBlurLevelLimit + 1, static_cast<uint32_t>(std::log2(std::max(std::max(width, height), 1))) + 1));
+    glGenTextures(1, &texture);
+    _glState->bindTexture2D(texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexStorage2D(GL_TEXTURE_2D, levelCount, GL_RGBA8, width, height);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, _depthBuffer);
+
+    auto status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+      _logger.logError("A screen transition's framebuffer is incomplete. Status: {:#x}", status);
+      throw Exceptions::InitialisationFailureException("Unable to continue! A screen transition's framebuffer could not be created.", static_cast<int32_t>(status));
+    }
+
+    currentSize = targetSize;
+  }
+
+  void ScreenTransition::capture(const std::function<void()>& drawFrame, GLuint framebuffer, GLuint texture, GLuint mainFramebuffer) {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    drawFrame();
+
+    if (_effect == ScreenTransitionEffect::Blur) {
+      _glState->bindTexture2D(texture);
+      glGenerateMipmap(GL_TEXTURE_2D);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, mainFramebuffer);
+    _captureCount++;
+  }
+
+  void ScreenTransition::drawComposite(GLuint mainFramebuffer) {
+    if (_vertexArray == 0) {
+      glGenVertexArrays(1, &_vertexArray);
+    }
+
+    auto effectIndex = static_cast<size_t>(_effect);
+    const auto& locations = _programLocations[effectIndex];
+    //Until the incoming frame has been captured, the outgoing one stands in for it.
+    auto incomingTexture = _state == ScreenTransitionState::Running ? _incomingTexture : _outgoingTexture;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, mainFramebuffer);
+    _glState->disable(GL_DEPTH_TEST);
+    _glState->disable(GL_BLEND);
+    _glState->useProgram(_programs[effectIndex].shaderProgramId);
+    glUniform1f(locations.progress, _progress);
+    glUniform4f(locations.fadeColour, _fadeColour.getRScalar(), _fadeColour.getGScalar(), _fadeColour.getBScalar(), _fadeColour.getAScalar());
+    glUniform1f(locations.softness, _softness);
+    glUniform1f(locations.maxBlurLevel, _maxBlurLevel);
+
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, _outgoingTexture);
+    if (_effect == ScreenTransitionEffect::MaskWipe && _mask != nullptr) {
+      glActiveTexture(GL_TEXTURE2);
+      glBindTexture(GL_TEXTURE_2D, _mask->getTextureIdInternal());
+    }
+
+    glActiveTexture(GL_TEXTURE0);
+    _glState->bindTexture2D(incomingTexture);
+    _glState->bindVertexArray(_vertexArray);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    _glState->enable(GL_DEPTH_TEST);
+    _glState->enable(GL_BLEND);
+  }
+
+  ScreenTransition::~ScreenTransition() {
+    for (auto framebuffer : { _outgoingFramebuffer, _incomingFramebuffer }) {
+      if (framebuffer != 0) {
+        glDeleteFramebuffers(1, &framebuffer);
+      }
+    }
+
+    for (auto texture : { _outgoingTexture, _incomingTexture }) {
+      if (texture != 0) {
+        glDeleteTextures(1, &texture);
+        _glState->onTextureDeleted(texture);
+      }
+    }
+
+    if (_depthBuffer != 0) {
+      glDeleteRenderbuffers(1, &_depthBuffer);
+    }
+
+    if (_vertexArray != 0) {
+      glDeleteVertexArrays(1, &_vertexArray);
+      _glState->onVertexArrayDeleted(_vertexArray);
+    }
+  }
+}
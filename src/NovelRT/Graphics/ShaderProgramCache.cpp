@@ -0,0 +1,165 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  static const uint32_t BINARY_FILE_MAGIC = 0x5052544E; // "NRTP"
+  static const uint32_t BINARY_FILE_VERSION = 1;
+
+  struct BinaryFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint32_t binaryFormat;
+    uint32_t binaryLength;
+  };
+
+  ShaderProgramCache::ShaderProgramCache(std::filesystem::path cacheDirectory, const std::string& renderer, const std::string& version) :
+    _cacheDirectory(cacheDirectory),
+    _deviceIdentity(renderer + "\n" + version),
+    _isSupported(false),
+    _hitCount(0),
+    _missCount(0),
+    _logger(Utilities::Misc::CONSOLE_LOG_GFX) {
+    //Plenty of GLES drivers expose glProgramBinary but support no formats at all, which makes every binary useless.
+    GLint formatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    _isSupported = formatCount > 0;
+
+    if (!_isSupported) {
+      _logger.logInfo("This driver does not support program binaries. Shaders will be compiled on every launch.");
+    }
+  }
+
+  std::filesystem::path ShaderProgramCache::getBinaryPath(uint64_t key) const {
+    std::stringstream fileName;
+    fileName << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+    return _cacheDirectory / fileName.str();
+  }
+
+  uint64_t ShaderProgramCache::getKey(const std::string& vertexSource, const std::string& fragmentSource) const {
+    //The separators stop a character moving from the end of one part to the start of the next from giving the same key.
+    auto key = hash(_deviceIdentity);
+    key = hash("\x1F", key);
+    key = hash(vertexSource, key);
+    key = hash("\x1F", key);
+    return hash(fragmentSource, key);
+  }
+
+  bool ShaderProgramCache::tryLoad(uint64_t key, GLuint programId) {
+    if (!_isSupported) return false;
+
+    std::ifstream file(getBinaryPath(key), std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+      _missCount++;
+      return false;
+    }
+
+    BinaryFileHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.magic != BINARY_FILE_MAGIC || header.version != BINARY_FILE_VERSION || header.key != key) {
+      _logger.logWarning("Shader program cache entry {} is not valid. It will be rebuilt.", getBinaryPath(key).string());
+      _missCount++;
+      return false;
+    }
+
+    std::vector<char> binary(header.binaryLength);
+    file.read(binary.data(), static_cast<std::streamsize>(binary.size()));
+    if (!file) {
+      _logger.logWarning("Shader program cache entry {} is truncated. It will be rebuilt.", getBinaryPath(key).string());
+      _missCount++;
+      return false;
+    }
+
+    glProgramBinary(programId, header.binaryFormat, binary.data(), static_cast<GLsizei>(binary.size()));
+
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(programId, GL_LINK_STATUS, &linkStatus);
+    if (linkStatus != GL_TRUE) {
+      //Usually a driver update that kept the same version string. Building from source will replace the entry.
+      _logger.logInfo("The driver rejected cached shader program {}. It will be rebuilt.", getBinaryPath(key).string());
+      _missCount++;
+      return false;
+    }
+
+    _hitCount++;
+    return true;
+  }
+
+  void ShaderProgramCache::store(uint64_t key, GLuint programId) {
+    if (!_isSupported) return;
+
+    GLint binaryLength = 0;
+    glGetProgramiv(programId, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    if (binaryLength <= 0) return;
+
+    std::vector<char> binary(static_cast<size_t>(binaryLength));
+    GLenum binaryFormat = 0;
+    GLsizei writtenLength = 0;
+    glGetProgramBinary(programId, binaryLength, &writtenLength, &binaryFormat, binary.data());
+    if (writtenLength <= 0) return;
+
+    std::error_code error;
+    std::filesystem::create_directories(_cacheDirectory, error);
+    if (error) {
+      _logger.logWarning("Shader program cache directory {} could not be created: {}", _cacheDirectory.string(), error.message());
+      return;
+    }
+
+    //Write to a temporary file first, so that a crash part way through can never leave a half written entry behind.
+    auto binaryPath = getBinaryPath(key);
+    auto temporaryPath = binaryPath;
+    temporaryPath += ".tmp";
+
+    {
+      std::ofstream file(temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc);
+      BinaryFileHeader header{BINARY_FILE_MAGIC, BINARY_FILE_VERSION, key, binaryFormat, static_cast<uint32_t>(writtenLength)};
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      file.write(binary.data(), writtenLength);
+
+      if (!file) {
+        _logger.logWarning("Shader program cache entry {} could not be written.", binaryPath.string());
+        return;
+      }
+    }
+
+    std::filesystem::rename(temporaryPath, binaryPath, error);
+    if (error) {
+      _logger.logWarning("Shader program cache entry {} could not be written: {}", binaryPath.string(), error.message());
+      std::filesystem::remove(temporaryPath, error);
+    }
+  }
+
+  uint64_t ShaderProgramCache::hash(const std::string& value, uint64_t seed) noexcept {
+    auto result = seed;
+    for (auto character : value) {
+      result ^= static_cast<uint8_t>(character);
+      result *= 1099511628211ull;
+    }
+
+    return result;
+  }
+
+  std::string ShaderProgramCache::applyDefines(const std::string& source, const std::vector<std::string>& defines) {
+    if (defines.empty()) return source;
+
+    std::string defineLines;
+    for (auto& define : defines) {
+      defineLines += "#define " + define + "\n";
+    }
+
+    auto versionStart = source.find("#version");
+    if (versionStart == std::string::npos) {
+      return defineLines + source;
+    }
+
+    auto versionEnd = source.find('\n', versionStart);
+    if (versionEnd == std::string::npos) {
+      return source + "\n" + defineLines;
+    }
+
+    auto result = source;
+    result.insert(versionEnd + 1, defineLines);
+    return result;
+  }
+}
@@ -0,0 +1,136 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  static const GLuint VERTEX_POSITION_LOCATION = 0;
+  static const GLuint VERTEX_COLOUR_LOCATION = 1;
+
+  //The two triangles of a unit quad centred on the origin.
+  static const float UNIT_QUAD_CORNERS[6][2] = {
+    { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f },
+    { -0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f }
+  };
+
+  static GLuint generateVertexArray() {
+    GLuint tempVao;
+    glGenVertexArrays(1, &tempVao);
+    return tempVao;
+  }
+
+  static GLuint generateBuffer() {
+    GLuint tempBuffer;
+    glGenBuffers(1, &tempBuffer);
+    return tempBuffer;
+  }
+
+  ShapeBatch::ShapeBatch(std::shared_ptr<GLStateCache> glState) noexcept :
+    _glState(glState),
+    _vertexArrayObject(Utilities::Lazy<GLuint>(generateVertexArray)),
+    _vertexBuffer(Utilities::Lazy<GLuint>(generateBuffer)),
+    _vertexBufferCapacity(0),
+    _vertices(),
+    _runs(),
+    _vertexCount(0),
+    _drawCallCount(0) {}
+
+  ShapeVertex* ShapeBatch::beginShape(GLuint shaderProgramId, size_t vertexCount) {
+    //Shapes keep their submission order, so only a change of program splits them into another draw call.
+    if (_runs.empty() || _runs.back().shaderProgramId != shaderProgramId) {
+      _runs.push_back(Run{shaderProgramId, _vertices.size(), 0});
+    }
+
+    _runs.back().vertexCount += vertexCount;
+    _vertices.resize(_vertices.size() + vertexCount);
+    return _vertices.data() + (_vertices.size() - vertexCount);
+  }
+
+  void ShapeBatch::submit(GLuint shaderProgramId, const std::vector<ShapeVertex>& vertices, float depth) {
+    if (vertices.empty()) return;
+
+    auto target = beginShape(shaderProgramId, vertices.size());
+    for (const auto& vertex : vertices) {
+      *target = vertex;
+      target->position.z = depth;
+      target++;
+    }
+  }
+
+  void ShapeBatch::submit(GLuint shaderProgramId, const ShapeVertex* vertices, size_t vertexCount) {
+    if (vertexCount == 0) return;
+
+    std::copy(vertices, vertices + vertexCount, beginShape(shaderProgramId, vertexCount));
+  }
+
+  void ShapeBatch::submitQuad(GLuint shaderProgramId, const Maths::GeoMatrix4x4F& modelMatrix, std::array<uint8_t, 4> colour) {
+    writeQuad(beginShape(shaderProgramId, 6), modelMatrix, colour);
+  }
+
+  void ShapeBatch::writeQuad(ShapeVertex* target, const Maths::GeoMatrix4x4F& modelMatrix, std::array<uint8_t, 4> colour) noexcept {
+    for (const auto& corner : UNIT_QUAD_CORNERS) {
+      target->position = Maths::GeoVector3F(
+        (modelMatrix.x.x * corner[0]) + (modelMatrix.y.x * corner[1]) + modelMatrix.w.x,
+        (modelMatrix.x.y * corner[0]) + (modelMatrix.y.y * corner[1]) + modelMatrix.w.y,
+        (modelMatrix.x.z * corner[0]) + (modelMatrix.y.z * corner[1]) + modelMatrix.w.z);
+      target->colour = colour;
+      target++;
+    }
+  }
+
+  void ShapeBatch::configureVertexArray() {
+    _glState->bindVertexArray(_vertexArrayObject.getActual());
+    _glState->bindBuffer(GL_ARRAY_BUFFER, _vertexBuffer.getActual());
+
+    auto stride = static_cast<GLsizei>(sizeof(ShapeVertex));
+    glEnableVertexAttribArray(VERTEX_POSITION_LOCATION);
+    glVertexAttribPointer(VERTEX_POSITION_LOCATION, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const GLvoid*>(offsetof(ShapeVertex, position)));
+    glEnableVertexAttribArray(VERTEX_COLOUR_LOCATION);
+    glVertexAttribPointer(VERTEX_COLOUR_LOCATION, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, reinterpret_cast<const GLvoid*>(offsetof(ShapeVertex, colour)));
+  }
+
+  void ShapeBatch::flush() {
+    if (_vertices.empty()) return;
+
+    if (!_vertexArrayObject.isCreated()) {
+      configureVertexArray();
+    }
+
+    _glState->bindVertexArray(_vertexArrayObject.getActual());
+    _glState->bindBuffer(GL_ARRAY_BUFFER, _vertexBuffer.getActual());
+
+    auto requiredSize = sizeof(ShapeVertex) * _vertices.size();
+    if (requiredSize > _vertexBufferCapacity) {
+      _vertexBufferCapacity = requiredSize;
+      glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(requiredSize), _vertices.data(), GL_STREAM_DRAW);
+    }
+    else {
+      //Orphan the storage the last flush drew from, so the driver does not have to wait on it before we overwrite it.
+      glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(_vertexBufferCapacity), nullptr, GL_STREAM_DRAW);
+      glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(requiredSize), _vertices.data());
+    }
+
+    for (const auto& run : _runs) {
+      _glState->useProgram(run.shaderProgramId);
+      glDrawArrays(GL_TRIANGLES, static_cast<GLint>(run.firstVertex), static_cast<GLsizei>(run.vertexCount));
+    }
+
+    _vertexCount += static_cast<uint32_t>(_vertices.size());
+    _drawCallCount += static_cast<uint32_t>(_runs.size());
+    _vertices.clear();
+    _runs.clear();
+  }
+
+  ShapeBatch::~ShapeBatch() {
+    if (_vertexBuffer.isCreated()) {
+      auto buffer = _vertexBuffer.getActual();
+      glDeleteBuffers(1, &buffer);
+      _glState->onBufferDeleted(buffer);
+    }
+
+    if (!_vertexArrayObject.isCreated()) return;
+
+    auto vao = _vertexArrayObject.getActual();
+    glDeleteVertexArrays(1, &vao);
+    _glState->onVertexArrayDeleted(vao);
+  }
+}
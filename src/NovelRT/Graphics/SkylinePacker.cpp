@@ -0,0 +1,86 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  SkylinePacker::SkylinePacker(uint32_t width, uint32_t height) noexcept :
+    _width(width),
+    _height(height),
+    _skyline{Segment{0, 0, width}} {}
+
+  bool SkylinePacker::tryFit(size_t segmentIndex, uint32_t width, uint32_t height, uint32_t& y) const noexcept {
+    auto x = _skyline[segmentIndex].x;
+    if (x + width > _width) return false;
+
+    //The rectangle has to sit on top of the highest segment it spans.
+    uint32_t top = 0;
+    uint32_t remainingWidth = width;
+    for (auto i = segmentIndex; remainingWidth > 0; i++) {
+      top = std::max(top, _skyline[i].y);
+      if (top + height > _height) return false;
+
+      remainingWidth -= std::min(remainingWidth, _skyline[i].width);
+    }
+
+    y = top;
+    return true;
+  }
+
+  bool SkylinePacker::tryPack(uint32_t width, uint32_t height, uint32_t& x, uint32_t& y) {
+    if (width == 0 || height == 0) {
+      x = 0;
+      y = 0;
+      return true;
+    }
+
+    auto bestIndex = _skyline.size();
+    uint32_t bestY = std::numeric_limits<uint32_t>::max();
+    uint32_t bestWidth = std::numeric_limits<uint32_t>::max();
+
+    for (size_t i = 0; i < _skyline.size(); i++) {
+      uint32_t candidateY;
+      if (!tryFit(i, width, height, candidateY)) continue;
+
+      //Prefer the lowest spot, and the narrowest segment among equally low spots so wide gaps stay open for wide glyphs.
+      if (candidateY < bestY || (candidateY == bestY && _skyline[i].width < bestWidth)) {
+        bestIndex = i;
+        bestY = candidateY;
+        bestWidth = _skyline[i].width;
+      }
+    }
+
+    if (bestIndex == _skyline.size()) return false;
+
+    x = _skyline[bestIndex].x;
+    y = bestY;
+
+    _skyline.insert(_skyline.begin() + static_cast<std::vector<Segment>::difference_type>(bestIndex), Segment{x, y + height, width});
+
+    //Shrink or drop the segments that the new one now covers.
+    auto newRight = x + width;
+    auto i = bestIndex + 1;
+    while (i < _skyline.size() && _skyline[i].x < newRight) {
+      auto segmentRight = _skyline[i].x + _skyline[i].width;
+      if (segmentRight <= newRight) {
+        _skyline.erase(_skyline.begin() + static_cast<std::vector<Segment>::difference_type>(i));
+        continue;
+      }
+
+      _skyline[i].width = segmentRight - newRight;
+      _skyline[i].x = newRight;
+      break;
+    }
+
+    //Neighbours at the same height behave as one segment, so merge them to keep the skyline short.
+    for (size_t j = 0; j + 1 < _skyline.size();) {
+      if (_skyline[j].y == _skyline[j + 1].y) {
+        _skyline[j].width += _skyline[j + 1].width;
+        _skyline.erase(_skyline.begin() + static_cast<std::vector<Segment>::difference_type>(j + 1));
+        continue;
+      }
+      j++;
+    }
+
+    return true;
+  }
+}
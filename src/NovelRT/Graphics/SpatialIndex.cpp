@@ -0,0 +1,82 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  SpatialIndex::SpatialIndex(Maths::GeoBounds worldBounds) noexcept :
+    _tree(std::make_shared<Maths::QuadTree>(worldBounds)),
+    _objects(),
+    _unindexedObjects(),
+    _queryResults(),
+    _cullId(0),
+    _lastVisibleCount(0),
+    _lastCullBounds(Maths::GeoVector2F::zero(), Maths::GeoVector2F::zero(), 0.0f) {}
+
+  void SpatialIndex::detach(const std::shared_ptr<IndexedObject>& entry) {
+    if (entry->isInTree) {
+      _tree->tryRemove(entry);
+      return;
+    }
+
+    auto match = std::find(_unindexedObjects.begin(), _unindexedObjects.end(), entry);
+    if (match == _unindexedObjects.end()) return;
+
+    *match = _unindexedObjects.back();
+    _unindexedObjects.pop_back();
+  }
+
+  void SpatialIndex::update(RenderObject* object, Maths::GeoBounds bounds) {
+    auto match = _objects.find(object);
+    if (match != _objects.end()) {
+      if (match->second->bounds == bounds) return;
+
+      detach(match->second);
+    }
+
+    //QuadTreePoint positions are immutable, so a moved object always gets a fresh entry.
+    auto entry = std::make_shared<IndexedObject>(object, bounds);
+    auto extents = bounds.getExtents();
+    entry->isInTree = (extents.x <= MaxIndexedExtent) && (extents.y <= MaxIndexedExtent) && _tree->tryInsert(entry);
+
+    if (!entry->isInTree) {
+      _unindexedObjects.push_back(entry);
+    }
+
+    _objects[object] = entry;
+  }
+
+  void SpatialIndex::remove(const RenderObject* object) {
+    auto match = _objects.find(object);
+    if (match == _objects.end()) return;
+
+    detach(match->second);
+    _objects.erase(match);
+  }
+
+  void SpatialIndex::cull(Maths::GeoBounds visibleBounds) {
+    _cullId++;
+    _lastVisibleCount = 0;
+    _lastCullBounds = visibleBounds;
+
+    //Only centres are stored in the tree, so widen the query by the largest extent an indexed object can have.
+    auto queryBounds = Maths::GeoBounds(visibleBounds.position, visibleBounds.size + Maths::GeoVector2F(MaxIndexedExtent * 2.0f, MaxIndexedExtent * 2.0f), 0.0f);
+
+    _queryResults.clear();
+    _tree->getIntersectingPoints(queryBounds, _queryResults);
+
+    for (auto& point : _queryResults) {
+      auto entry = std::static_pointer_cast<IndexedObject>(point);
+      if (!visibleBounds.intersectsWith(entry->bounds)) continue;
+
+      entry->object->_visibleCullId = _cullId;
+      _lastVisibleCount++;
+    }
+
+    for (auto& entry : _unindexedObjects) {
+      if (!visibleBounds.intersectsWith(entry->bounds)) continue;
+
+      entry->object->_visibleCullId = _cullId;
+      _lastVisibleCount++;
+    }
+  }
+}
@@ -0,0 +1,39 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  SpriteAtlas::SpriteAtlas(std::vector<std::shared_ptr<Texture>> pages, std::vector<SpriteAtlasRegion> regions) :
+    _pages(std::move(pages)),
+    _regions(std::move(regions)),
+    _regionIndices(),
+    _logger(Utilities::Misc::CONSOLE_LOG_GFX) {
+    for (size_t i = 0; i < _regions.size(); i++) {
+      _regionIndices.emplace(_regions[i].name, i);
+    }
+  }
+
+  TextureRegion SpriteAtlas::getRegion(const std::string& name) {
+    auto match = _regionIndices.find(name);
+    if (match == _regionIndices.end()) {
+      _logger.logError("The sprite atlas does not contain a region named {}.", name);
+      throw Exceptions::InvalidOperationException("Unable to continue! The requested sprite atlas region does not exist.");
+    }
+
+    auto& region = _regions[match->second];
+    auto& page = _pages.at(region.page);
+
+    TextureRegion result;
+    result.texture = page;
+    result.uvRect = page->getRegion(region.x, region.y, region.width, region.height).uvRect;
+
+    if (region.sourceWidth > 0 && region.sourceHeight > 0) {
+      auto sourceWidth = static_cast<float>(region.sourceWidth);
+      auto sourceHeight = static_cast<float>(region.sourceHeight);
+      result.contentRect = Maths::GeoVector4F(region.trimX / sourceWidth, region.trimY / sourceHeight,
+        region.width / sourceWidth, region.height / sourceHeight);
+    }
+
+    return result;
+  }
+}
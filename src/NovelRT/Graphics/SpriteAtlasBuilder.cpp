@@ -0,0 +1,189 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  static const char* const ManifestHeader = "NovelRTSpriteAtlas";
+  static const uint32_t ManifestVersion = 1;
+
+  SpriteAtlasBuilder::SpriteAtlasBuilder(uint32_t pageSize, uint32_t padding, bool shouldTrim) :
+    _pageSize(pageSize),
+    _padding(padding),
+    _shouldTrim(shouldTrim),
+    _pendingImages(),
+    _pages(),
+    _regions(),
+    _logger(Utilities::Misc::CONSOLE_LOG_GFX) {}
+
+  void SpriteAtlasBuilder::addImage(const std::string& name, RgbaImage image) {
+    _pendingImages.push_back(PendingImage{name, std::move(image)});
+  }
+
+  void SpriteAtlasBuilder::findOpaqueBounds(const RgbaImage& image, uint32_t& x, uint32_t& y, uint32_t& width, uint32_t& height) noexcept {
+    auto left = image.width;
+    auto top = image.height;
+    uint32_t right = 0;
+    uint32_t bottom = 0;
+
+    for (uint32_t row = 0; row < image.height; row++) {
+      for (uint32_t column = 0; column < image.width; column++) {
+        if (image.getPixel(column, row)[3] == 0) continue;
+
+        left = std::min(left, column);
+        top = std::min(top, row);
+        right = std::max(right, column + 1);
+        bottom = std::max(bottom, row + 1);
+      }
+    }
+
+    if (right == 0) {
+      //Nothing visible at all, so there is nothing to pack.
+      x = 0;
+      y = 0;
+      width = 0;
+      height = 0;
+      return;
+    }
+
+    x = left;
+    y = top;
+    width = right - left;
+    height = bottom - top;
+  }
+
+  void SpriteAtlasBuilder::build() {
+    _pages.clear();
+    _regions.clear();
+    _regions.resize(_pendingImages.size());
+
+    for (size_t i = 0; i < _pendingImages.size(); i++) {
+      auto& image = _pendingImages[i].image;
+      auto& region = _regions[i];
+      region.name = _pendingImages[i].name;
+      region.sourceWidth = image.width;
+      region.sourceHeight = image.height;
+
+      if (_shouldTrim) {
+        findOpaqueBounds(image, region.trimX, region.trimY, region.width, region.height);
+      }
+      else {
+        region.width = image.width;
+        region.height = image.height;
+      }
+    }
+
+    //Packing the biggest images first leaves the small ones to fill the gaps, which gets much closer to optimal than packing in order.
+    std::vector<size_t> packingOrder(_regions.size());
+    for (size_t i = 0; i < packingOrder.size(); i++) {
+      packingOrder[i] = i;
+    }
+
+    std::stable_sort(packingOrder.begin(), packingOrder.end(), [this](size_t left, size_t right) {
+      auto& leftRegion = _regions[left];
+      auto& rightRegion = _regions[right];
+      auto leftSide = std::max(leftRegion.width, leftRegion.height);
+      auto rightSide = std::max(rightRegion.width, rightRegion.height);
+      if (leftSide != rightSide) return leftSide > rightSide;
+
+      return static_cast<uint64_t>(leftRegion.width) * leftRegion.height > static_cast<uint64_t>(rightRegion.width) * rightRegion.height;
+    });
+
+    //Every image reserves a gutter on its right and bottom. Shrinking the usable page by one gutter and shifting everything
+    //across by one gives the images along the top and left edges a gutter too.
+    std::vector<MaxRectsPacker> packers;
+    auto usableSize = _pageSize > _padding ? _pageSize - _padding : 0;
+
+    for (auto index : packingOrder) {
+      auto& region = _regions[index];
+      if (region.width == 0 || region.height == 0) continue;
+
+      auto packedWidth = region.width + _padding;
+      auto packedHeight = region.height + _padding;
+      auto isPacked = false;
+
+      for (size_t page = 0; page < packers.size() && !isPacked; page++) {
+        if (packers[page].tryPack(packedWidth, packedHeight, region.x, region.y)) {
+          region.page = static_cast<uint32_t>(page);
+          isPacked = true;
+        }
+      }
+
+      if (!isPacked) {
+        packers.emplace_back(usableSize, usableSize);
+        if (!packers.back().tryPack(packedWidth, packedHeight, region.x, region.y)) {
+          _logger.logError("Image {} is too large to fit in a {} pixel atlas page.", region.name, _pageSize);
+          throw Exceptions::InvalidOperationException("Unable to continue! An image is larger than the sprite atlas page size.");
+        }
+
+        region.page = static_cast<uint32_t>(packers.size() - 1);
+      }
+
+      region.x += _padding;
+      region.y += _padding;
+    }
+
+    if (packers.empty() && !_regions.empty()) {
+      //Only fully transparent images were added. They still need a page to point at.
+      packers.emplace_back(usableSize, usableSize);
+    }
+
+    _pages.resize(packers.size(), RgbaImage(_pageSize, _pageSize));
+
+    for (size_t i = 0; i < _regions.size(); i++) {
+      auto& region = _regions[i];
+      auto& image = _pendingImages[i].image;
+      auto& page = _pages[region.page];
+      auto rowBytes = static_cast<size_t>(region.width) * RgbaImage::BytesPerPixel;
+
+      for (uint32_t row = 0; row < region.height; row++) {
+        std::copy_n(image.getPixel(region.trimX, region.trimY + row), rowBytes, page.getPixel(region.x, region.y + row));
+      }
+    }
+  }
+
+  void SpriteAtlasBuilder::writeManifest(std::ostream& output, const std::vector<std::string>& pageFiles) const {
+    output << ManifestHeader << ' ' << ManifestVersion << '\n';
+
+    output << "pages " << pageFiles.size() << '\n';
+    for (auto& pageFile : pageFiles) {
+      output << std::quoted(pageFile) << '\n';
+    }
+
+    output << "regions " << _regions.size() << '\n';
+    for (auto& region : _regions) {
+      output << std::quoted(region.name) << ' ' << region.page << ' '
+        << region.x << ' ' << region.y << ' ' << region.width << ' ' << region.height << ' '
+        << region.trimX << ' ' << region.trimY << ' ' << region.sourceWidth << ' ' << region.sourceHeight << '\n';
+    }
+  }
+
+  bool SpriteAtlasBuilder::tryReadManifest(std::istream& input, std::vector<std::string>& pageFiles, std::vector<SpriteAtlasRegion>& regions) {
+    std::string token;
+    uint32_t version = 0;
+    if (!(input >> token >> version) || token != ManifestHeader || version != ManifestVersion) return false;
+
+    size_t pageCount = 0;
+    if (!(input >> token >> pageCount) || token != "pages") return false;
+
+    pageFiles.resize(pageCount);
+    for (auto& pageFile : pageFiles) {
+      if (!(input >> std::quoted(pageFile))) return false;
+    }
+
+    size_t regionCount = 0;
+    if (!(input >> token >> regionCount) || token != "regions") return false;
+
+    regions.resize(regionCount);
+    for (auto& region : regions) {
+      if (!(input >> std::quoted(region.name) >> region.page
+        >> region.x >> region.y >> region.width >> region.height
+        >> region.trimX >> region.trimY >> region.sourceWidth >> region.sourceHeight)) {
+        return false;
+      }
+
+      if (region.page >= pageCount) return false;
+    }
+
+    return true;
+  }
+}
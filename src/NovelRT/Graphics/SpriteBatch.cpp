@@ -0,0 +1,67 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  SpriteBatch::SpriteBatch(std::unique_ptr<SpriteBatchBackend> backend) noexcept :
+    _backend(std::move(backend)),
+    _groupLookup(),
+    _groups(),
+    _groupInstances(),
+    _instances(),
+    _spriteCount(0),
+    _drawCallCount(0) {}
+
+  void SpriteBatch::submit(GLuint shaderProgramId, const std::shared_ptr<Texture>& texture, const SpriteInstanceData& instance) {
+    submit(shaderProgramId, texture, &instance, 1);
+  }
+
+  void SpriteBatch::submit(GLuint shaderProgramId, const std::shared_ptr<Texture>& texture, const SpriteInstanceData* instances, size_t instanceCount) {
+    if (instanceCount == 0) return;
+
+    auto key = std::make_pair(shaderProgramId, static_cast<const Texture*>(texture.get()));
+    auto match = _groupLookup.find(key);
+
+    size_t groupIndex;
+    if (match == _groupLookup.end()) {
+      groupIndex = _groups.size();
+      _groupLookup.emplace(key, groupIndex);
+
+      SpriteBatchGroup group;
+      group.shaderProgramId = shaderProgramId;
+      group.texture = texture;
+      _groups.push_back(group);
+
+      //the instance vectors are kept around between frames so that their storage can be reused.
+      if (_groupInstances.size() <= groupIndex) {
+        _groupInstances.emplace_back();
+      }
+    }
+    else {
+      groupIndex = match->second;
+    }
+
+    _groupInstances[groupIndex].insert(_groupInstances[groupIndex].end(), instances, instances + instanceCount);
+  }
+
+  void SpriteBatch::flush() {
+    if (_groups.empty()) return;
+
+    _instances.clear();
+    for (size_t i = 0; i < _groups.size(); i++) {
+      auto& instances = _groupInstances[i];
+      _groups[i].firstInstance = _instances.size();
+      _groups[i].instanceCount = instances.size();
+      _instances.insert(_instances.end(), instances.begin(), instances.end());
+      instances.clear();
+    }
+
+    _backend->submit(_instances, _groups);
+
+    _spriteCount += static_cast<uint32_t>(_instances.size());
+    _drawCallCount += static_cast<uint32_t>(_groups.size());
+
+    _groups.clear();
+    _groupLookup.clear();
+  }
+}
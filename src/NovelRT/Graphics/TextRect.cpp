@@ -3,97 +3,310 @@
 #include <NovelRT.h>
 
 namespace NovelRT::Graphics {
-  void TextRect::drawObject() {
-    for (auto& rect : _letterRects) {
-      rect->executeObjectBehaviour();
+  static const GLuint VERTEX_POSITION_LOCATION = 0;
+  static const GLuint VERTEX_TEXCOORD_LOCATION = 1;
+  static const GLuint COLOUR_TINT_LOCATION = 2;
+  static const size_t FLOATS_PER_VERTEX = 4;
+
+  //Reads the codepoint that starts at offset and moves offset past it. Malformed sequences decode to U+FFFD.
+  static char32_t readUtf8Codepoint(const std::string& text, size_t& offset) {
+    auto lead = static_cast<unsigned char>(text[offset++]);
+    if (lead < 0x80) return lead;
+
+    size_t continuationCount;
+    char32_t codepoint;
+    if ((lead & 0xE0) == 0xC0) {
+      continuationCount = 1;
+      codepoint = lead & 0x1F;
+    }
+    else if ((lead & 0xF0) == 0xE0) {
+      continuationCount = 2;
+      codepoint = lead & 0x0F;
+    }
+    else if ((lead & 0xF8) == 0xF0) {
+      continuationCount = 3;
+      codepoint = lead & 0x07;
+    }
+    else {
+      return 0xFFFD;
+    }
+
+    for (size_t i = 0; i < continuationCount; i++) {
+      if (offset >= text.length()) return 0xFFFD;
+
+      auto continuation = static_cast<unsigned char>(text[offset]);
+      if ((continuation & 0xC0) != 0x80) return 0xFFFD;
+
+      codepoint = (codepoint << 6) | (continuation & 0x3F);
+      offset++;
     }
+
+    return codepoint;
   }
 
-  void TextRect::setColourConfig(RGBAConfig value) {
-    _colourConfig = value;
-    configureObjectBuffers();
+  static GLuint generateVertexArray() {
+    GLuint tempVao;
+    glGenVertexArrays(1, &tempVao);
+    return tempVao;
   }
 
-  void TextRect::configureObjectBuffers() {
-    reloadText();
+  static GLuint generateBuffer() {
+    GLuint tempBuffer;
+    glGenBuffers(1, &tempBuffer);
+    return tempBuffer;
   }
 
   TextRect::TextRect(Transform transform,
     int32_t layer,
     ShaderProgram shaderProgram,
     std::shared_ptr<Camera> camera,
+    std::shared_ptr<RenderingService> renderer,
     std::shared_ptr<FontSet> fontSet,
     RGBAConfig colourConfig) :
     RenderObject(
       transform,
       layer,
       shaderProgram,
-      camera),
+      camera,
+      renderer),
     _text(""),
     _logger(Utilities::Misc::CONSOLE_LOG_GFX),
     _colourConfig(colourConfig),
-    _fontSet(fontSet) {}
+    _fontSet(fontSet),
+    _fontSize(fontSet != nullptr ? fontSet->getFontSize() : 0.0f),
+    _outlineColour(RGBAConfig(0, 0, 0, 0)),
+    _outlineWidth(0.0f),
+    _shadowColour(RGBAConfig(0, 0, 0, 0)),
+    _shadowOffset(Maths::GeoVector2F::zero()),
+    _outlineColourUniformLocation(glGetUniformLocation(shaderProgram.shaderProgramId, "outlineColour")),
+    _outlineWidthUniformLocation(glGetUniformLocation(shaderProgram.shaderProgramId, "outlineWidth")),
+    _shadowColourUniformLocation(glGetUniformLocation(shaderProgram.shaderProgramId, "shadowColour")),
+    _shadowOffsetUniformLocation(glGetUniformLocation(shaderProgram.shaderProgramId, "shadowOffset")),
+    _vertexArrayObject(Utilities::Lazy<GLuint>(generateVertexArray)),
+    _vertexBuffer(Utilities::Lazy<GLuint>(generateBuffer)),
+    _indexBuffer(Utilities::Lazy<GLuint>(generateBuffer)),
+    _vertexData(),
+    _indexData(),
+    _meshRanges(),
+    _meshBounds(Maths::GeoVector2F::zero(), Maths::GeoVector2F::zero(), 0.0f),
+    _isMeshDirty(true) {}
+
+  void TextRect::drawObject() {
+    if (!getActive() || _meshRanges.empty()) return;
+
+    //Sprites and shapes queued before this text have to reach the screen first, otherwise the batches would reorder them past us.
+    _renderer->getSpriteBatch().flush();
+    _renderer->getShapeBatch().flush();
+
+    auto& glState = _renderer->getGLStateCache();
+    glState.useProgram(_shaderProgram.shaderProgramId);
+    glUniformMatrix4fv(_shaderProgram.modelTransformUniformLocation, 1, GL_FALSE, reinterpret_cast<const GLfloat*>(&getModelMatrix()));
+    glVertexAttrib4f(COLOUR_TINT_LOCATION, _colourConfig.getRScalar(), _colourConfig.getGScalar(), _colourConfig.getBScalar(), _colourConfig.getAScalar());
+
+    if (_fontSet->getRenderMode() == FontRenderMode::DistanceField) {
+      //The field only measures distances up to its spread, so outlines and shadows cannot reach any further than that.
+      auto scale = getGlyphScale();
+      auto spread = static_cast<float>(FontSet::DistanceFieldSpread);
+      auto pageSize = _meshRanges.front().texture->getSize();
+      auto outlineWidth = std::clamp(_outlineWidth / scale, 0.0f, spread) / (spread * 2.0f);
+      auto shadowOffsetX = std::clamp(_shadowOffset.x / scale, -spread, spread) / pageSize.x;
+      auto shadowOffsetY = std::clamp(_shadowOffset.y / scale, -spread, spread) / pageSize.y;
+
+      glUniform4f(_outlineColourUniformLocation, _outlineColour.getRScalar(), _outlineColour.getGScalar(), _outlineColour.getBScalar(), _outlineColour.getAScalar());
+      glUniform1f(_outlineWidthUniformLocation, outlineWidth);
+      glUniform4f(_shadowColourUniformLocation, _shadowColour.getRScalar(), _shadowColour.getGScalar(), _shadowColour.getBScalar(), _shadowColour.getAScalar());
+      glUniform2f(_shadowOffsetUniformLocation, shadowOffsetX, shadowOffsetY);
+    }
+
+    glState.bindVertexArray(_vertexArrayObject.getActual());
+    for (auto& range : _meshRanges) {
+      glState.bindTexture2D(range.texture->getTextureIdInternal());
+      glDrawElements(GL_TRIANGLES, range.indexCount, GL_UNSIGNED_INT, reinterpret_cast<const GLvoid*>(range.firstIndex * sizeof(GLuint)));
+    }
+  }
+
+  bool TextRect::isTranslucent() const noexcept {
+    //Glyph edges are anti-aliased, so text always blends with what is behind it.
+    return true;
+  }
+
+  Maths::GeoVector2F TextRect::getModelScale() const {
+    //Glyph quads are already laid out in pixels, so the transform's scale does not apply. Only distance field text is scaled.
+    auto scale = getGlyphScale();
+    return Maths::GeoVector2F(scale, scale);
+  }
+
+  float TextRect::getGlyphScale() const noexcept {
+    if (_fontSet == nullptr || _fontSet->getRenderMode() != FontRenderMode::DistanceField || _fontSet->getFontSize() <= 0.0f) {
+      return 1.0f;
+    }
+
+    return _fontSize / _fontSet->getFontSize();
+  }
+
+  Maths::GeoBounds TextRect::getCullingBounds() const {
+    auto scale = getGlyphScale();
+    auto bounds = Maths::GeoBounds(_meshBounds.position * scale, _meshBounds.size * scale, 0.0f);
+    bounds.position += transform().position;
+    if (transform().rotation != 0.0f) {
+      //Rotation happens around the pen origin, so cover every direction the mesh could swing out to.
+      auto reach = (bounds.position - transform().position).getLength() + (bounds.size.getLength() / 2.0f);
+      bounds = Maths::GeoBounds(transform().position, Maths::GeoVector2F(reach * 2.0f, reach * 2.0f), 0.0f);
+    }
+
+    return bounds;
+  }
+
+  void TextRect::setColourConfig(RGBAConfig value) {
+    //The colour is a constant vertex attribute, so the mesh can stay as it is.
+    _colourConfig = value;
+    configureObjectBuffers();
+    _isDirty = true;
+  }
+
+  void TextRect::configureObjectBuffers() {
+    if (_isMeshDirty) {
+      rebuildMesh();
+      _isMeshDirty = false;
+    }
+  }
+
+  void TextRect::setFontSet(std::shared_ptr<FontSet> value) {
+    if (_fontSet != nullptr && value != nullptr && _fontSet->getRenderMode() != value->getRenderMode()) {
+      _logger.logError("A TextRect's FontSet cannot be replaced with one that uses a different render mode.");
+      throw Exceptions::InvalidOperationException("Unable to continue! The new FontSet needs a different shader to the one this TextRect was created with.");
+    }
+
+    _fontSet = value;
+    _isMeshDirty = true;
+    _isDirty = true;
+  }
 
   std::string TextRect::getText() const {
     return _text;
   }
+
   void TextRect::setText(const std::string& value) {
+    if (_text == value) return;
+
     _text = value;
+    _isMeshDirty = true;
+    _isDirty = true;
+  }
 
-    if (_letterRects.size() < _text.length()) {
-      size_t difference = _text.length() - _letterRects.size();
-      auto modifiedTransform = transform();
-      modifiedTransform.scale = Maths::GeoVector2F(50, 50);
-      for (size_t i = 0; i < difference; i++) {
-        auto rect = std::make_unique<ImageRect>(
-          modifiedTransform,
-          layer(),
-          _shaderProgram,
-          _camera,
-          _colourConfig);
-        rect->setActive(getActive());
-        _letterRects.push_back(std::move(rect));
+  void TextRect::rebuildMesh() {
+    struct GlyphQuad {
+      std::shared_ptr<Texture> page;
+      float left;
+      float top;
+      float right;
+      float bottom;
+      Maths::GeoVector4F uvRect;
+    };
+
+    std::vector<GlyphQuad> quads;
+    quads.reserve(_text.length());
+
+    auto penX = 0.0f;
+    char32_t previousCodepoint = 0;
+    for (size_t offset = 0; offset < _text.length();) {
+      auto codepoint = readUtf8Codepoint(_text, offset);
+      auto& ch = _fontSet->getCharacter(codepoint);
+
+      if (previousCodepoint != 0) {
+        penX += static_cast<float>(_fontSet->getKerning(previousCodepoint, codepoint));
       }
-    }
+      previousCodepoint = codepoint;
 
-    if (_bufferInitialised) {
-      reloadText();
+      if (ch.texture != nullptr && ch.sizeX > 0 && ch.sizeY > 0) {
+        auto left = penX + static_cast<float>(ch.bearingX);
+        auto top = -static_cast<float>(ch.bearingY);
+        quads.push_back(GlyphQuad{ch.texture, left, top, left + ch.sizeX, top + ch.sizeY, ch.uvRect});
+      }
+
+      penX += static_cast<float>(ch.advance >> 6);
     }
-  }
-  void TextRect::reloadText() {
 
-    auto ttfOrigin = transform().position;
+    //Glyphs from the same atlas page are drawn together, which for nearly every string means the whole mesh is one draw.
+    std::stable_sort(quads.begin(), quads.end(), [](const GlyphQuad& left, const GlyphQuad& right) {
+      return left.page.get() < right.page.get();
+    });
 
-    size_t i = 0;
-    for (const char& c : getText()) {
+    _vertexData.clear();
+    _indexData.clear();
+    _meshRanges.clear();
 
-      auto ch = _fontSet->getCharacterBasedonGLchar(c);
+    auto minimum = Maths::GeoVector2F(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    auto maximum = Maths::GeoVector2F(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+
+    for (auto& quad : quads) {
+      if (_meshRanges.empty() || _meshRanges.back().texture != quad.page) {
+        _meshRanges.push_back(MeshRange{quad.page, static_cast<GLsizei>(_indexData.size()), 0});
+      }
 
-      auto currentWorldPosition = Maths::GeoVector2F((ttfOrigin.x + ch.sizeX / 2.0f) + ch.bearingX,
-        (ttfOrigin.y - (ch.bearingY / 2.0f))
-        + ((static_cast<float>(ch.sizeY - ch.bearingY) / 2.0f)));
+      auto firstVertex = static_cast<GLuint>(_vertexData.size() / FLOATS_PER_VERTEX);
+      auto uvLeft = quad.uvRect.x;
+      auto uvTop = quad.uvRect.y;
+      auto uvRight = quad.uvRect.x + quad.uvRect.z;
+      auto uvBottom = quad.uvRect.y + quad.uvRect.w;
+
+      _vertexData.insert(_vertexData.end(), {
+        quad.left, quad.top, uvLeft, uvTop,
+        quad.right, quad.top, uvRight, uvTop,
+        quad.right, quad.bottom, uvRight, uvBottom,
+        quad.left, quad.bottom, uvLeft, uvBottom,
+      });
+
+      //Same winding as the GeometryCache unit quad.
+      _indexData.insert(_indexData.end(), {
+        firstVertex, firstVertex + 2, firstVertex + 1,
+        firstVertex, firstVertex + 3, firstVertex + 2,
+      });
+      _meshRanges.back().indexCount += 6;
 
-      auto& target = _letterRects.at(i++);
-      target->texture() = ch.texture;
-      target->transform().position = currentWorldPosition;
-      target->transform().scale = Maths::GeoVector2F(static_cast<float>(ch.sizeX), static_cast<float>(ch.sizeY));
-      target->setActive(true);
-      ttfOrigin.x = ttfOrigin.x + (ch.advance >> 6);
+      minimum = Maths::GeoVector2F(std::min(minimum.x, quad.left), std::min(minimum.y, quad.top));
+      maximum = Maths::GeoVector2F(std::max(maximum.x, quad.right), std::max(maximum.y, quad.bottom));
     }
 
-    if (_letterRects.size() == static_cast<size_t>(i) + 1)
+    if (quads.empty()) {
+      _meshBounds = Maths::GeoBounds(Maths::GeoVector2F::zero(), Maths::GeoVector2F::zero(), 0.0f);
       return;
+    }
 
-    auto beginIt = _letterRects.begin() + static_cast<std::vector<std::unique_ptr<ImageRect>>::iterator::difference_type>(i);
-    auto endIt = _letterRects.end();
+    auto size = maximum - minimum;
+    _meshBounds = Maths::GeoBounds(minimum + (size / 2.0f), size, 0.0f);
 
-    std::for_each(beginIt, endIt, [](const std::unique_ptr<ImageRect>& ptr) {
-      ptr->setActive(false);
-      });
+    auto& glState = _renderer->getGLStateCache();
+    glState.bindVertexArray(_vertexArrayObject.getActual());
+
+    glState.bindBuffer(GL_ARRAY_BUFFER, _vertexBuffer.getActual());
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(GLfloat) * _vertexData.size()), _vertexData.data(), GL_STATIC_DRAW);
+    glEnableVertexAttribArray(VERTEX_POSITION_LOCATION);
+    glVertexAttribPointer(VERTEX_POSITION_LOCATION, 2, GL_FLOAT, GL_FALSE, FLOATS_PER_VERTEX * sizeof(GLfloat), nullptr);
+    glEnableVertexAttribArray(VERTEX_TEXCOORD_LOCATION);
+    glVertexAttribPointer(VERTEX_TEXCOORD_LOCATION, 2, GL_FLOAT, GL_FALSE, FLOATS_PER_VERTEX * sizeof(GLfloat), reinterpret_cast<const GLvoid*>(2 * sizeof(GLfloat)));
+
+    glState.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBuffer.getActual());
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(GLuint) * _indexData.size()), _indexData.data(), GL_STATIC_DRAW);
   }
 
-  void TextRect::setActive(bool value) {
-    WorldObject::setActive(value);
-    std::for_each(_letterRects.begin(), _letterRects.end(), [&value](auto& x) {x->setActive(value); });
+  TextRect::~TextRect() {
+    if (_indexBuffer.isCreated()) {
+      auto buffer = _indexBuffer.getActual();
+      glDeleteBuffers(1, &buffer);
+      _renderer->getGLStateCache().onBufferDeleted(buffer);
+    }
+
+    if (_vertexBuffer.isCreated()) {
+      auto buffer = _vertexBuffer.getActual();
+      glDeleteBuffers(1, &buffer);
+      _renderer->getGLStateCache().onBufferDeleted(buffer);
+    }
+
+    if (!_vertexArrayObject.isCreated()) return;
+
+    auto vao = _vertexArrayObject.getActual();
+    glDeleteVertexArrays(1, &vao);
+    _renderer->getGLStateCache().onVertexArrayDeleted(vao);
   }
 }
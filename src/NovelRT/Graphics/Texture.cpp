@@ -11,119 +11,138 @@ namespace NovelRT::Graphics {
     glGenTextures(1, &tempTexture);
     return tempTexture;
     })),
-    _logger(Utilities::Misc::CONSOLE_LOG_GFX){}
+    _logger(Utilities::Misc::CONSOLE_LOG_GFX),
+    _textureFile(),
+    _size(),
+    _alphaMode(TextureAlphaMode::Translucent),
+    _placeholder(nullptr) {}
 
   void Texture::loadPngAsTexture(const std::string& file) {
     if (_textureId.isCreated()) {
       _logger.logError("This texture has already been initialised with data. Please make a new texture!");
       throw Exceptions::InvalidOperationException("Unable to continue! Cannot overwrite Texture, please make a new texture.");
     }
-    _textureFile = file;
-    //The following libpng setup SHOULD always force it to RGBA, and should always ensure the bit size is the same
-
-    FILE* cFile;
-#if defined(__STDC_LIB_EXT1__) || defined(_MSC_VER)
-    // todo: replace with file not found exc
-    _logger.throwIfNotZero(fopen_s(&cFile, file.c_str(), "rb"), "Image file cannot be opened! Please ensure the path is correct and that the file is not locked.");
-#else
-    cFile = fopen(file.c_str(), "rb");
-#endif
-    auto png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr); //TODO: Figure out how the error function ptr works
-
-    if (png == nullptr) {
-      _logger.logError("Image file cannot be opened! Please ensure the path is correct and that the file is not locked.");
-      throw Exceptions::FileNotFoundException(file, "Unable to continue! File failed to load for texture. Please ensure the path is correct and that the file is not locked.");
-    }
-
-    auto info = png_create_info_struct(png);
 
-    if (info == nullptr) {
-      _logger.logError("Image at path {} failed to provide an info struct! Aborting...", file);
-      throw Exceptions::IOException(file, "Unable to continue! File failed to provide an info struct.");
-    }
+    auto image = PngCodec::decodeFile(file);
+    loadRgbaImageAsTexture(image);
+    _textureFile = file;
+  }
 
-    if (setjmp(png_jmpbuf(png))) { //This is how libpng does error handling.
-      _logger.logError("Image at path {} appears to be corrupted! Aborting...", file);
-      throw Exceptions::IOException(file, "Unable to continue! File appears to be corrupted.");
+  void Texture::loadQoiAsTexture(const std::string& file) {
+    if (_textureId.isCreated()) {
+      _logger.logError("This texture has already been initialised with data. Please make a new texture!");
+      throw Exceptions::InvalidOperationException("Unable to continue! Cannot overwrite Texture, please make a new texture.");
     }
 
-    png_init_io(png, cFile);
-    png_read_info(png, info);
-
-    ImageData data;
-    data.width = png_get_image_width(png, info);
-    data.height = png_get_image_height(png, info);
-    data.colourType = png_get_color_type(png, info);
-    data.bitDepth = png_get_bit_depth(png, info);
-
-    if (data.bitDepth == 16) png_set_strip_16(png);
-
-    if (data.colourType == PNG_COLOR_TYPE_PALETTE) png_set_palette_to_rgb(png);
-
-    if (data.colourType == PNG_COLOR_TYPE_GRAY && data.bitDepth < 8) png_set_expand_gray_1_2_4_to_8(png);
-
-    if (png_get_valid(png, info, PNG_INFO_tRNS)) png_set_tRNS_to_alpha(png);
+    auto image = QoiCodec::decodeFile(file);
+    loadRgbaImageAsTexture(image);
+    _textureFile = file;
+  }
 
-    if (data.colourType == PNG_COLOR_TYPE_RGB ||
-      data.colourType == PNG_COLOR_TYPE_GRAY ||
-      data.colourType == PNG_COLOR_TYPE_PALETTE) { //id one line this but it looks ugly
-      png_set_filler(png, 0xFF, PNG_FILLER_AFTER);
+  void Texture::loadContainerAsTexture(const std::string& file) {
+    if (_textureId.isCreated()) {
+      _logger.logError("This texture has already been initialised with data. Please make a new texture!");
+      throw Exceptions::InvalidOperationException("Unable to continue! Cannot overwrite Texture, please make a new texture.");
     }
 
-    if (data.colourType == PNG_COLOR_TYPE_GRAY || data.colourType == PNG_COLOR_TYPE_GRAY_ALPHA) png_set_gray_to_rgb(png);
-
-    png_read_update_info(png, info);
-
-
-    auto rowBytes = png_get_rowbytes(png, info);
-    auto bpp = static_cast<uint32_t>(rowBytes) / data.width;
+    TextureContainer container(file);
+    auto& levels = container.getLevels();
+    auto levelCount = static_cast<GLsizei>(levels.size());
 
-    //Allows us to get the final image data, not interlaced.
-    png_set_interlace_handling(png);
-
-    //Props to Kenny for debugging this without asking me and saving me the mental strain lmao
-    auto pixelBufferAmount = (data.width * data.height * bpp);
-    auto rawImage = new unsigned char[pixelBufferAmount]; //We allocate the pixel buffer here.
-    if (rawImage == nullptr) {
-      png_destroy_read_struct(&png, &info, nullptr);
-      fclose(cFile);
-      throw Exceptions::OutOfMemoryException(std::string("Couldn't allocate space for PNG, file: \"").append(file).append("\"."));
+    GLenum internalFormat = GL_RGBA8;
+    if (container.getFormat() == TextureContainerFormat::Etc2Rgb8) {
+      internalFormat = GL_COMPRESSED_RGB8_ETC2;
+    }
+    else if (container.getFormat() == TextureContainerFormat::Etc2Rgba8) {
+      internalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC;
     }
 
-    data.rowPointers = new png_bytep[data.height];  //Setup row pointer array and set it into the pixel buffer.
-    unsigned char* p = rawImage;
+    _renderer->getGLStateCache().bindTexture2D(_textureId.getActual());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, levelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levelCount - 1);
+    glTexStorage2D(GL_TEXTURE_2D, levelCount, internalFormat, static_cast<GLsizei>(container.getWidth()), static_cast<GLsizei>(container.getHeight()));
+
+    for (GLint level = 0; level < levelCount; level++) {
+      auto& levelData = levels[static_cast<size_t>(level)];
+      auto width = static_cast<GLsizei>(levelData.width);
+      auto height = static_cast<GLsizei>(levelData.height);
+
+      if (internalFormat == GL_RGBA8) {
+        glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, levelData.data);
+      }
+      else {
+        glCompressedTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, internalFormat, static_cast<GLsizei>(levelData.size), levelData.data);
+      }
+    }
 
-    //TODO: Proper error check on data.rowPointers
-    if (data.rowPointers == nullptr) {
-      _logger.logError("Unable to continue! Couldn't allocate memory for the PNG pixel data! Aborting...");
-      throw Exceptions::OutOfMemoryException(std::string("Could not allocate memory for pixel data from \"").append(file).append("\"."));
+    //Compressed blocks would have to be decoded to scan them, and the converter only keeps alpha for images that need it.
+    if (container.getFormat() == TextureContainerFormat::Etc2Rgb8) {
+      _alphaMode = TextureAlphaMode::Opaque;
+    }
+    else if (container.getFormat() == TextureContainerFormat::Rgba8) {
+      _alphaMode = PixelConverter::classifyAlpha(levels.front().data, static_cast<size_t>(levels.front().width) * levels.front().height);
     }
 
-    for (uint32_t i = 0; i < data.height; i++) {
-      data.rowPointers[i] = p;
-      p += data.width * bpp;
+    _size = Maths::GeoVector2F(static_cast<float>(container.getWidth()), static_cast<float>(container.getHeight()));
+    _placeholder = nullptr;
+    _textureFile = file;
+  }
+
+  void Texture::loadRgbaImageAsTexture(const RgbaImage& image) {
+    if (_textureId.isCreated()) {
+      _logger.logError("This texture has already been initialised with data. Please make a new texture!");
+      throw Exceptions::InvalidOperationException("Unable to continue! Cannot overwrite Texture, please make a new texture.");
     }
 
-    //Read all the rows (data will flow into the pixel buffer)
-    png_read_image(png, data.rowPointers);
-    png_read_end(png, info);  //Finish reading the file - this will also check for corruption
+    allocateAndUpload(image.width, image.height, image.pixels.data());
+    _alphaMode = PixelConverter::classifyAlpha(image.pixels.data(), static_cast<size_t>(image.width) * image.height);
+  }
 
-    glBindTexture(GL_TEXTURE_2D, _textureId.getActual());
+  void Texture::allocateAndUpload(uint32_t width, uint32_t height, const GLvoid* pixels) {
+    //Immutable storage lets the driver lay out every mip level once, up front, instead of guessing as each level arrives.
+    auto levels = 1;
+    for (auto largestSide = std::max(width, height); largestSide > 1; largestSide >>= 1) {
+      levels++;
+    }
 
-    int mode = GL_RGBA;
+    _renderer->getGLStateCache().bindTexture2D(_textureId.getActual());
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexImage2D(GL_TEXTURE_2D, 0, mode, data.width, data.height, 0, mode, GL_UNSIGNED_BYTE, reinterpret_cast<GLvoid*>(rawImage));
+    glTexStorage2D(GL_TEXTURE_2D, levels, GL_RGBA8, static_cast<GLsizei>(width), static_cast<GLsizei>(height));
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height), GL_RGBA, GL_UNSIGNED_BYTE, pixels);
     glGenerateMipmap(GL_TEXTURE_2D);
 
-    _size = Maths::GeoVector2F(static_cast<float>(data.width), static_cast<float>(data.height));
+    _size = Maths::GeoVector2F(static_cast<float>(width), static_cast<float>(height));
+    _placeholder = nullptr;
+  }
+
+  void Texture::allocateRenderTarget(uint32_t width, uint32_t height) {
+    //Render targets are drawn back at exactly their own size and never tiled, so they need neither mipmaps nor wrapping.
+    _renderer->getGLStateCache().bindTexture2D(_textureId.getActual());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, static_cast<GLsizei>(width), static_cast<GLsizei>(height));
+
+    _size = Maths::GeoVector2F(static_cast<float>(width), static_cast<float>(height));
+    _placeholder = nullptr;
+  }
+
+  TextureRegion Texture::getRegion(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    TextureRegion region;
+    region.texture = shared_from_this();
+
+    if (_size.x > 0.0f && _size.y > 0.0f) {
+      region.uvRect = Maths::GeoVector4F(x / _size.x, y / _size.y, width / _size.x, height / _size.y);
+    }
 
-    fclose(cFile);
-    delete[] rawImage;
-    delete[] data.rowPointers;
-    png_destroy_read_struct(&png, &info, nullptr);
+    return region;
   }
 
   Texture::~Texture() {
@@ -134,5 +153,6 @@ namespace NovelRT::Graphics {
 
     auto textureId = _textureId.getActual();
     glDeleteTextures(1, &textureId);
+    _renderer->getGLStateCache().onTextureDeleted(textureId);
   }
 }
@@ -0,0 +1,201 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  static const uint32_t CONTAINER_FILE_MAGIC = 0x5854524E; // "NRTX"
+  static const uint32_t CONTAINER_FILE_VERSION = 1;
+  static const uint32_t MAXIMUM_LEVEL_COUNT = 32;
+  static const size_t LEVEL_ALIGNMENT = 16;
+
+  struct ContainerFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t format;
+    uint32_t width;
+    uint32_t height;
+    uint32_t levelCount;
+  };
+
+  struct ContainerLevelEntry {
+    uint32_t width;
+    uint32_t height;
+    uint64_t offset;
+    uint64_t size;
+  };
+
+  static size_t getLevelSize(TextureContainerFormat format, uint32_t width, uint32_t height) noexcept {
+    switch (format) {
+      case TextureContainerFormat::Etc2Rgb8:
+        return Etc2Encoder::getEncodedSize(width, height, false);
+      case TextureContainerFormat::Etc2Rgba8:
+        return Etc2Encoder::getEncodedSize(width, height, true);
+      case TextureContainerFormat::Rgba8:
+      default:
+        return static_cast<size_t>(width) * height * RgbaImage::BytesPerPixel;
+    }
+  }
+
+  static size_t alignLevelOffset(size_t offset) noexcept {
+    return (offset + LEVEL_ALIGNMENT - 1) & ~(LEVEL_ALIGNMENT - 1);
+  }
+
+  TextureContainer::TextureContainer(const std::string& file) :
+    _mappedFile(file),
+    _format(TextureContainerFormat::Rgba8),
+    _width(0),
+    _height(0),
+    _levels() {
+    LoggingService logger(Utilities::Misc::CONSOLE_LOG_GFX);
+    auto data = _mappedFile.getData();
+    auto size = _mappedFile.getSize();
+
+    //The mapping is only byte aligned as far as we know, so every structure is copied out rather than read in place.
+    ContainerFileHeader header;
+    if (size < sizeof(header)) {
+      logger.logError("Texture container {} is too small to be valid.", file);
+      throw Exceptions::IOException(file, "Unable to continue! The texture container is truncated.");
+    }
+
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != CONTAINER_FILE_MAGIC || header.version != CONTAINER_FILE_VERSION) {
+      logger.logError("{} is not a texture container this version of NovelRT can read.", file);
+      throw Exceptions::IOException(file, "Unable to continue! The file is not a supported texture container.");
+    }
+
+    if (header.format > static_cast<uint32_t>(TextureContainerFormat::Etc2Rgba8) || header.width == 0 || header.height == 0 ||
+      header.levelCount == 0 || header.levelCount > MAXIMUM_LEVEL_COUNT) {
+      logger.logError("Texture container {} has an invalid header.", file);
+      throw Exceptions::IOException(file, "Unable to continue! The texture container is corrupted.");
+    }
+
+    if (size < sizeof(header) + sizeof(ContainerLevelEntry) * header.levelCount) {
+      logger.logError("Texture container {} is too small to hold its level table.", file);
+      throw Exceptions::IOException(file, "Unable to continue! The texture container is truncated.");
+    }
+
+    _format = static_cast<TextureContainerFormat>(header.format);
+    _width = header.width;
+    _height = header.height;
+
+    for (uint32_t i = 0; i < header.levelCount; i++) {
+      ContainerLevelEntry entry;
+      std::memcpy(&entry, data + sizeof(header) + sizeof(entry) * i, sizeof(entry));
+
+      auto expectedWidth = std::max(_width >> i, 1u);
+      auto expectedHeight = std::max(_height >> i, 1u);
+      if (entry.width != expectedWidth || entry.height != expectedHeight || entry.size != getLevelSize(_format, entry.width, entry.height)) {
+        logger.logError("Mip level {} of texture container {} has the wrong size.", i, file);
+        throw Exceptions::IOException(file, "Unable to continue! The texture container is corrupted.");
+      }
+
+      if (entry.offset > size || entry.size > size - entry.offset) {
+        logger.logError("Mip level {} of texture container {} runs past the end of the file.", i, file);
+        throw Exceptions::IOException(file, "Unable to continue! The texture container is truncated.");
+      }
+
+      _levels.push_back(TextureContainerLevel{entry.width, entry.height, data + entry.offset, static_cast<size_t>(entry.size)});
+    }
+  }
+
+  bool TextureContainer::isContainerFile(const std::string& file) {
+    return std::filesystem::path(file).extension() == ".nrtex";
+  }
+
+  std::vector<RgbaImage> TextureContainer::generateMipChain(const RgbaImage& image) {
+    std::vector<RgbaImage> levels;
+    levels.push_back(image);
+
+    while (levels.back().width > 1 || levels.back().height > 1) {
+      const auto& source = levels.back();
+      RgbaImage level(std::max(source.width / 2, 1u), std::max(source.height / 2, 1u));
+
+      for (uint32_t y = 0; y < level.height; y++) {
+        for (uint32_t x = 0; x < level.width; x++) {
+          uint32_t weightedColour[3] = {0, 0, 0};
+          uint32_t colour[3] = {0, 0, 0};
+          uint32_t alpha = 0;
+
+          for (uint32_t offsetY = 0; offsetY < 2; offsetY++) {
+            for (uint32_t offsetX = 0; offsetX < 2; offsetX++) {
+              auto pixel = source.getPixel(std::min(x * 2 + offsetX, source.width - 1), std::min(y * 2 + offsetY, source.height - 1));
+              for (uint32_t channel = 0; channel < 3; channel++) {
+                weightedColour[channel] += static_cast<uint32_t>(pixel[channel]) * pixel[3];
+                colour[channel] += pixel[channel];
+              }
+
+              alpha += pixel[3];
+            }
+          }
+
+          auto target = level.getPixel(x, y);
+          for (uint32_t channel = 0; channel < 3; channel++) {
+            //Fully transparent areas keep their plain average, so that filtering into them later still finds a sensible colour.
+            target[channel] = static_cast<uint8_t>(alpha == 0 ? (colour[channel] + 2) / 4 : (weightedColour[channel] + alpha / 2) / alpha);
+          }
+
+          target[3] = static_cast<uint8_t>((alpha + 2) / 4);
+        }
+      }
+
+      levels.push_back(std::move(level));
+    }
+
+    return levels;
+  }
+
+  std::vector<uint8_t> TextureContainer::encode(const RgbaImage& image, TextureContainerFormat format, bool shouldGenerateMipmaps) {
+    if (image.width == 0 || image.height == 0) {
+      LoggingService logger(Utilities::Misc::CONSOLE_LOG_GFX);
+      logger.logError("An empty image cannot be stored in a texture container.");
+      throw Exceptions::InvalidOperationException("An empty image cannot be stored in a texture container.");
+    }
+
+    auto images = shouldGenerateMipmaps ? generateMipChain(image) : std::vector<RgbaImage>{image};
+
+    ContainerFileHeader header{CONTAINER_FILE_MAGIC, CONTAINER_FILE_VERSION, static_cast<uint32_t>(format), image.width, image.height,
+      static_cast<uint32_t>(images.size())};
+    std::vector<ContainerLevelEntry> entries;
+    std::vector<std::vector<uint8_t>> payloads;
+    auto offset = alignLevelOffset(sizeof(header) + sizeof(ContainerLevelEntry) * images.size());
+
+    for (auto& level : images) {
+      switch (format) {
+        case TextureContainerFormat::Etc2Rgb8:
+          payloads.push_back(Etc2Encoder::encodeRgb8(level));
+          break;
+        case TextureContainerFormat::Etc2Rgba8:
+          payloads.push_back(Etc2Encoder::encodeRgba8(level));
+          break;
+        case TextureContainerFormat::Rgba8:
+        default:
+          payloads.push_back(std::move(level.pixels));
+          break;
+      }
+
+      entries.push_back(ContainerLevelEntry{level.width, level.height, offset, payloads.back().size()});
+      offset = alignLevelOffset(offset + payloads.back().size());
+    }
+
+    std::vector<uint8_t> result(static_cast<size_t>(entries.back().offset + entries.back().size), 0);
+    std::memcpy(result.data(), &header, sizeof(header));
+    std::memcpy(result.data() + sizeof(header), entries.data(), sizeof(ContainerLevelEntry) * entries.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+      std::copy(payloads[i].begin(), payloads[i].end(), result.begin() + static_cast<ptrdiff_t>(entries[i].offset));
+    }
+
+    return result;
+  }
+
+  void TextureContainer::encodeFile(const std::string& file, const RgbaImage& image, TextureContainerFormat format, bool shouldGenerateMipmaps) {
+    auto bytes = encode(image, format, shouldGenerateMipmaps);
+
+    std::ofstream stream(file, std::ios::out | std::ios::binary | std::ios::trunc);
+    stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!stream) {
+      LoggingService logger(Utilities::Misc::CONSOLE_LOG_GFX);
+      logger.logError("Texture container {} could not be written.", file);
+      throw Exceptions::IOException(file, "Unable to continue! The texture container could not be written.");
+    }
+  }
+}
@@ -0,0 +1,113 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+namespace NovelRT::Graphics {
+  static size_t getDefaultWorkerCount() noexcept {
+    //Leave a core for the render thread, and do not bother going wide. Decoding is rarely the bottleneck past a few threads.
+    auto hardwareThreads = static_cast<size_t>(std::thread::hardware_concurrency());
+    return std::clamp<size_t>(hardwareThreads > 1 ? hardwareThreads - 1 : 1, 1, 4);
+  }
+
+  static Timing::Timestamp toTimestamp(std::chrono::steady_clock::duration duration) noexcept {
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration);
+    return Timing::Timestamp(static_cast<uint64_t>(nanoseconds.count()) / (1'000'000'000 / Timing::TicksPerSecond));
+  }
+
+  TextureLoader::TextureLoader(std::shared_ptr<GLStateCache> glState) noexcept :
+    _glState(glState),
+    _decoder(getDefaultWorkerCount()),
+    _pendingUploads(),
+    _nextRequestId(0),
+    _pixelUnpackBuffer(Utilities::Lazy<GLuint>([] {
+      GLuint tempBuffer;
+      glGenBuffers(1, &tempBuffer);
+      return tempBuffer;
+    })),
+    _uploadTimeBudget(Timing::Timestamp::fromSeconds(0.004)),
+    _uploadByteBudget(DefaultUploadByteBudget),
+    _lastFrameUploadTime(Timing::Timestamp::zero()),
+    _lastFrameUploadedBytes(0),
+    _lastLoadLatency(Timing::Timestamp::zero()),
+    _logger(Utilities::Misc::CONSOLE_LOG_GFX) {}
+
+  void TextureLoader::request(const std::shared_ptr<Texture>& texture, const std::string& file) {
+    auto requestId = _nextRequestId++;
+    _pendingUploads.emplace(requestId, PendingUpload{texture, std::chrono::steady_clock::now()});
+    _decoder.request(requestId, file);
+  }
+
+  void TextureLoader::processUploads() {
+    auto frameStart = std::chrono::steady_clock::now();
+    size_t uploadedBytes = 0;
+    ImageDecodeWorkerPool::Result result;
+
+    while (!_pendingUploads.empty()) {
+      if (uploadedBytes > 0) {
+        if (uploadedBytes >= _uploadByteBudget) break;
+        if (toTimestamp(std::chrono::steady_clock::now() - frameStart) >= _uploadTimeBudget) break;
+      }
+
+      auto remainingBytes = uploadedBytes == 0 ? std::numeric_limits<size_t>::max() : _uploadByteBudget - uploadedBytes;
+      if (!_decoder.tryTakeResult(result, remainingBytes)) break;
+
+      auto match = _pendingUploads.find(result.requestId);
+      if (match == _pendingUploads.end()) continue;
+
+      auto texture = match->second.texture.lock();
+      auto requestTime = match->second.requestTime;
+      _pendingUploads.erase(match);
+
+      if (!result.isSuccessful) {
+        _logger.logError("Texture {} failed to load in the background. It will keep drawing its placeholder.", result.file);
+        continue;
+      }
+
+      //Nobody is waiting for a texture that was dropped while it decoded, so just give its memory back.
+      if (texture != nullptr) {
+        upload(*texture, result.image, result.alphaMode);
+        uploadedBytes += result.image.pixels.size();
+        _lastLoadLatency = toTimestamp(std::chrono::steady_clock::now() - requestTime);
+      }
+
+      _decoder.recycle(std::move(result.image));
+    }
+
+    _lastFrameUploadTime = toTimestamp(std::chrono::steady_clock::now() - frameStart);
+    _lastFrameUploadedBytes = uploadedBytes;
+  }
+
+  void TextureLoader::upload(Texture& texture, const RgbaImage& image, TextureAlphaMode alphaMode) {
+    if (texture._textureId.isCreated()) {
+      _logger.logError("Texture {} was given data while it was loading in the background. The background load has been dropped.", texture.getTextureFile());
+      return;
+    }
+
+    texture._alphaMode = alphaMode;
+    auto byteCount = static_cast<GLsizeiptr>(image.pixels.size());
+
+    //Orphaning the buffer before mapping it means we never wait on the driver to finish with the previous upload.
+    _glState->bindBuffer(GL_PIXEL_UNPACK_BUFFER, _pixelUnpackBuffer.getActual());
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, byteCount, nullptr, GL_STREAM_DRAW);
+    auto mappedBuffer = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, byteCount, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+
+    if (mappedBuffer != nullptr) {
+      std::memcpy(mappedBuffer, image.pixels.data(), image.pixels.size());
+      glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+      texture.allocateAndUpload(image.width, image.height, nullptr);
+      _glState->bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+      return;
+    }
+
+    _glState->bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    texture.allocateAndUpload(image.width, image.height, image.pixels.data());
+  }
+
+  TextureLoader::~TextureLoader() {
+    if (!_pixelUnpackBuffer.isCreated()) return;
+
+    auto buffer = _pixelUnpackBuffer.getActual();
+    glDeleteBuffers(1, &buffer);
+    _glState->onBufferDeleted(buffer);
+  }
+}
@@ -0,0 +1,323 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define NOVELRT_TRANSFORMSTORE_AVX2
+#define NOVELRT_TRANSFORMSTORE_SSE2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define NOVELRT_TRANSFORMSTORE_SSE2
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace NovelRT::Graphics {
+  //sin and cos are evaluated on [-45, 45] degrees once whole quarter turns are removed, using the minimax polynomials from Cephes.
+  //Every path evaluates them in the same order, so the SIMD kernels give the same matrices as the scalar one.
+  static const float DegreesToRadians = 0.01745329251994329577f;
+  static const float QuarterTurnsPerDegree = 1.0f / 90.0f;
+  static const float SineCoefficient0 = -1.9515295891e-4f;
+  static const float SineCoefficient1 = 8.3321608736e-3f;
+  static const float SineCoefficient2 = -1.6666654611e-1f;
+  static const float CosineCoefficient0 = 2.443315711809948e-5f;
+  static const float CosineCoefficient1 = -1.388731625493765e-3f;
+  static const float CosineCoefficient2 = 4.166664568298827e-2f;
+
+  static inline uint32_t countTrailingZeros(uint64_t value) noexcept {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+  }
+
+  static void computeModelMatrix(float positionX, float positionY, float rotation, float scaleX, float scaleY, float layer, float* matrix) noexcept {
+    auto quarterTurns = static_cast<int32_t>(std::nearbyint(rotation * QuarterTurnsPerDegree));
+    auto x = (rotation - static_cast<float>(quarterTurns) * 90.0f) * DegreesToRadians;
+    auto x2 = x * x;
+    auto sine = ((SineCoefficient0 * x2 + SineCoefficient1) * x2 + SineCoefficient2) * x2 * x + x;
+    auto cosine = ((CosineCoefficient0 * x2 + CosineCoefficient1) * x2 + CosineCoefficient2) * x2 * x2 - 0.5f * x2 + 1.0f;
+
+    if (quarterTurns & 1) std::swap(sine, cosine);
+    if (quarterTurns & 2) sine = -sine;
+    if ((quarterTurns + 1) & 2) cosine = -cosine;
+
+    matrix[0] = cosine * scaleX;
+    matrix[1] = sine * scaleX;
+    matrix[2] = 0.0f;
+    matrix[3] = 0.0f;
+    matrix[4] = -sine * scaleY;
+    matrix[5] = cosine * scaleY;
+    matrix[6] = 0.0f;
+    matrix[7] = 0.0f;
+    matrix[8] = 0.0f;
+    matrix[9] = 0.0f;
+    matrix[10] = 1.0f;
+    matrix[11] = 0.0f;
+    matrix[12] = positionX;
+    matrix[13] = positionY;
+    matrix[14] = layer;
+    matrix[15] = 1.0f;
+  }
+
+#if defined(NOVELRT_TRANSFORMSTORE_SSE2)
+  static inline void computeSineCosine(__m128 rotation, __m128& sine, __m128& cosine) noexcept {
+    auto quarterTurns = _mm_cvtps_epi32(_mm_mul_ps(rotation, _mm_set1_ps(QuarterTurnsPerDegree)));
+    auto x = _mm_mul_ps(_mm_sub_ps(rotation, _mm_mul_ps(_mm_cvtepi32_ps(quarterTurns), _mm_set1_ps(90.0f))), _mm_set1_ps(DegreesToRadians));
+    auto x2 = _mm_mul_ps(x, x);
+
+    auto s = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(SineCoefficient0), x2), _mm_set1_ps(SineCoefficient1));
+    s = _mm_add_ps(_mm_mul_ps(s, x2), _mm_set1_ps(SineCoefficient2));
+    s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, x2), x), x);
+
+    auto c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(CosineCoefficient0), x2), _mm_set1_ps(CosineCoefficient1));
+    c = _mm_add_ps(_mm_mul_ps(c, x2), _mm_set1_ps(CosineCoefficient2));
+    c = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(c, x2), x2), _mm_mul_ps(_mm_set1_ps(0.5f), x2)), _mm_set1_ps(1.0f));
+
+    auto one = _mm_set1_epi32(1);
+    auto two = _mm_set1_epi32(2);
+    auto swapMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quarterTurns, one), one));
+    auto sineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quarterTurns, two), 30));
+    auto cosineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quarterTurns, one), two), 30));
+
+    sine = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swapMask, c), _mm_andnot_ps(swapMask, s)), sineSign);
+    cosine = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swapMask, s), _mm_andnot_ps(swapMask, c)), cosineSign);
+  }
+
+  //Transposes four objects' worth of matrix terms from lanes into four column major matrices.
+  static inline void storeModelMatrices(__m128 a, __m128 b, __m128 c, __m128 d, __m128 positionX, __m128 positionY, __m128 layer,
+    float* const* matrices) noexcept {
+    auto zero = _mm_setzero_ps();
+    auto column2 = _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f);
+    auto abLow = _mm_unpacklo_ps(a, b);
+    auto abHigh = _mm_unpackhi_ps(a, b);
+    auto cdLow = _mm_unpacklo_ps(c, d);
+    auto cdHigh = _mm_unpackhi_ps(c, d);
+    auto xyLow = _mm_unpacklo_ps(positionX, positionY);
+    auto xyHigh = _mm_unpackhi_ps(positionX, positionY);
+    auto zwLow = _mm_unpacklo_ps(layer, _mm_set1_ps(1.0f));
+    auto zwHigh = _mm_unpackhi_ps(layer, _mm_set1_ps(1.0f));
+
+    const __m128 column0[4] = { _mm_movelh_ps(abLow, zero), _mm_movehl_ps(zero, abLow), _mm_movelh_ps(abHigh, zero), _mm_movehl_ps(zero, abHigh) };
+    const __m128 column1[4] = { _mm_movelh_ps(cdLow, zero), _mm_movehl_ps(zero, cdLow), _mm_movelh_ps(cdHigh, zero), _mm_movehl_ps(zero, cdHigh) };
+    const __m128 column3[4] = { _mm_movelh_ps(xyLow, zwLow), _mm_movehl_ps(zwLow, xyLow), _mm_movelh_ps(xyHigh, zwHigh), _mm_movehl_ps(zwHigh, xyHigh) };
+
+    for (size_t i = 0; i < 4; i++) {
+      _mm_storeu_ps(matrices[i], column0[i]);
+      _mm_storeu_ps(matrices[i] + 4, column1[i]);
+      _mm_storeu_ps(matrices[i] + 8, column2);
+      _mm_storeu_ps(matrices[i] + 12, column3[i]);
+    }
+  }
+#endif
+
+#if defined(NOVELRT_TRANSFORMSTORE_AVX2)
+  static inline void computeSineCosine(__m256 rotation, __m256& sine, __m256& cosine) noexcept {
+    auto quarterTurns = _mm256_cvtps_epi32(_mm256_mul_ps(rotation, _mm256_set1_ps(QuarterTurnsPerDegree)));
+    auto x = _mm256_mul_ps(_mm256_sub_ps(rotation, _mm256_mul_ps(_mm256_cvtepi32_ps(quarterTurns), _mm256_set1_ps(90.0f))), _mm256_set1_ps(DegreesToRadians));
+    auto x2 = _mm256_mul_ps(x, x);
+
+    auto s = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(SineCoefficient0), x2), _mm256_set1_ps(SineCoefficient1));
+    s = _mm256_add_ps(_mm256_mul_ps(s, x2), _mm256_set1_ps(SineCoefficient2));
+    s = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(s, x2), x), x);
+
+    auto c = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(CosineCoefficient0), x2), _mm256_set1_ps(CosineCoefficient1));
+    c = _mm256_add_ps(_mm256_mul_ps(c, x2), _mm256_set1_ps(CosineCoefficient2));
+    c = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(c, x2), x2), _mm256_mul_ps(_mm256_set1_ps(0.5f), x2)), _mm256_set1_ps(1.0f));
+
+    auto one = _mm256_set1_epi32(1);
+    auto two = _mm256_set1_epi32(2);
+    auto swapMask = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quarterTurns, one), one));
+    auto sineSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quarterTurns, two), 30));
+    auto cosineSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quarterTurns, one), two), 30));
+
+    sine = _mm256_xor_ps(_mm256_blendv_ps(s, c, swapMask), sineSign);
+    cosine = _mm256_xor_ps(_mm256_blendv_ps(c, s, swapMask), cosineSign);
+  }
+#endif
+
+  TransformStore::TransformStore() noexcept :
+    _positionX(),
+    _positionY(),
+    _rotation(),
+    _scaleX(),
+    _scaleY(),
+    _layer(),
+    _modelMatrices(),
+    _dirtyBits(),
+    _dirtyHandles(),
+    _freeHandles(),
+    _lastUpdateCount(0) {
+  }
+
+  uint32_t TransformStore::allocate() {
+    uint32_t handle;
+    if (!_freeHandles.empty()) {
+      handle = _freeHandles.back();
+      _freeHandles.pop_back();
+    }
+    else {
+      handle = static_cast<uint32_t>(_modelMatrices.size());
+      _positionX.emplace_back();
+      _positionY.emplace_back();
+      _rotation.emplace_back();
+      _scaleX.emplace_back();
+      _scaleY.emplace_back();
+      _layer.emplace_back();
+      _modelMatrices.emplace_back();
+      if (handle % 64 == 0) {
+        _dirtyBits.push_back(0);
+      }
+    }
+
+    _positionX[handle] = 0.0f;
+    _positionY[handle] = 0.0f;
+    _rotation[handle] = 0.0f;
+    _scaleX[handle] = 1.0f;
+    _scaleY[handle] = 1.0f;
+    _layer[handle] = 0.0f;
+    _modelMatrices[handle] = Maths::GeoMatrix4x4F::getDefaultIdentity();
+    setDirty(handle, false);
+
+    return handle;
+  }
+
+  void TransformStore::release(uint32_t handle) noexcept {
+    if (handle == InvalidHandle) return;
+
+    setDirty(handle, false);
+    _freeHandles.push_back(handle);
+  }
+
+  void TransformStore::set(uint32_t handle, Maths::GeoVector2F position, float rotation, Maths::GeoVector2F scale, float layer) noexcept {
+    _positionX[handle] = position.x;
+    _positionY[handle] = position.y;
+    _rotation[handle] = rotation;
+    _scaleX[handle] = scale.x;
+    _scaleY[handle] = scale.y;
+    _layer[handle] = layer;
+    setDirty(handle, true);
+  }
+
+  const Maths::GeoMatrix4x4F& TransformStore::getModelMatrix(uint32_t handle) noexcept {
+    if (isDirty(handle)) {
+      computeModelMatrices(&handle, 1);
+      setDirty(handle, false);
+    }
+
+    return _modelMatrices[handle];
+  }
+
+  size_t TransformStore::update(RenderWorkerPool* workerPool) {
+    _dirtyHandles.clear();
+    for (size_t word = 0; word < _dirtyBits.size(); word++) {
+      auto bits = _dirtyBits[word];
+      while (bits != 0) {
+        _dirtyHandles.push_back(static_cast<uint32_t>(word * 64 + countTrailingZeros(bits)));
+        bits &= bits - 1;
+      }
+
+      _dirtyBits[word] = 0;
+    }
+
+    auto count = _dirtyHandles.size();
+    auto taskCount = workerPool == nullptr ? 1 : std::clamp<size_t>(count / MinimumHandlesPerTask, 1, workerPool->getWorkerCount() + 1);
+    if (taskCount == 1) {
+      computeModelMatrices(_dirtyHandles.data(), count);
+    }
+    else {
+      //Every handle is distinct, so each task writes to matrices that no other task touches.
+      workerPool->run(taskCount, [&](size_t task) {
+        auto first = count * task / taskCount;
+        auto last = count * (task + 1) / taskCount;
+        computeModelMatrices(_dirtyHandles.data() + first, last - first);
+      });
+    }
+
+    _lastUpdateCount = _dirtyHandles.size();
+    return _lastUpdateCount;
+  }
+
+  void TransformStore::computeModelMatrices(const uint32_t* handles, size_t count) noexcept {
+    auto matrices = reinterpret_cast<float*>(_modelMatrices.data());
+    size_t i = 0;
+
+#if defined(NOVELRT_TRANSFORMSTORE_AVX2)
+    for (; i + 8 <= count; i += 8) {
+      auto indices = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(handles + i));
+      auto positionX = _mm256_i32gather_ps(_positionX.data(), indices, 4);
+      auto positionY = _mm256_i32gather_ps(_positionY.data(), indices, 4);
+      auto rotation = _mm256_i32gather_ps(_rotation.data(), indices, 4);
+      auto scaleX = _mm256_i32gather_ps(_scaleX.data(), indices, 4);
+      auto scaleY = _mm256_i32gather_ps(_scaleY.data(), indices, 4);
+      auto layer = _mm256_i32gather_ps(_layer.data(), indices, 4);
+
+      __m256 sine;
+      __m256 cosine;
+      computeSineCosine(rotation, sine, cosine);
+
+      auto a = _mm256_mul_ps(cosine, scaleX);
+      auto b = _mm256_mul_ps(sine, scaleX);
+      auto c = _mm256_mul_ps(_mm256_xor_ps(sine, _mm256_set1_ps(-0.0f)), scaleY);
+      auto d = _mm256_mul_ps(cosine, scaleY);
+
+      float* targets[8];
+      for (size_t lane = 0; lane < 8; lane++) {
+        targets[lane] = matrices + static_cast<size_t>(handles[i + lane]) * 16;
+      }
+
+      storeModelMatrices(_mm256_castps256_ps128(a), _mm256_castps256_ps128(b), _mm256_castps256_ps128(c), _mm256_castps256_ps128(d),
+        _mm256_castps256_ps128(positionX), _mm256_castps256_ps128(positionY), _mm256_castps256_ps128(layer), targets);
+      storeModelMatrices(_mm256_extractf128_ps(a, 1), _mm256_extractf128_ps(b, 1), _mm256_extractf128_ps(c, 1), _mm256_extractf128_ps(d, 1),
+        _mm256_extractf128_ps(positionX, 1), _mm256_extractf128_ps(positionY, 1), _mm256_extractf128_ps(layer, 1), targets + 4);
+    }
+#endif
+
+#if defined(NOVELRT_TRANSFORMSTORE_SSE2)
+    for (; i + 4 <= count; i += 4) {
+      auto h0 = handles[i];
+      auto h1 = handles[i + 1];
+      auto h2 = handles[i + 2];
+      auto h3 = handles[i + 3];
+      auto positionX = _mm_setr_ps(_positionX[h0], _positionX[h1], _positionX[h2], _positionX[h3]);
+      auto positionY = _mm_setr_ps(_positionY[h0], _positionY[h1], _positionY[h2], _positionY[h3]);
+      auto rotation = _mm_setr_ps(_rotation[h0], _rotation[h1], _rotation[h2], _rotation[h3]);
+      auto scaleX = _mm_setr_ps(_scaleX[h0], _scaleX[h1], _scaleX[h2], _scaleX[h3]);
+      auto scaleY = _mm_setr_ps(_scaleY[h0], _scaleY[h1], _scaleY[h2], _scaleY[h3]);
+      auto layer = _mm_setr_ps(_layer[h0], _layer[h1], _layer[h2], _layer[h3]);
+
+      __m128 sine;
+      __m128 cosine;
+      computeSineCosine(rotation, sine, cosine);
+
+      float* const targets[4] = { matrices + static_cast<size_t>(h0) * 16, matrices + static_cast<size_t>(h1) * 16,
+        matrices + static_cast<size_t>(h2) * 16, matrices + static_cast<size_t>(h3) * 16 };
+
+      storeModelMatrices(_mm_mul_ps(cosine, scaleX), _mm_mul_ps(sine, scaleX), _mm_mul_ps(_mm_xor_ps(sine, _mm_set1_ps(-0.0f)), scaleY),
+        _mm_mul_ps(cosine, scaleY), positionX, positionY, layer, targets);
+    }
+#endif
+
+    for (; i < count; i++) {
+      auto handle = handles[i];
+      computeModelMatrix(_positionX[handle], _positionY[handle], _rotation[handle], _scaleX[handle], _scaleY[handle], _layer[handle],
+        matrices + static_cast<size_t>(handle) * 16);
+    }
+  }
+
+  const char* TransformStore::getInstructionSet() noexcept {
+#if defined(NOVELRT_TRANSFORMSTORE_AVX2)
+    return "AVX2";
+#elif defined(NOVELRT_TRANSFORMSTORE_SSE2)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+  }
+}
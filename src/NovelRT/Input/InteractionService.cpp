@@ -125,10 +125,17 @@ namespace NovelRT::Input {
     }
   }
 
-void InteractionService::consumePlayerInput() {
+void InteractionService::consumePlayerInput(Timing::Timestamp maximumWait) {
   _currentBufferIndex = (_currentBufferIndex + 1) % INPUT_BUFFER_COUNT;
   _keyStates.at(_currentBufferIndex).clear();
-  glfwPollEvents();
+
+  if (maximumWait > Timing::Timestamp::zero()) {
+    glfwWaitEventsTimeout(maximumWait.getSecondsDouble());
+  }
+  else {
+    glfwPollEvents();
+  }
+
   processKeyStates();
   _previousBufferIndex = _currentBufferIndex;
 
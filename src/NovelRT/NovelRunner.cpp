@@ -3,10 +3,12 @@
 #include <NovelRT.h>
 
 namespace NovelRT {
-  NovelRunner::NovelRunner(int32_t displayNumber, const std::string& windowTitle, uint32_t targetFrameRate, bool transparency) :
+  NovelRunner::NovelRunner(int32_t displayNumber, const std::string& windowTitle, uint32_t targetFrameRate, bool transparency, bool headless) :
     SceneConstructionRequested(Utilities::Event<>()),
     Update(Utilities::Event<Timing::Timestamp>()),
     _exitCode(1),
+    _idleTimeout(Timing::Timestamp::fromSeconds(0.1)),
+    _nextUpdateDelay(_idleTimeout),
     _stepTimer(Utilities::Lazy<std::unique_ptr<Timing::StepTimer>>(std::function<Timing::StepTimer*()>([targetFrameRate] {return new Timing::StepTimer(targetFrameRate); }))),
     _novelWindowingService(std::make_shared<Windowing::WindowingService>()),
     _novelInteractionService(std::make_shared<Input::InteractionService>(getWindowingService())),
@@ -17,23 +19,52 @@ namespace NovelRT {
     if (!glfwInit()) {
       const char* err = "";
       glfwGetError(&err);
-       _loggingService.logError("GLFW ERROR: {}", err);
-      throw Exceptions::InitialisationFailureException("Unable to continue! Cannot start without a glfw window.", err);
+      if (!headless) {
+        _loggingService.logError("GLFW ERROR: {}", err);
+        throw Exceptions::InitialisationFailureException("Unable to continue! Cannot start without a glfw window.", err);
+      }
+
+      // CI machines usually have no display server, so GLFW failing is expected here. Nothing headless depends on it.
+      _loggingService.logWarning("GLFW could not be initialised, continuing headless without it: {}", err);
+    }
+
+    if (headless) {
+      _novelWindowingService->initialiseHeadless(windowTitle, Maths::GeoVector2F(1920.0f, 1080.0f));
+    }
+    else {
+      _novelWindowingService->initialiseWindow(displayNumber, windowTitle, transparency);
     }
-    _novelWindowingService->initialiseWindow(displayNumber, windowTitle, transparency);
     _novelRenderer->initialiseRendering();
     _novelInteractionService->setScreenSize(_novelWindowingService->getWindowSize());
     _novelWindowingService->WindowTornDown += [this] { _exitCode = 0; };
+
+    //Screen transitions run to the runner's clock, and keep frames coming until they finish even while nothing else changes.
+    Update += [this](Timing::Timestamp delta) {
+      auto& transition = _novelRenderer->getScreenTransition();
+      if (!transition.isActive()) return;
+
+      transition.update(delta);
+      requestUpdateWithin(Timing::Timestamp::zero());
+    };
   }
 
   int32_t NovelRunner::runNovel() {
     while (_exitCode) {
+      _nextUpdateDelay = _idleTimeout;
       _stepTimer.getActual()->tick(Update);
       _novelDebugService->setFramesPerSecond(_stepTimer.getActual()->getFramesPerSecond());
       _novelRenderer->beginFrame();
       SceneConstructionRequested();
       _novelRenderer->endFrame();
-      _novelInteractionService->consumePlayerInput();
+
+      //Rather than spin while nothing on screen changes, sleep until there is input or something asked to update. A click that
+      //is about to run may change anything, so that never waits. Headless runs have no input to wait for.
+      auto maximumWait = Timing::Timestamp::zero();
+      if (_novelRenderer->wasLastFrameSkipped() && !_novelInteractionService->hasClickedInteractable() && !_novelWindowingService->isHeadless()) {
+        maximumWait = _nextUpdateDelay;
+      }
+
+      _novelInteractionService->consumePlayerInput(maximumWait);
       _novelInteractionService->executeClickedInteractable();
       _novelAudioService->checkSources();
     }
@@ -42,6 +73,10 @@ namespace NovelRT {
     return _exitCode;
   }
 
+  void NovelRunner::requestExit() noexcept {
+    _exitCode = 0;
+  }
+
   std::shared_ptr<Graphics::RenderingService> NovelRunner::getRenderer() const {
     return _novelRenderer;
   }
@@ -6,10 +6,15 @@
 #include <NovelRT.h>
 
 namespace NovelRT::Timing {
+  // GLFW's timer only works once GLFW is initialised, which headless runs cannot rely on.
+  static uint64_t getCounterValue() noexcept {
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+  }
+
   StepTimer::StepTimer(uint32_t targetFrameRate, double maxSecondDelta) :
-    _frequency(glfwGetTimerFrequency()),
+    _frequency(static_cast<uint64_t>(std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num)),
     _maxCounterDelta(static_cast<uint64_t>(_frequency * maxSecondDelta)),
-    _lastCounter(glfwGetTimerValue()),
+    _lastCounter(getCounterValue()),
     _secondCounter(0),
     _remainingTicks(0),
     _elapsedTicks(0),
@@ -22,7 +27,7 @@ namespace NovelRT::Timing {
   }
 
   void StepTimer::resetElapsedTime() {
-    _lastCounter = glfwGetTimerValue();
+    _lastCounter = getCounterValue();
     _secondCounter = 0;
     _remainingTicks = 0;
     _framesPerSecond = 0;
@@ -30,7 +35,7 @@ namespace NovelRT::Timing {
   }
 
   void StepTimer::tick(const Utilities::Event<Timestamp>& update) {
-    auto currentCounter = glfwGetTimerValue();
+    auto currentCounter = getCounterValue();
     auto counterDelta = currentCounter - _lastCounter;
 
     // This handles excessibly large deltas to avoid overcompting.
@@ -0,0 +1,106 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+#if !defined(WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace NovelRT::Utilities {
+  MemoryMappedFile::MemoryMappedFile(const std::string& file) :
+    _file(file),
+    _data(nullptr),
+    _size(0)
+#if defined(WIN32)
+    , _fileHandle(INVALID_HANDLE_VALUE),
+    _mappingHandle(nullptr)
+#endif
+  {
+    LoggingService logger(Misc::CONSOLE_LOG_GENERIC);
+
+#if defined(WIN32)
+    _fileHandle = CreateFileA(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (_fileHandle == INVALID_HANDLE_VALUE) {
+      logger.logError("File {} cannot be opened! Please ensure the path is correct and that the file is not locked.", file);
+      throw Exceptions::FileNotFoundException(file);
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(_fileHandle, &fileSize)) {
+      CloseHandle(_fileHandle);
+      logger.logError("The size of file {} could not be read.", file);
+      throw Exceptions::IOException(file, "Unable to continue! The file could not be mapped into memory.");
+    }
+
+    _size = static_cast<size_t>(fileSize.QuadPart);
+    if (_size == 0) return;
+
+    _mappingHandle = CreateFileMappingA(_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    auto view = _mappingHandle == nullptr ? nullptr : MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+      if (_mappingHandle != nullptr) {
+        CloseHandle(_mappingHandle);
+      }
+
+      CloseHandle(_fileHandle);
+      logger.logError("File {} could not be mapped into memory.", file);
+      throw Exceptions::IOException(file, "Unable to continue! The file could not be mapped into memory.");
+    }
+
+    _data = static_cast<const uint8_t*>(view);
+#else
+    auto fileDescriptor = open(file.c_str(), O_RDONLY);
+    if (fileDescriptor == -1) {
+      logger.logError("File {} cannot be opened! Please ensure the path is correct and that the file is not locked.", file);
+      throw Exceptions::FileNotFoundException(file);
+    }
+
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) == -1) {
+      close(fileDescriptor);
+      logger.logError("The size of file {} could not be read.", file);
+      throw Exceptions::IOException(file, "Unable to continue! The file could not be mapped into memory.");
+    }
+
+    _size = static_cast<size_t>(fileStatus.st_size);
+    if (_size == 0) {
+      close(fileDescriptor);
+      return;
+    }
+
+    //The mapping keeps its own reference to the file, so the descriptor is not needed once it exists.
+    auto view = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+
+    if (view == MAP_FAILED) {
+      logger.logError("File {} could not be mapped into memory.", file);
+      throw Exceptions::IOException(file, "Unable to continue! The file could not be mapped into memory.");
+    }
+
+    _data = static_cast<const uint8_t*>(view);
+#endif
+  }
+
+  MemoryMappedFile::~MemoryMappedFile() {
+#if defined(WIN32)
+    if (_data != nullptr) {
+      UnmapViewOfFile(_data);
+    }
+
+    if (_mappingHandle != nullptr) {
+      CloseHandle(_mappingHandle);
+    }
+
+    if (_fileHandle != INVALID_HANDLE_VALUE) {
+      CloseHandle(_fileHandle);
+    }
+#else
+    if (_data != nullptr) {
+      munmap(const_cast<uint8_t*>(_data), _size);
+    }
+#endif
+  }
+}
@@ -0,0 +1,162 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+#if defined(NOVELRT_HEADLESS_EGL)
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+namespace NovelRT::Windowing {
+#if defined(NOVELRT_HEADLESS_EGL)
+  static bool hasExtension(const char* extensions, const std::string& name) {
+    if (extensions == nullptr) return false;
+
+    std::istringstream stream(extensions);
+    std::string extension;
+    while (stream >> extension) {
+      if (extension == name) return true;
+    }
+
+    return false;
+  }
+
+  HeadlessContext::HeadlessContext() :
+    _display(EGL_NO_DISPLAY),
+    _context(EGL_NO_CONTEXT),
+    _surface(EGL_NO_SURFACE),
+    _logger(LoggingService(Utilities::Misc::CONSOLE_LOG_WINDOWING)) {
+    _logger.logInfo("Attempting to create headless OpenGL ES v3.0 context using EGL API");
+
+    if (hasExtension(eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS), "EGL_MESA_platform_surfaceless")) {
+      auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+      if (getPlatformDisplay != nullptr) {
+        _display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+      }
+    }
+
+    if (_display == EGL_NO_DISPLAY) {
+      _logger.logWarning("The surfaceless EGL platform is not available. Falling back to the default display.");
+      _display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+
+    EGLint major = 0;
+    EGLint minor = 0;
+    if (_display == EGL_NO_DISPLAY || !eglInitialize(_display, &major, &minor)) {
+      _display = EGL_NO_DISPLAY;
+      _logger.logError("Failed to initialise EGL. EGL error: {:#x}", eglGetError());
+      throw Exceptions::InitialisationFailureException("Unable to continue! EGL could not be initialised.");
+    }
+
+    _logger.logInfo("EGL version: {}.{}", major, minor);
+
+    // Without EGL_KHR_surfaceless_context a context cannot be made current on its own, so a pbuffer capable config is needed.
+    bool isSurfaceless = hasExtension(eglQueryString(_display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context");
+
+    const EGLint configAttributes[] = {
+      EGL_SURFACE_TYPE, isSurfaceless ? 0 : EGL_PBUFFER_BIT,
+      EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT_KHR,
+      EGL_RED_SIZE, 8,
+      EGL_GREEN_SIZE, 8,
+      EGL_BLUE_SIZE, 8,
+      EGL_ALPHA_SIZE, 8,
+      EGL_NONE
+    };
+
+    EGLConfig config = nullptr;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(_display, configAttributes, &config, 1, &configCount) || configCount == 0) {
+      release();
+      _logger.logError("No EGL config supports OpenGL ES v3.0.");
+      throw Exceptions::InitialisationFailureException("Unable to continue! No EGL config supports OpenGL ES v3.0.");
+    }
+
+    eglBindAPI(EGL_OPENGL_ES_API);
+
+    const EGLint contextAttributes[] = {
+      EGL_CONTEXT_CLIENT_VERSION, 3,
+      EGL_NONE
+    };
+
+    _context = eglCreateContext(_display, config, EGL_NO_CONTEXT, contextAttributes);
+    if (_context == EGL_NO_CONTEXT) {
+      auto error = eglGetError();
+      release();
+      _logger.logError("Failed to create OpenGL ES v3.0 context using EGL API. EGL error: {:#x}", error);
+      throw Exceptions::InitialisationFailureException("Unable to continue! EGL could not create an OpenGL ES v3.0 context.");
+    }
+
+    if (!isSurfaceless) {
+      const EGLint pbufferAttributes[] = {
+        EGL_WIDTH, 1,
+        EGL_HEIGHT, 1,
+        EGL_NONE
+      };
+
+      _surface = eglCreatePbufferSurface(_display, config, pbufferAttributes);
+      if (_surface == EGL_NO_SURFACE) {
+        auto error = eglGetError();
+        release();
+        _logger.logError("Failed to create EGL pbuffer surface. EGL error: {:#x}", error);
+        throw Exceptions::InitialisationFailureException("Unable to continue! EGL could not create a pbuffer surface.");
+      }
+    }
+
+    makeCurrent();
+    _logger.logInfo("Headless context succesfully created.");
+  }
+
+  void HeadlessContext::makeCurrent() {
+    if (!eglMakeCurrent(_display, _surface, _surface, _context)) {
+      _logger.logError("Failed to make the headless context current. EGL error: {:#x}", eglGetError());
+      throw Exceptions::InitialisationFailureException("Unable to continue! The headless context could not be made current.");
+    }
+  }
+
+  void* HeadlessContext::getProcAddress(const char* name) {
+    return reinterpret_cast<void*>(eglGetProcAddress(name));
+  }
+
+  void HeadlessContext::release() noexcept {
+    if (_display == EGL_NO_DISPLAY) return;
+
+    eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+    if (_surface != EGL_NO_SURFACE) {
+      eglDestroySurface(_display, _surface);
+      _surface = EGL_NO_SURFACE;
+    }
+
+    if (_context != EGL_NO_CONTEXT) {
+      eglDestroyContext(_display, _context);
+      _context = EGL_NO_CONTEXT;
+    }
+
+    eglTerminate(_display);
+    _display = EGL_NO_DISPLAY;
+  }
+#else
+  HeadlessContext::HeadlessContext() :
+    _display(nullptr),
+    _context(nullptr),
+    _surface(nullptr),
+    _logger(LoggingService(Utilities::Misc::CONSOLE_LOG_WINDOWING)) {
+    _logger.logError("Headless rendering needs EGL, but the engine was built without it.");
+    throw Exceptions::NotSupportedException("Unable to continue! Headless rendering is not supported by this build of the engine.");
+  }
+
+  void HeadlessContext::makeCurrent() {
+  }
+
+  void* HeadlessContext::getProcAddress(const char* /*name*/) {
+    return nullptr;
+  }
+
+  void HeadlessContext::release() noexcept {
+  }
+#endif
+
+  HeadlessContext::~HeadlessContext() {
+    release();
+  }
+}
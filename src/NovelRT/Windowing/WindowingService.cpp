@@ -6,14 +6,17 @@ namespace NovelRT::Windowing {
   WindowingService::WindowingService() noexcept :
     WindowResized(Utilities::Event<Maths::GeoVector2F>()),
     WindowTornDown(Utilities::Event<>()),
+    WindowRefreshRequested(Utilities::Event<>()),
     MouseButtonClicked(Utilities::Event<MouseClickEventArgs>()),
     KeyboardButtonChanged(Utilities::Event<KeyboardButtonChangeEventArgs>()),
     _window(std::unique_ptr<GLFWwindow, decltype(&glfwDestroyWindow)>(nullptr, glfwDestroyWindow)),
+    _headlessContext(nullptr),
     _logger(LoggingService(Utilities::Misc::CONSOLE_LOG_WINDOWING)),
 #if defined(_WIN32) || defined(_WIN64)
     _optimus(),
 #endif
-    _isTornDown(false) {
+    _isTornDown(false),
+    _isHeadless(false) {
   }
 
   void WindowingService::errorCallback(int32_t, const char* error) {
@@ -111,6 +114,13 @@ namespace NovelRT::Windowing {
       thisPtr->WindowResized(thisPtr->_windowSize); });
     _windowSize = Maths::GeoVector2F(static_cast<float>(wData), static_cast<float>(hData));
 
+    // Some platforms throw the window's contents away when it is uncovered or restored, and want it drawn again.
+    glfwSetWindowRefreshCallback(_window.get(), [](auto targetWindow) {
+      auto thisPtr = reinterpret_cast<WindowingService*>(glfwGetWindowUserPointer(targetWindow));
+      thisPtr->_logger.throwIfNullPtr(thisPtr, "Unable to continue! WindowUserPointer is NULL. Did you modify this pointer?");
+      thisPtr->WindowRefreshRequested();
+      });
+
     glfwSetMouseButtonCallback(_window.get(), [](auto targetWindow, auto mouseButton, auto action, auto /*mods*/) {
       auto thisPtr = reinterpret_cast<WindowingService*>(glfwGetWindowUserPointer(targetWindow));
       thisPtr->_logger.throwIfNullPtr(thisPtr, "Unable to continue! WindowUserPointer is NULL. Did you modify this pointer?");
@@ -131,6 +141,39 @@ namespace NovelRT::Windowing {
 
   }
 
+  void WindowingService::initialiseHeadless(const std::string& windowTitle, Maths::GeoVector2F windowSize) {
+    _headlessContext = std::make_unique<HeadlessContext>();
+    _isHeadless = true;
+    _windowTitle = windowTitle;
+    _windowSize = windowSize;
+  }
+
+  void WindowingService::makeContextCurrent() {
+    if (isHeadless()) {
+      _headlessContext->makeCurrent();
+    }
+    else {
+      glfwMakeContextCurrent(getWindow());
+    }
+  }
+
+  GLADloadproc WindowingService::getProcAddressLoader() const {
+    if (isHeadless()) {
+      return HeadlessContext::getProcAddress;
+    }
+
+    return reinterpret_cast<GLADloadproc>(glfwGetProcAddress);
+  }
+
+  void WindowingService::swapBuffers() {
+    if (isHeadless()) {
+      glFinish();
+    }
+    else {
+      glfwSwapBuffers(getWindow());
+    }
+  }
+
 #if defined(_WIN64) || defined(_WIN32)
   void WindowingService::checkForOptimus(const char* library) {
     _optimus = LoadLibrary(reinterpret_cast<LPCSTR>(library));
@@ -152,6 +195,11 @@ namespace NovelRT::Windowing {
 
     _isTornDown = true;
 
-    glfwDestroyWindow(getWindow());
+    if (isHeadless()) {
+      _headlessContext.reset();
+    }
+    else {
+      glfwDestroyWindow(getWindow());
+    }
   }
 }
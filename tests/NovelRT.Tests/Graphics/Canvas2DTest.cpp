@@ -0,0 +1,118 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+using namespace NovelRT::Maths;
+
+static const RGBAConfig GREEN = RGBAConfig(0, 255, 0, 255);
+
+class Canvas2DTest : public testing::Test {
+protected:
+  std::unique_ptr<Canvas2D> _canvas;
+
+  void SetUp() override {
+    _canvas = std::make_unique<Canvas2D>(0, ShaderProgram(), nullptr, nullptr);
+  }
+
+  static float getDistance(GeoVector3F first, GeoVector2F second) {
+    return (GeoVector2F(first.x, first.y) - second).getMagnitude();
+  }
+};
+
+TEST_F(Canvas2DTest, rectIsTwoTrianglesCoveringItsBounds) {
+  _canvas->drawRect(GeoVector2F(10.0f, 20.0f), GeoVector2F(4.0f, 6.0f), GREEN);
+
+  EXPECT_EQ(6u, _canvas->getVertices().size());
+  EXPECT_EQ(GeoBounds(GeoVector2F(10.0f, 20.0f), GeoVector2F(4.0f, 6.0f), 0.0f), _canvas->getBounds());
+  EXPECT_EQ(ShapeVertex::packColour(GREEN), _canvas->getVertices()[3].colour);
+}
+
+TEST_F(Canvas2DTest, curveSegmentCountGrowsWithRadiusWithinLimits) {
+  auto fullTurn = 2.0f * 3.14159265f;
+  EXPECT_EQ(8u, Canvas2D::getCurveSegmentCount(0.1f, fullTurn));
+  EXPECT_EQ(256u, Canvas2D::getCurveSegmentCount(100000.0f, fullTurn));
+  EXPECT_LT(Canvas2D::getCurveSegmentCount(10.0f, fullTurn), Canvas2D::getCurveSegmentCount(100.0f, fullTurn));
+  EXPECT_LT(Canvas2D::getCurveSegmentCount(100.0f, fullTurn / 4.0f), Canvas2D::getCurveSegmentCount(100.0f, fullTurn));
+}
+
+TEST_F(Canvas2DTest, circleStaysWithinTheToleranceOfItsCurve) {
+  auto centre = GeoVector2F(50.0f, 50.0f);
+  _canvas->drawCircle(centre, 100.0f, GREEN);
+
+  auto segments = Canvas2D::getCurveSegmentCount(100.0f, 2.0f * 3.14159265f);
+  ASSERT_EQ(segments * 3, _canvas->getVertices().size());
+  for (size_t i = 0; i < _canvas->getVertices().size(); i += 3) {
+    EXPECT_NEAR(100.0f, getDistance(_canvas->getVertices()[i + 1].position, centre), 0.001f);
+  }
+
+  //The middle of each chord is as far as the outline gets from the true circle.
+  EXPECT_GE(std::cos(3.14159265f / static_cast<float>(segments)) * 100.0f, 99.75f);
+}
+
+TEST_F(Canvas2DTest, roundedRectFillsItsBoundsAndCanFallBackToARect) {
+  _canvas->drawRoundedRect(GeoVector2F(0.0f, 0.0f), GeoVector2F(40.0f, 20.0f), 50.0f, GREEN);
+  EXPECT_GT(_canvas->getVertices().size(), 6u);
+  EXPECT_EQ(GeoBounds(GeoVector2F(0.0f, 0.0f), GeoVector2F(40.0f, 20.0f), 0.0f), _canvas->getBounds());
+
+  _canvas->clear();
+  _canvas->drawRoundedRect(GeoVector2F(0.0f, 0.0f), GeoVector2F(40.0f, 20.0f), 0.0f, GREEN);
+  EXPECT_EQ(6u, _canvas->getVertices().size());
+}
+
+TEST_F(Canvas2DTest, lineIsOffsetByHalfItsThickness) {
+  _canvas->drawLine(GeoVector2F(0.0f, 0.0f), GeoVector2F(10.0f, 0.0f), 2.0f, GREEN);
+
+  EXPECT_EQ(6u, _canvas->getVertices().size());
+  EXPECT_EQ(GeoBounds(GeoVector2F(5.0f, 0.0f), GeoVector2F(10.0f, 2.0f), 0.0f), _canvas->getBounds());
+}
+
+TEST_F(Canvas2DTest, polylineMitresItsJoinsAndSkipsRepeatedPoints) {
+  _canvas->drawPolyline({ GeoVector2F(0.0f, 0.0f), GeoVector2F(10.0f, 0.0f), GeoVector2F(10.0f, 0.0f), GeoVector2F(10.0f, 10.0f) }, 2.0f, GREEN);
+
+  EXPECT_EQ(12u, _canvas->getVertices().size());
+  EXPECT_EQ(GeoBounds(GeoVector2F(5.5f, 4.5f), GeoVector2F(11.0f, 11.0f), 0.0f), _canvas->getBounds());
+}
+
+TEST_F(Canvas2DTest, polylineCutsSharpJoinsShort) {
+  auto joint = GeoVector2F(10.0f, 0.0f);
+  _canvas->drawPolyline({ GeoVector2F(0.0f, 0.0f), joint, GeoVector2F(0.0f, 0.1f) }, 2.0f, GREEN);
+
+  for (const auto& vertex : _canvas->getVertices()) {
+    if (vertex.position.x > 5.0f) {
+      EXPECT_LE(getDistance(vertex.position, joint), 4.0f + 0.001f);
+    }
+  }
+}
+
+TEST_F(Canvas2DTest, closedPolylineJoinsItsLastPointToItsFirst) {
+  std::vector<GeoVector2F> square = { GeoVector2F(0.0f, 0.0f), GeoVector2F(10.0f, 0.0f), GeoVector2F(10.0f, 10.0f), GeoVector2F(0.0f, 10.0f) };
+  _canvas->drawPolyline(square, 2.0f, GREEN, true);
+  EXPECT_EQ(24u, _canvas->getVertices().size());
+  EXPECT_EQ(GeoBounds(GeoVector2F(5.0f, 5.0f), GeoVector2F(12.0f, 12.0f), 0.0f), _canvas->getBounds());
+
+  _canvas->clear();
+  square.push_back(square.front());
+  _canvas->drawPolyline(square, 2.0f, GREEN, true);
+  EXPECT_EQ(24u, _canvas->getVertices().size());
+}
+
+TEST_F(Canvas2DTest, shapesWithNothingToFillAreSkipped) {
+  _canvas->drawLine(GeoVector2F(1.0f, 1.0f), GeoVector2F(1.0f, 1.0f), 2.0f, GREEN);
+  _canvas->drawLine(GeoVector2F(0.0f, 0.0f), GeoVector2F(1.0f, 1.0f), 0.0f, GREEN);
+  _canvas->drawCircle(GeoVector2F(0.0f, 0.0f), 0.0f, GREEN);
+  _canvas->drawPolyline({ GeoVector2F(1.0f, 1.0f), GeoVector2F(1.0f, 1.0f) }, 2.0f, GREEN);
+
+  EXPECT_TRUE(_canvas->getVertices().empty());
+}
+
+TEST_F(Canvas2DTest, clearRemovesEveryShape) {
+  _canvas->drawRect(GeoVector2F(10.0f, 20.0f), GeoVector2F(4.0f, 6.0f), GREEN);
+  _canvas->drawCircle(GeoVector2F(0.0f, 0.0f), 5.0f, GREEN);
+  _canvas->clear();
+
+  EXPECT_TRUE(_canvas->getVertices().empty());
+  EXPECT_EQ(GeoBounds(GeoVector2F::zero(), GeoVector2F::zero(), 0.0f), _canvas->getBounds());
+}
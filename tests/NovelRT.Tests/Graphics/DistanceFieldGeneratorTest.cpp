@@ -0,0 +1,61 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+
+namespace {
+  std::vector<uint8_t> createFilledSquare(uint32_t size, uint32_t border) {
+    std::vector<uint8_t> coverage(static_cast<size_t>(size) * size, 0);
+    for (uint32_t y = border; y < size - border; y++) {
+      for (uint32_t x = border; x < size - border; x++) {
+        coverage[static_cast<size_t>(y) * size + x] = 255;
+      }
+    }
+
+    return coverage;
+  }
+}
+
+TEST(DistanceFieldGeneratorTest, fieldIsPaddedBySpreadOnEverySide) {
+  auto coverage = createFilledSquare(8, 2);
+  auto field = DistanceFieldGenerator::generate(coverage.data(), 8, 8, 4);
+
+  EXPECT_EQ(16u * 16u, field.size());
+}
+
+TEST(DistanceFieldGeneratorTest, insideIsBrighterThanTheEdgeAndOutsideIsDarker) {
+  auto coverage = createFilledSquare(16, 4);
+  auto field = DistanceFieldGenerator::generate(coverage.data(), 16, 16, 4);
+  auto getValue = [&field](size_t x, size_t y) { return field[y * 24 + x]; };
+
+  //The square covers 8..15 in field space, so its centre is at 12 and its left edge falls between 7 and 8.
+  EXPECT_GT(getValue(12, 12), 128);
+  EXPECT_LT(getValue(4, 12), 128);
+  EXPECT_EQ(0, getValue(0, 0));
+  EXPECT_GT(getValue(8, 12), getValue(7, 12));
+  EXPECT_NEAR(128, (getValue(8, 12) + getValue(7, 12)) / 2, 16);
+}
+
+TEST(DistanceFieldGeneratorTest, fieldIsSymmetricForSymmetricShapes) {
+  auto coverage = createFilledSquare(10, 3);
+  auto field = DistanceFieldGenerator::generate(coverage.data(), 10, 10, 3);
+
+  for (size_t y = 0; y < 16; y++) {
+    for (size_t x = 0; x < 16; x++) {
+      EXPECT_EQ(field[y * 16 + x], field[y * 16 + (15 - x)]);
+      EXPECT_EQ(field[y * 16 + x], field[x * 16 + y]);
+    }
+  }
+}
+
+TEST(DistanceFieldGeneratorTest, emptyCoverageIsOutsideEverywhere) {
+  std::vector<uint8_t> coverage(9, 0);
+  auto field = DistanceFieldGenerator::generate(coverage.data(), 3, 3, 2);
+
+  for (auto value : field) {
+    EXPECT_EQ(0, value);
+  }
+}
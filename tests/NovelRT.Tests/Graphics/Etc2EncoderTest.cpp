@@ -0,0 +1,176 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+
+namespace {
+  //A reference decoder for the parts of ETC2 the encoder produces, written straight from the specification.
+  const int32_t colourModifierTables[8][2] = {{2, 8}, {5, 17}, {9, 29}, {13, 42}, {18, 60}, {24, 80}, {33, 106}, {47, 183}};
+  const int32_t alphaModifierTables[16][8] = {
+    {-3, -6, -9, -15, 2, 5, 8, 14}, {-3, -7, -10, -13, 2, 6, 9, 12}, {-2, -5, -8, -13, 1, 4, 7, 12}, {-2, -4, -6, -13, 1, 3, 5, 12},
+    {-3, -6, -8, -12, 2, 5, 7, 11}, {-3, -7, -9, -11, 2, 6, 8, 10}, {-4, -7, -8, -11, 3, 6, 7, 10}, {-3, -5, -8, -11, 2, 4, 7, 10},
+    {-2, -6, -8, -10, 1, 5, 7, 9}, {-2, -5, -8, -10, 1, 4, 7, 9}, {-2, -4, -8, -10, 1, 3, 7, 9}, {-2, -5, -7, -10, 1, 4, 6, 9},
+    {-3, -4, -7, -10, 2, 3, 6, 9}, {-1, -2, -3, -10, 0, 1, 2, 9}, {-4, -6, -8, -9, 3, 5, 7, 8}, {-3, -5, -7, -9, 2, 4, 6, 8}
+  };
+
+  uint64_t readBigEndian(const uint8_t* block) {
+    uint64_t bits = 0;
+    for (int32_t i = 0; i < 8; i++) {
+      bits = (bits << 8) | block[i];
+    }
+
+    return bits;
+  }
+
+  RgbaImage decodeRgb8Block(const uint8_t* block) {
+    auto bits = readBigEndian(block);
+    auto isDifferential = ((bits >> 33) & 1) != 0;
+    auto isFlipped = ((bits >> 32) & 1) != 0;
+    int32_t bases[2][3];
+
+    for (uint32_t channel = 0; channel < 3; channel++) {
+      if (isDifferential) {
+        auto first = static_cast<int32_t>((bits >> (59 - channel * 8)) & 0x1F);
+        auto offset = static_cast<int32_t>((bits >> (56 - channel * 8)) & 0x7);
+        auto second = first + (offset >= 4 ? offset - 8 : offset);
+        EXPECT_TRUE(second >= 0 && second <= 31);
+        bases[0][channel] = (first << 3) | (first >> 2);
+        bases[1][channel] = (second << 3) | (second >> 2);
+      }
+      else {
+        auto first = static_cast<int32_t>((bits >> (60 - channel * 8)) & 0xF);
+        auto second = static_cast<int32_t>((bits >> (56 - channel * 8)) & 0xF);
+        bases[0][channel] = (first << 4) | first;
+        bases[1][channel] = (second << 4) | second;
+      }
+    }
+
+    uint64_t tables[2] = {(bits >> 37) & 0x7, (bits >> 34) & 0x7};
+    RgbaImage image(4, 4);
+    for (uint32_t x = 0; x < 4; x++) {
+      for (uint32_t y = 0; y < 4; y++) {
+        auto i = x * 4 + y;
+        auto subblock = (isFlipped ? y : x) >= 2 ? 1 : 0;
+        auto index = (((bits >> (16 + i)) & 1) << 1) | ((bits >> i) & 1);
+        auto modifier = colourModifierTables[tables[subblock]][index & 1] * ((index & 2) != 0 ? -1 : 1);
+        auto pixel = image.getPixel(x, y);
+        for (uint32_t channel = 0; channel < 3; channel++) {
+          pixel[channel] = static_cast<uint8_t>(std::clamp(bases[subblock][channel] + modifier, 0, 255));
+        }
+
+        pixel[3] = 255;
+      }
+    }
+
+    return image;
+  }
+
+  std::vector<uint8_t> decodeAlphaBlock(const uint8_t* block) {
+    auto bits = readBigEndian(block);
+    auto base = static_cast<int32_t>(bits >> 56);
+    auto multiplier = static_cast<int32_t>((bits >> 52) & 0xF);
+    auto table = (bits >> 48) & 0xF;
+    EXPECT_NE(0, multiplier);
+
+    std::vector<uint8_t> alphas(16);
+    for (uint32_t x = 0; x < 4; x++) {
+      for (uint32_t y = 0; y < 4; y++) {
+        auto index = (bits >> (45 - (x * 4 + y) * 3)) & 0x7;
+        alphas[y * 4 + x] = static_cast<uint8_t>(std::clamp(base + alphaModifierTables[table][index] * multiplier, 0, 255));
+      }
+    }
+
+    return alphas;
+  }
+
+  RgbaImage createImage(uint32_t width, uint32_t height, std::function<void(uint32_t, uint32_t, uint8_t*)> fill) {
+    RgbaImage image(width, height);
+    for (uint32_t y = 0; y < height; y++) {
+      for (uint32_t x = 0; x < width; x++) {
+        fill(x, y, image.getPixel(x, y));
+      }
+    }
+
+    return image;
+  }
+
+  void expectColourNear(const uint8_t* expected, const uint8_t* actual, int32_t tolerance) {
+    for (uint32_t channel = 0; channel < 3; channel++) {
+      EXPECT_NEAR(expected[channel], actual[channel], tolerance);
+    }
+  }
+}
+
+TEST(Etc2EncoderTest, solidColourBlocksDecodeCloseToTheirColour) {
+  for (auto colour : {std::array<uint8_t, 4>{0, 0, 0, 255}, std::array<uint8_t, 4>{255, 255, 255, 255},
+         std::array<uint8_t, 4>{200, 30, 90, 255}, std::array<uint8_t, 4>{17, 128, 240, 255}}) {
+    auto image = createImage(4, 4, [&](uint32_t, uint32_t, uint8_t* pixel) { std::memcpy(pixel, colour.data(), 4); });
+    uint8_t block[Etc2Encoder::Rgb8BlockSize];
+    Etc2Encoder::encodeRgb8Block(image.pixels.data(), 16, block);
+
+    auto decoded = decodeRgb8Block(block);
+    for (uint32_t i = 0; i < 16; i++) {
+      expectColourNear(colour.data(), decoded.pixels.data() + i * 4, 8);
+    }
+  }
+}
+
+TEST(Etc2EncoderTest, eachHalfOfABlockKeepsItsOwnColour) {
+  uint8_t red[4] = {220, 20, 20, 255};
+  uint8_t blue[4] = {20, 20, 220, 255};
+
+  for (auto isFlipped : {false, true}) {
+    auto image = createImage(4, 4, [&](uint32_t x, uint32_t y, uint8_t* pixel) { std::memcpy(pixel, ((isFlipped ? y : x) < 2) ? red : blue, 4); });
+    uint8_t block[Etc2Encoder::Rgb8BlockSize];
+    Etc2Encoder::encodeRgb8Block(image.pixels.data(), 16, block);
+
+    auto decoded = decodeRgb8Block(block);
+    for (uint32_t y = 0; y < 4; y++) {
+      for (uint32_t x = 0; x < 4; x++) {
+        expectColourNear(image.getPixel(x, y), decoded.getPixel(x, y), 12);
+      }
+    }
+  }
+}
+
+TEST(Etc2EncoderTest, solidAlphaDecodesExactly) {
+  for (uint8_t alpha : {0, 1, 128, 254, 255}) {
+    auto image = createImage(4, 4, [&](uint32_t, uint32_t, uint8_t* pixel) { pixel[3] = alpha; });
+    uint8_t block[8];
+    Etc2Encoder::encodeAlphaBlock(image.pixels.data(), 16, block);
+
+    for (auto decoded : decodeAlphaBlock(block)) {
+      EXPECT_EQ(alpha, decoded);
+    }
+  }
+}
+
+TEST(Etc2EncoderTest, alphaGradientDecodesClosely) {
+  auto image = createImage(4, 4, [](uint32_t x, uint32_t y, uint8_t* pixel) { pixel[3] = static_cast<uint8_t>(100 + (y * 4 + x) * 4); });
+  uint8_t block[8];
+  Etc2Encoder::encodeAlphaBlock(image.pixels.data(), 16, block);
+
+  auto decoded = decodeAlphaBlock(block);
+  for (uint32_t i = 0; i < 16; i++) {
+    EXPECT_NEAR(image.pixels[i * 4 + 3], decoded[i], 10);
+  }
+}
+
+TEST(Etc2EncoderTest, imagesAreEncodedInWholeBlocks) {
+  EXPECT_EQ(8u, Etc2Encoder::getEncodedSize(1, 1, false));
+  EXPECT_EQ(16u, Etc2Encoder::getEncodedSize(4, 4, true));
+  EXPECT_EQ(6u * 8u, Etc2Encoder::getEncodedSize(9, 5, false));
+
+  auto image = createImage(9, 5, [](uint32_t x, uint32_t y, uint8_t* pixel) {
+    pixel[0] = static_cast<uint8_t>(x * 20);
+    pixel[1] = static_cast<uint8_t>(y * 40);
+    pixel[2] = 100;
+    pixel[3] = 255;
+  });
+
+  EXPECT_EQ(Etc2Encoder::getEncodedSize(9, 5, false), Etc2Encoder::encodeRgb8(image).size());
+  EXPECT_EQ(Etc2Encoder::getEncodedSize(9, 5, true), Etc2Encoder::encodeRgba8(image).size());
+}
@@ -0,0 +1,46 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+using namespace NovelRT::Maths;
+
+GeoVector2F getUnitQuadCorner(GLushort index) {
+  return GeoVector2F(GeometryCache::UnitQuadVertices[index * 3], GeometryCache::UnitQuadVertices[index * 3 + 1]);
+}
+
+TEST(GeometryCacheTest, unitQuadHasFourVerticesCentredOnTheOrigin) {
+  auto vertexCount = GeometryCache::UnitQuadVertices.size() / 3;
+  EXPECT_EQ(vertexCount, 4u);
+
+  auto sum = GeoVector2F::zero();
+  for (GLushort i = 0; i < vertexCount; i++) {
+    auto corner = getUnitQuadCorner(i);
+    EXPECT_FLOAT_EQ(std::abs(corner.x), 0.5f);
+    EXPECT_FLOAT_EQ(std::abs(corner.y), 0.5f);
+    EXPECT_FLOAT_EQ(GeometryCache::UnitQuadVertices[i * 3 + 2], 0.0f);
+    sum += corner;
+  }
+
+  EXPECT_EQ(sum, GeoVector2F::zero());
+}
+
+TEST(GeometryCacheTest, unitQuadIndicesStayInRange) {
+  EXPECT_EQ(static_cast<GLsizei>(GeometryCache::UnitQuadIndices.size()), GeometryCache::UnitQuadIndexCount);
+
+  for (auto index : GeometryCache::UnitQuadIndices) {
+    EXPECT_LT(index, 4u);
+  }
+}
+
+TEST(GeometryCacheTest, unitQuadTrianglesAreWoundCounterClockwise) {
+  for (size_t i = 0; i < GeometryCache::UnitQuadIndices.size(); i += 3) {
+    auto a = getUnitQuadCorner(GeometryCache::UnitQuadIndices[i]);
+    auto b = getUnitQuadCorner(GeometryCache::UnitQuadIndices[i + 1]);
+    auto c = getUnitQuadCorner(GeometryCache::UnitQuadIndices[i + 2]);
+    auto crossProduct = ((b.x - a.x) * (c.y - a.y)) - ((b.y - a.y) * (c.x - a.x));
+    EXPECT_GT(crossProduct, 0.0f);
+  }
+}
@@ -0,0 +1,88 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+
+namespace {
+  std::string writeTestImage(const std::string& name, uint32_t width, uint32_t height, uint8_t value) {
+    RgbaImage image(width, height);
+    std::fill(image.pixels.begin(), image.pixels.end(), value);
+
+    auto file = (std::filesystem::temp_directory_path() / name).string();
+    PngCodec::encodeFile(file, image);
+    return file;
+  }
+
+  bool waitForResult(ImageDecodeWorkerPool& pool, ImageDecodeWorkerPool::Result& result) {
+    for (int32_t i = 0; i < 500; i++) {
+      if (pool.tryTakeResult(result)) return true;
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    return false;
+  }
+}
+
+TEST(ImageDecodeWorkerPoolTest, requestedFilesAreDecodedInTheBackground) {
+  auto file = writeTestImage("NovelRTDecodeWorkerPoolTest_decode.png", 4, 3, 128);
+  ImageDecodeWorkerPool pool(2);
+  ImageDecodeWorkerPool::Result result;
+
+  pool.request(42, file);
+
+  ASSERT_TRUE(waitForResult(pool, result));
+  EXPECT_TRUE(result.isSuccessful);
+  EXPECT_EQ(42u, result.requestId);
+  EXPECT_EQ(file, result.file);
+  EXPECT_EQ(4u, result.image.width);
+  EXPECT_EQ(3u, result.image.height);
+  EXPECT_EQ(128, result.image.getPixel(3, 2)[0]);
+  EXPECT_EQ(0u, pool.getPendingRequestCount());
+}
+
+TEST(ImageDecodeWorkerPoolTest, missingFilesProduceAFailedResult) {
+  ImageDecodeWorkerPool pool(1);
+  ImageDecodeWorkerPool::Result result;
+
+  pool.request(7, (std::filesystem::temp_directory_path() / "NovelRTDecodeWorkerPoolTest_missing.png").string());
+
+  ASSERT_TRUE(waitForResult(pool, result));
+  EXPECT_FALSE(result.isSuccessful);
+  EXPECT_EQ(7u, result.requestId);
+  EXPECT_TRUE(result.image.pixels.empty());
+}
+
+TEST(ImageDecodeWorkerPoolTest, resultsLargerThanTheByteLimitAreLeftQueued) {
+  auto file = writeTestImage("NovelRTDecodeWorkerPoolTest_large.png", 16, 16, 255);
+  ImageDecodeWorkerPool pool(1);
+  ImageDecodeWorkerPool::Result result;
+
+  pool.request(1, file);
+  for (int32_t i = 0; i < 500 && pool.getResultBytes() == 0; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  EXPECT_EQ(16u * 16u * RgbaImage::BytesPerPixel, pool.getResultBytes());
+  EXPECT_FALSE(pool.tryTakeResult(result, 100));
+  EXPECT_TRUE(pool.tryTakeResult(result, 16 * 16 * RgbaImage::BytesPerPixel));
+  EXPECT_EQ(0u, pool.getResultBytes());
+}
+
+TEST(ImageDecodeWorkerPoolTest, recycledBuffersAreReusedForLaterDecodes) {
+  auto file = writeTestImage("NovelRTDecodeWorkerPoolTest_recycle.png", 8, 8, 64);
+  ImageDecodeWorkerPool pool(1);
+  ImageDecodeWorkerPool::Result result;
+
+  RgbaImage recycled(64, 64);
+  auto recycledPixels = recycled.pixels.data();
+  pool.recycle(std::move(recycled));
+
+  pool.request(1, file);
+  ASSERT_TRUE(waitForResult(pool, result));
+  EXPECT_EQ(recycledPixels, result.image.pixels.data());
+  EXPECT_EQ(8u * 8u * RgbaImage::BytesPerPixel, result.image.pixels.size());
+}
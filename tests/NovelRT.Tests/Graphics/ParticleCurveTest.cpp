@@ -0,0 +1,33 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+using namespace NovelRT::Maths;
+
+TEST(ParticleCurveTest, singleKeyIsConstant) {
+  auto curve = ParticleCurve<float>(3.0f);
+
+  EXPECT_EQ(3.0f, curve.evaluate(0.0f));
+  EXPECT_EQ(3.0f, curve.evaluate(0.5f));
+  EXPECT_EQ(3.0f, curve.evaluate(1.0f));
+}
+
+TEST(ParticleCurveTest, valuesBetweenKeysAreInterpolated) {
+  auto curve = ParticleCurve<GeoVector2F>({ { 0.0f, GeoVector2F(0.0f, 10.0f) }, { 0.5f, GeoVector2F(10.0f, 0.0f) } });
+
+  EXPECT_EQ(GeoVector2F(5.0f, 5.0f), curve.evaluate(0.25f));
+  EXPECT_EQ(GeoVector2F(10.0f, 0.0f), curve.evaluate(0.75f));
+}
+
+TEST(ParticleCurveTest, keysAreSortedAndClampedAsTheyAreAdded) {
+  auto curve = ParticleCurve<float>({ { 2.0f, 1.0f }, { 0.5f, 0.5f }, { -1.0f, 0.0f } });
+
+  ASSERT_EQ(3u, curve.getKeys().size());
+  EXPECT_EQ(0.0f, curve.getKeys()[0].time);
+  EXPECT_EQ(0.5f, curve.getKeys()[1].time);
+  EXPECT_EQ(1.0f, curve.getKeys()[2].time);
+  EXPECT_FLOAT_EQ(0.75f, curve.evaluate(0.75f));
+}
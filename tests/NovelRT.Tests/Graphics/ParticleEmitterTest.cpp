@@ -0,0 +1,159 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+using namespace NovelRT::Maths;
+
+class ParticleEmitterTest : public testing::Test {
+protected:
+  ParticleEmitterSettings _settings;
+
+  static std::vector<SpriteInstanceData> getInstances(const ParticleEmitter& emitter, float depth = 0.0f) {
+    auto instances = std::vector<SpriteInstanceData>(emitter.getParticleCount());
+    emitter.writeInstances(instances.data(), depth);
+    return instances;
+  }
+};
+
+TEST_F(ParticleEmitterTest, emitsAtItsRateAndCarriesTheRemainderOver) {
+  auto emitter = ParticleEmitter(nullptr, _settings);
+
+  emitter.update(0.25f, GeoVector2F::zero());
+  EXPECT_EQ(2u, emitter.getParticleCount());
+
+  emitter.update(0.25f, GeoVector2F::zero());
+  EXPECT_EQ(5u, emitter.getParticleCount());
+
+  emitter.setEmitting(false);
+  emitter.update(0.25f, GeoVector2F::zero());
+  EXPECT_EQ(5u, emitter.getParticleCount());
+}
+
+TEST_F(ParticleEmitterTest, burstIsLimitedToMaxParticles) {
+  _settings.maxParticles = 100;
+  auto emitter = ParticleEmitter(nullptr, _settings);
+
+  emitter.burst(150, GeoVector2F::zero());
+  EXPECT_EQ(100u, emitter.getParticleCount());
+
+  _settings.maxParticles = 10;
+  emitter.setSettings(_settings);
+  EXPECT_EQ(10u, emitter.getParticleCount());
+}
+
+TEST_F(ParticleEmitterTest, particlesDieAtTheEndOfTheirLifetime) {
+  _settings.minLifetime = 0.5f;
+  _settings.maxLifetime = 1.5f;
+  auto emitter = ParticleEmitter(nullptr, _settings);
+  emitter.setEmitting(false);
+  emitter.burst(50, GeoVector2F::zero());
+
+  emitter.update(0.4f, GeoVector2F::zero());
+  EXPECT_EQ(50u, emitter.getParticleCount());
+
+  emitter.update(0.6f, GeoVector2F::zero());
+  EXPECT_GT(50u, emitter.getParticleCount());
+
+  emitter.update(0.5f, GeoVector2F::zero());
+  EXPECT_EQ(0u, emitter.getParticleCount());
+}
+
+TEST_F(ParticleEmitterTest, everyParticleMovesWithItsVelocityAndTheAcceleration) {
+  //An odd count leaves some particles for the scalar tail after the vectorised part of the kernel.
+  _settings.minVelocity = GeoVector2F(100.0f, 0.0f);
+  _settings.maxVelocity = GeoVector2F(100.0f, 0.0f);
+  _settings.acceleration = GeoVector2F(0.0f, 50.0f);
+  _settings.maxLifetime = 10.0f;
+  auto emitter = ParticleEmitter(nullptr, _settings);
+  emitter.setEmitting(false);
+  emitter.burst(37, GeoVector2F(20.0f, 30.0f));
+
+  emitter.update(0.1f, GeoVector2F::zero());
+
+  auto instances = getInstances(emitter, 4.0f);
+  ASSERT_EQ(37u, instances.size());
+  for (const auto& instance : instances) {
+    EXPECT_FLOAT_EQ(30.0f, instance.transform.w.x);
+    EXPECT_FLOAT_EQ(30.5f, instance.transform.w.y);
+    EXPECT_EQ(4.0f, instance.transform.w.z);
+  }
+}
+
+TEST_F(ParticleEmitterTest, speedCurveScalesHowFarParticlesMove) {
+  _settings.minVelocity = GeoVector2F(100.0f, 0.0f);
+  _settings.maxVelocity = GeoVector2F(100.0f, 0.0f);
+  _settings.speedOverLifetime = ParticleCurve<float>(0.0f);
+  auto emitter = ParticleEmitter(nullptr, _settings);
+  emitter.setEmitting(false);
+  emitter.burst(9, GeoVector2F::zero());
+
+  emitter.update(0.5f, GeoVector2F::zero());
+
+  for (const auto& instance : getInstances(emitter)) {
+    EXPECT_EQ(0.0f, instance.transform.w.x);
+  }
+}
+
+TEST_F(ParticleEmitterTest, instancesTakeTheirSizeAndColourFromTheirAge) {
+  _settings.minRotation = 90.0f;
+  _settings.maxRotation = 90.0f;
+  _settings.sizeOverLifetime = ParticleCurve<GeoVector2F>(GeoVector2F(8.0f, 4.0f));
+  _settings.colourOverLifetime = ParticleCurve<GeoVector4F>({ { 0.0f, GeoVector4F(1.0f, 0.0f, 0.0f, 1.0f) }, { 1.0f, GeoVector4F(0.0f, 0.0f, 1.0f, 0.0f) } });
+  _settings.uvRect = GeoVector4F(0.5f, 0.0f, 0.5f, 1.0f);
+  auto emitter = ParticleEmitter(nullptr, _settings);
+  emitter.setEmitting(false);
+  emitter.burst(1, GeoVector2F::zero());
+
+  emitter.update(0.5f, GeoVector2F::zero());
+
+  auto instances = getInstances(emitter);
+  ASSERT_EQ(1u, instances.size());
+  EXPECT_NEAR(0.0f, instances[0].transform.x.x, 0.0001f);
+  EXPECT_NEAR(8.0f, instances[0].transform.x.y, 0.0001f);
+  EXPECT_NEAR(-4.0f, instances[0].transform.y.x, 0.0001f);
+  EXPECT_NEAR(0.0f, instances[0].transform.y.y, 0.0001f);
+  EXPECT_NEAR(0.5f, instances[0].colourTint.x, 0.01f);
+  EXPECT_NEAR(0.5f, instances[0].colourTint.z, 0.01f);
+  EXPECT_NEAR(0.5f, instances[0].colourTint.w, 0.01f);
+  EXPECT_EQ(_settings.uvRect, instances[0].uvRect);
+}
+
+TEST_F(ParticleEmitterTest, boundsContainEveryParticleAtAnyRotation) {
+  _settings.spawnAreaSize = GeoVector2F(200.0f, 100.0f);
+  _settings.minVelocity = GeoVector2F(-50.0f, -50.0f);
+  _settings.maxVelocity = GeoVector2F(50.0f, 50.0f);
+  _settings.minRotation = 0.0f;
+  _settings.maxRotation = 360.0f;
+  _settings.sizeOverLifetime = ParticleCurve<GeoVector2F>(GeoVector2F(10.0f, 10.0f));
+  auto emitter = ParticleEmitter(nullptr, _settings);
+  EXPECT_EQ(GeoBounds(GeoVector2F::zero(), GeoVector2F::zero(), 0.0f), emitter.getBounds());
+
+  emitter.burst(64, GeoVector2F(500.0f, 500.0f));
+  emitter.update(0.3f, GeoVector2F::zero());
+
+  auto bounds = emitter.getBounds();
+  auto extent = std::sqrt(50.0f);
+  for (const auto& instance : getInstances(emitter)) {
+    EXPECT_LE(bounds.position.x - bounds.size.x / 2.0f, instance.transform.w.x - extent);
+    EXPECT_GE(bounds.position.x + bounds.size.x / 2.0f, instance.transform.w.x + extent);
+    EXPECT_LE(bounds.position.y - bounds.size.y / 2.0f, instance.transform.w.y - extent);
+    EXPECT_GE(bounds.position.y + bounds.size.y / 2.0f, instance.transform.w.y + extent);
+  }
+}
+
+TEST_F(ParticleEmitterTest, emittersWithTheSameSeedBehaveTheSame) {
+  _settings.spawnAreaSize = GeoVector2F(100.0f, 100.0f);
+  auto first = ParticleEmitter(nullptr, _settings, 7);
+  auto second = ParticleEmitter(nullptr, _settings, 7);
+  first.burst(20, GeoVector2F::zero());
+  second.burst(20, GeoVector2F::zero());
+
+  auto firstInstances = getInstances(first);
+  auto secondInstances = getInstances(second);
+  for (size_t i = 0; i < firstInstances.size(); i++) {
+    EXPECT_EQ(firstInstances[i].transform.w, secondInstances[i].transform.w);
+  }
+}
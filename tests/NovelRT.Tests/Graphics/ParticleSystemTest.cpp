@@ -0,0 +1,48 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+using namespace NovelRT::Maths;
+
+class ParticleSystemTest : public testing::Test {
+protected:
+  std::unique_ptr<ParticleSystem> _system;
+
+  void SetUp() override {
+    auto transform = Transform(GeoVector2F(100.0f, 200.0f), 0.0f, GeoVector2F(1.0f, 1.0f));
+    _system = std::make_unique<ParticleSystem>(transform, 0, ShaderProgram(), nullptr, nullptr);
+  }
+};
+
+TEST_F(ParticleSystemTest, emittersAreOffsetFromTheSystemPosition) {
+  ParticleEmitterSettings settings;
+  settings.offset = GeoVector2F(10.0f, 0.0f);
+  settings.sizeOverLifetime = ParticleCurve<GeoVector2F>(GeoVector2F::zero());
+  auto& emitter = _system->addEmitter(nullptr, settings);
+
+  _system->update(Timing::Timestamp::fromSeconds(0.5));
+
+  ASSERT_EQ(5u, _system->getParticleCount());
+  EXPECT_EQ(GeoBounds(GeoVector2F(110.0f, 200.0f), GeoVector2F::zero(), 0.0f), emitter.getBounds());
+}
+
+TEST_F(ParticleSystemTest, systemIsAliveUntilItsLastParticleDies) {
+  ParticleEmitterSettings settings;
+  _system->addEmitter(nullptr, settings);
+  _system->addEmitter(nullptr, settings);
+
+  _system->update(Timing::Timestamp::fromSeconds(0.5));
+  EXPECT_EQ(10u, _system->getParticleCount());
+
+  for (const auto& emitter : _system->getEmitters()) {
+    emitter->setEmitting(false);
+  }
+
+  EXPECT_TRUE(_system->isAlive());
+  _system->update(Timing::Timestamp::fromSeconds(1.0));
+  EXPECT_EQ(0u, _system->getParticleCount());
+  EXPECT_FALSE(_system->isAlive());
+}
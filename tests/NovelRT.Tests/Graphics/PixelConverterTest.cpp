@@ -0,0 +1,163 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+
+//Odd sizes, so that every conversion runs its SIMD loop several times and still leaves a tail for the scalar loop.
+static const size_t TestPixelCount = 77;
+
+static std::vector<uint8_t> createSourceBytes(size_t byteCount) {
+  std::vector<uint8_t> bytes(byteCount);
+  for (size_t i = 0; i < byteCount; i++) {
+    bytes[i] = static_cast<uint8_t>(i * 37 + 11);
+  }
+
+  return bytes;
+}
+
+TEST(PixelConverterTest, rgbToRgbaCopiesColourAndMakesEveryPixelOpaque) {
+  auto source = createSourceBytes(TestPixelCount * 3);
+  std::vector<uint8_t> destination(TestPixelCount * 4);
+
+  PixelConverter::rgbToRgba(source.data(), destination.data(), TestPixelCount);
+
+  for (size_t i = 0; i < TestPixelCount; i++) {
+    EXPECT_EQ(source[i * 3], destination[i * 4]);
+    EXPECT_EQ(source[i * 3 + 1], destination[i * 4 + 1]);
+    EXPECT_EQ(source[i * 3 + 2], destination[i * 4 + 2]);
+    EXPECT_EQ(255, destination[i * 4 + 3]);
+  }
+}
+
+TEST(PixelConverterTest, grayToRgbaCopiesGreyIntoEveryColourChannel) {
+  auto source = createSourceBytes(TestPixelCount);
+  std::vector<uint8_t> destination(TestPixelCount * 4);
+
+  PixelConverter::grayToRgba(source.data(), destination.data(), TestPixelCount);
+
+  for (size_t i = 0; i < TestPixelCount; i++) {
+    EXPECT_EQ(source[i], destination[i * 4]);
+    EXPECT_EQ(source[i], destination[i * 4 + 1]);
+    EXPECT_EQ(source[i], destination[i * 4 + 2]);
+    EXPECT_EQ(255, destination[i * 4 + 3]);
+  }
+}
+
+TEST(PixelConverterTest, grayAlphaToRgbaKeepsAlpha) {
+  auto source = createSourceBytes(TestPixelCount * 2);
+  std::vector<uint8_t> destination(TestPixelCount * 4);
+
+  PixelConverter::grayAlphaToRgba(source.data(), destination.data(), TestPixelCount);
+
+  for (size_t i = 0; i < TestPixelCount; i++) {
+    EXPECT_EQ(source[i * 2], destination[i * 4]);
+    EXPECT_EQ(source[i * 2], destination[i * 4 + 1]);
+    EXPECT_EQ(source[i * 2], destination[i * 4 + 2]);
+    EXPECT_EQ(source[i * 2 + 1], destination[i * 4 + 3]);
+  }
+}
+
+TEST(PixelConverterTest, expansionsWorkInPlaceWhenTheSourceEndsTheBuffer) {
+  for (size_t channels = 1; channels <= 3; channels++) {
+    auto source = createSourceBytes(TestPixelCount * channels);
+    std::vector<uint8_t> expected(TestPixelCount * 4);
+    std::vector<uint8_t> buffer(TestPixelCount * 4);
+    auto packedSource = buffer.data() + buffer.size() - source.size();
+    std::memcpy(packedSource, source.data(), source.size());
+
+    if (channels == 1) {
+      PixelConverter::grayToRgba(source.data(), expected.data(), TestPixelCount);
+      PixelConverter::grayToRgba(packedSource, buffer.data(), TestPixelCount);
+    }
+    else if (channels == 2) {
+      PixelConverter::grayAlphaToRgba(source.data(), expected.data(), TestPixelCount);
+      PixelConverter::grayAlphaToRgba(packedSource, buffer.data(), TestPixelCount);
+    }
+    else {
+      PixelConverter::rgbToRgba(source.data(), expected.data(), TestPixelCount);
+      PixelConverter::rgbToRgba(packedSource, buffer.data(), TestPixelCount);
+    }
+
+    EXPECT_EQ(expected, buffer) << channels << " channels";
+  }
+}
+
+TEST(PixelConverterTest, premultiplyAlphaRoundsEveryColourAndAlphaExactly) {
+  std::vector<uint8_t> pixels(256 * 256 * 4);
+  for (size_t alpha = 0; alpha < 256; alpha++) {
+    for (size_t colour = 0; colour < 256; colour++) {
+      auto pixel = pixels.data() + (alpha * 256 + colour) * 4;
+      pixel[0] = static_cast<uint8_t>(colour);
+      pixel[1] = static_cast<uint8_t>(255 - colour);
+      pixel[2] = static_cast<uint8_t>(colour / 2);
+      pixel[3] = static_cast<uint8_t>(alpha);
+    }
+  }
+
+  PixelConverter::premultiplyAlpha(pixels.data(), 256 * 256);
+
+  for (size_t alpha = 0; alpha < 256; alpha++) {
+    for (size_t colour = 0; colour < 256; colour++) {
+      auto pixel = pixels.data() + (alpha * 256 + colour) * 4;
+      ASSERT_EQ(std::lround(colour * alpha / 255.0), pixel[0]) << colour << " * " << alpha;
+      ASSERT_EQ(std::lround((255 - colour) * alpha / 255.0), pixel[1]) << (255 - colour) << " * " << alpha;
+      ASSERT_EQ(std::lround((colour / 2) * alpha / 255.0), pixel[2]) << (colour / 2) << " * " << alpha;
+      ASSERT_EQ(static_cast<uint8_t>(alpha), pixel[3]);
+    }
+  }
+}
+
+TEST(PixelConverterTest, swizzleSwapsRedAndBlue) {
+  auto pixels = createSourceBytes(TestPixelCount * 4);
+  auto original = pixels;
+
+  PixelConverter::swizzle(pixels.data(), TestPixelCount, { 2, 1, 0, 3 });
+
+  for (size_t i = 0; i < TestPixelCount; i++) {
+    EXPECT_EQ(original[i * 4 + 2], pixels[i * 4]);
+    EXPECT_EQ(original[i * 4 + 1], pixels[i * 4 + 1]);
+    EXPECT_EQ(original[i * 4], pixels[i * 4 + 2]);
+    EXPECT_EQ(original[i * 4 + 3], pixels[i * 4 + 3]);
+  }
+}
+
+TEST(PixelConverterTest, swizzleAppliesAnyChannelOrder) {
+  auto pixels = createSourceBytes(TestPixelCount * 4);
+  auto original = pixels;
+
+  PixelConverter::swizzle(pixels.data(), TestPixelCount, { 3, 3, 1, 0 });
+
+  for (size_t i = 0; i < TestPixelCount; i++) {
+    EXPECT_EQ(original[i * 4 + 3], pixels[i * 4]);
+    EXPECT_EQ(original[i * 4 + 3], pixels[i * 4 + 1]);
+    EXPECT_EQ(original[i * 4 + 1], pixels[i * 4 + 2]);
+    EXPECT_EQ(original[i * 4], pixels[i * 4 + 3]);
+  }
+}
+
+TEST(PixelConverterTest, classifyAlphaFindsOpaqueCutoutAndTranslucentImages) {
+  auto pixels = createSourceBytes(TestPixelCount * 4);
+  for (size_t i = 0; i < TestPixelCount; i++) {
+    pixels[i * 4 + 3] = 255;
+  }
+
+  EXPECT_EQ(TextureAlphaMode::Opaque, PixelConverter::classifyAlpha(pixels.data(), TestPixelCount));
+
+  //The last pixel is only ever seen by the scalar tail, and the first only by the SIMD loop.
+  pixels[(TestPixelCount - 1) * 4 + 3] = 0;
+  EXPECT_EQ(TextureAlphaMode::Cutout, PixelConverter::classifyAlpha(pixels.data(), TestPixelCount));
+
+  pixels[(TestPixelCount - 1) * 4 + 3] = 255;
+  pixels[3] = 0;
+  EXPECT_EQ(TextureAlphaMode::Cutout, PixelConverter::classifyAlpha(pixels.data(), TestPixelCount));
+
+  pixels[TestPixelCount / 2 * 4 + 3] = 1;
+  EXPECT_EQ(TextureAlphaMode::Translucent, PixelConverter::classifyAlpha(pixels.data(), TestPixelCount));
+
+  pixels[TestPixelCount / 2 * 4 + 3] = 255;
+  pixels[(TestPixelCount - 1) * 4 + 3] = 254;
+  EXPECT_EQ(TextureAlphaMode::Translucent, PixelConverter::classifyAlpha(pixels.data(), TestPixelCount));
+}
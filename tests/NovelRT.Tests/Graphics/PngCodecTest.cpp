@@ -0,0 +1,148 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+
+namespace {
+  //PngCodec only ever writes RGBA, so the other layouts it has to read are written straight through libpng.
+  std::string writePng(const std::string& name, uint32_t width, uint32_t height, int32_t colourType, int32_t bitDepth,
+    const std::vector<uint8_t>& rows, int32_t interlaceType = PNG_INTERLACE_NONE,
+    const std::vector<png_color>& palette = {}, const std::vector<png_byte>& paletteAlpha = {}) {
+    auto file = (std::filesystem::temp_directory_path() / name).string();
+    auto cFile = fopen(file.c_str(), "wb");
+    auto png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+    auto info = png_create_info_struct(png);
+
+    auto rowBytes = rows.size() / height;
+    std::vector<png_bytep> rowPointers(height);
+    for (uint32_t y = 0; y < height; y++) {
+      rowPointers[y] = const_cast<png_bytep>(rows.data() + y * rowBytes);
+    }
+
+    png_init_io(png, cFile);
+    png_set_IHDR(png, info, width, height, bitDepth, colourType, interlaceType, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    if (!palette.empty()) {
+      png_set_PLTE(png, info, palette.data(), static_cast<int>(palette.size()));
+    }
+
+    if (!paletteAlpha.empty()) {
+      png_set_tRNS(png, info, paletteAlpha.data(), static_cast<int>(paletteAlpha.size()), nullptr);
+    }
+
+    png_write_info(png, info);
+    png_write_image(png, rowPointers.data());
+    png_write_end(png, nullptr);
+    png_destroy_write_struct(&png, &info);
+    fclose(cFile);
+    return file;
+  }
+
+  void expectPixel(const RgbaImage& image, uint32_t x, uint32_t y, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    auto pixel = image.getPixel(x, y);
+    EXPECT_EQ(r, pixel[0]) << x << ", " << y;
+    EXPECT_EQ(g, pixel[1]) << x << ", " << y;
+    EXPECT_EQ(b, pixel[2]) << x << ", " << y;
+    EXPECT_EQ(a, pixel[3]) << x << ", " << y;
+  }
+}
+
+TEST(PngCodecTest, rgbaFilesRoundTrip) {
+  RgbaImage image(19, 7);
+  for (size_t i = 0; i < image.pixels.size(); i++) {
+    image.pixels[i] = static_cast<uint8_t>(i * 13);
+  }
+
+  auto file = (std::filesystem::temp_directory_path() / "NovelRTPngCodecTest_rgba.png").string();
+  PngCodec::encodeFile(file, image);
+  auto decoded = PngCodec::decodeFile(file);
+
+  EXPECT_EQ(19u, decoded.width);
+  EXPECT_EQ(7u, decoded.height);
+  EXPECT_EQ(image.pixels, decoded.pixels);
+}
+
+TEST(PngCodecTest, rgbFilesDecodeAsOpaqueRgba) {
+  std::vector<uint8_t> rows;
+  for (uint32_t i = 0; i < 21 * 5; i++) {
+    rows.insert(rows.end(), { static_cast<uint8_t>(i), static_cast<uint8_t>(i * 2), static_cast<uint8_t>(255 - i) });
+  }
+
+  auto image = PngCodec::decodeFile(writePng("NovelRTPngCodecTest_rgb.png", 21, 5, PNG_COLOR_TYPE_RGB, 8, rows));
+
+  ASSERT_EQ(21u * 5u * 4u, image.pixels.size());
+  for (uint32_t i = 0; i < 21 * 5; i++) {
+    expectPixel(image, i % 21, i / 21, static_cast<uint8_t>(i), static_cast<uint8_t>(i * 2), static_cast<uint8_t>(255 - i), 255);
+  }
+}
+
+TEST(PngCodecTest, greyFilesDecodeWithGreyInEveryChannel) {
+  std::vector<uint8_t> rows;
+  for (uint32_t i = 0; i < 33 * 3; i++) {
+    rows.push_back(static_cast<uint8_t>(i * 7));
+  }
+
+  auto image = PngCodec::decodeFile(writePng("NovelRTPngCodecTest_grey.png", 33, 3, PNG_COLOR_TYPE_GRAY, 8, rows));
+
+  for (uint32_t i = 0; i < 33 * 3; i++) {
+    auto grey = static_cast<uint8_t>(i * 7);
+    expectPixel(image, i % 33, i / 33, grey, grey, grey, 255);
+  }
+}
+
+TEST(PngCodecTest, greyAlphaFilesKeepTheirAlpha) {
+  std::vector<uint8_t> rows;
+  for (uint32_t i = 0; i < 17 * 4; i++) {
+    rows.insert(rows.end(), { static_cast<uint8_t>(i * 3), static_cast<uint8_t>(i) });
+  }
+
+  auto image = PngCodec::decodeFile(writePng("NovelRTPngCodecTest_greyAlpha.png", 17, 4, PNG_COLOR_TYPE_GRAY_ALPHA, 8, rows));
+
+  for (uint32_t i = 0; i < 17 * 4; i++) {
+    auto grey = static_cast<uint8_t>(i * 3);
+    expectPixel(image, i % 17, i / 17, grey, grey, grey, static_cast<uint8_t>(i));
+  }
+}
+
+TEST(PngCodecTest, palettedFilesUseTheirTransparency) {
+  std::vector<png_color> palette = { { 255, 0, 0 }, { 0, 255, 0 }, { 0, 0, 255 } };
+  std::vector<png_byte> paletteAlpha = { 255, 128, 0 };
+  std::vector<uint8_t> rows = { 0, 1, 2, 2, 1, 0 };
+
+  auto image = PngCodec::decodeFile(writePng("NovelRTPngCodecTest_palette.png", 3, 2, PNG_COLOR_TYPE_PALETTE, 8, rows,
+    PNG_INTERLACE_NONE, palette, paletteAlpha));
+
+  expectPixel(image, 0, 0, 255, 0, 0, 255);
+  expectPixel(image, 1, 0, 0, 255, 0, 128);
+  expectPixel(image, 2, 0, 0, 0, 255, 0);
+  expectPixel(image, 0, 1, 0, 0, 255, 0);
+}
+
+TEST(PngCodecTest, sixteenBitAndInterlacedFilesAreStrippedToEightBits) {
+  //Big endian 16 bit samples. Only the high byte survives.
+  std::vector<uint8_t> rows;
+  for (uint32_t i = 0; i < 9 * 9; i++) {
+    rows.insert(rows.end(), { static_cast<uint8_t>(i), 0xFF, static_cast<uint8_t>(i * 2), 0x00, 0x40, 0x80 });
+  }
+
+  auto image = PngCodec::decodeFile(writePng("NovelRTPngCodecTest_sixteenBit.png", 9, 9, PNG_COLOR_TYPE_RGB, 16, rows, PNG_INTERLACE_ADAM7));
+
+  for (uint32_t i = 0; i < 9 * 9; i++) {
+    expectPixel(image, i % 9, i / 9, static_cast<uint8_t>(i), static_cast<uint8_t>(i * 2), 0x40, 255);
+  }
+}
+
+TEST(PngCodecTest, oneBitGreyFilesExpandToFullRange) {
+  std::vector<uint8_t> rows = { 0xA0, 0x50 };
+
+  auto image = PngCodec::decodeFile(writePng("NovelRTPngCodecTest_oneBit.png", 4, 2, PNG_COLOR_TYPE_GRAY, 1, rows));
+
+  expectPixel(image, 0, 0, 255, 255, 255, 255);
+  expectPixel(image, 1, 0, 0, 0, 0, 255);
+  expectPixel(image, 2, 0, 255, 255, 255, 255);
+  expectPixel(image, 1, 1, 255, 255, 255, 255);
+  expectPixel(image, 3, 1, 255, 255, 255, 255);
+  expectPixel(image, 0, 1, 0, 0, 0, 255);
+}
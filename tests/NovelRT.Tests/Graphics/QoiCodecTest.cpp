@@ -0,0 +1,141 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+
+namespace {
+  //Every kind of chunk, written out by hand from the specification rather than by the encoder under test.
+  const std::vector<uint8_t> HandWrittenQoiFile = {
+    'q', 'o', 'i', 'f', 0, 0, 0, 3, 0, 0, 0, 2, 4, 0,
+    0xFE, 10, 20, 30,         //RGB (10, 20, 30)
+    0x76,                     //DIFF +1, -1, 0
+    0xC0,                     //RUN of 1
+    0x09,                     //INDEX of (10, 20, 30, 255)
+    0xAA, 0xB6,               //LUMA green +10, red +13, blue +8
+    0xFF, 1, 2, 3, 4,         //RGBA (1, 2, 3, 4)
+    0, 0, 0, 0, 0, 0, 0, 1
+  };
+
+  RgbaImage createTestImage(uint32_t width, uint32_t height) {
+    //A mix of flat areas, gentle gradients, noise and changing alpha, so that the encoder uses every kind of chunk.
+    RgbaImage image(width, height);
+    uint32_t noise = 12345;
+    for (uint32_t y = 0; y < height; y++) {
+      for (uint32_t x = 0; x < width; x++) {
+        auto pixel = image.getPixel(x, y);
+        noise = noise * 1103515245u + 12345u;
+
+        if (y < height / 4) {
+          pixel[0] = 200;
+          pixel[1] = 100;
+          pixel[2] = 50;
+          pixel[3] = 255;
+        }
+        else if (y < height / 2) {
+          pixel[0] = static_cast<uint8_t>(x * 2);
+          pixel[1] = static_cast<uint8_t>(x * 3 + y);
+          pixel[2] = static_cast<uint8_t>(y);
+          pixel[3] = 255;
+        }
+        else {
+          pixel[0] = static_cast<uint8_t>(noise >> 24);
+          pixel[1] = static_cast<uint8_t>(noise >> 16);
+          pixel[2] = static_cast<uint8_t>((x % 3) * 40);
+          pixel[3] = static_cast<uint8_t>((x / 8) % 2 == 0 ? 255 : noise >> 8);
+        }
+      }
+    }
+
+    return image;
+  }
+}
+
+TEST(QoiCodecTest, decodesEveryKindOfChunk) {
+  uint32_t width = 0;
+  uint32_t height = 0;
+  ASSERT_TRUE(QoiCodec::tryReadHeader(HandWrittenQoiFile.data(), HandWrittenQoiFile.size(), width, height));
+  EXPECT_EQ(3u, width);
+  EXPECT_EQ(2u, height);
+
+  std::vector<uint8_t> pixels(width * height * 4);
+  ASSERT_TRUE(QoiCodec::tryDecode(HandWrittenQoiFile.data(), HandWrittenQoiFile.size(), pixels.data()));
+
+  std::vector<uint8_t> expected = {
+    10, 20, 30, 255,  11, 19, 30, 255,  11, 19, 30, 255,
+    10, 20, 30, 255,  23, 30, 38, 255,  1, 2, 3, 4
+  };
+  EXPECT_EQ(expected, pixels);
+}
+
+TEST(QoiCodecTest, encodedImagesDecodeToTheSamePixels) {
+  auto image = createTestImage(67, 41);
+
+  auto bytes = QoiCodec::encode(image);
+  std::vector<uint8_t> pixels(image.pixels.size());
+
+  ASSERT_TRUE(QoiCodec::tryDecode(bytes.data(), bytes.size(), pixels.data()));
+  EXPECT_EQ(image.pixels, pixels);
+  EXPECT_LT(bytes.size(), image.pixels.size());
+}
+
+TEST(QoiCodecTest, longRunsAreSplitAndStillDecode) {
+  RgbaImage image(300, 2);
+  std::fill(image.pixels.begin(), image.pixels.end(), static_cast<uint8_t>(77));
+
+  auto bytes = QoiCodec::encode(image);
+  RgbaImage decoded(300, 2);
+
+  ASSERT_TRUE(QoiCodec::tryDecode(bytes.data(), bytes.size(), decoded.pixels.data()));
+  EXPECT_EQ(image.pixels, decoded.pixels);
+}
+
+TEST(QoiCodecTest, truncatedDataIsRejected) {
+  auto image = createTestImage(16, 16);
+  auto bytes = QoiCodec::encode(image);
+  bytes.erase(bytes.begin() + static_cast<std::ptrdiff_t>(bytes.size() / 2), bytes.end() - 8);
+  std::vector<uint8_t> pixels(image.pixels.size());
+
+  EXPECT_FALSE(QoiCodec::tryDecode(bytes.data(), bytes.size(), pixels.data()));
+}
+
+TEST(QoiCodecTest, invalidHeadersAreRejected) {
+  uint32_t width = 0;
+  uint32_t height = 0;
+
+  auto wrongMagic = HandWrittenQoiFile;
+  wrongMagic[0] = 'p';
+  EXPECT_FALSE(QoiCodec::tryReadHeader(wrongMagic.data(), wrongMagic.size(), width, height));
+
+  auto zeroWidth = HandWrittenQoiFile;
+  zeroWidth[7] = 0;
+  EXPECT_FALSE(QoiCodec::tryReadHeader(zeroWidth.data(), zeroWidth.size(), width, height));
+
+  //Far more pixels than the chunk data could ever describe.
+  auto tooLarge = HandWrittenQoiFile;
+  tooLarge[5] = 0x10;
+  EXPECT_FALSE(QoiCodec::tryReadHeader(tooLarge.data(), tooLarge.size(), width, height));
+
+  EXPECT_FALSE(QoiCodec::tryReadHeader(HandWrittenQoiFile.data(), QoiCodec::HeaderSize, width, height));
+}
+
+TEST(QoiCodecTest, filesRoundTripIntoAReusedImage) {
+  auto image = createTestImage(20, 10);
+  auto file = (std::filesystem::temp_directory_path() / "NovelRTQoiCodecTest_roundTrip.qoi").string();
+  QoiCodec::encodeFile(file, image);
+
+  RgbaImage decoded(64, 64);
+  QoiCodec::decodeFile(file, decoded);
+
+  EXPECT_EQ(20u, decoded.width);
+  EXPECT_EQ(10u, decoded.height);
+  EXPECT_EQ(image.pixels, decoded.pixels);
+  EXPECT_TRUE(QoiCodec::isQoiFile(file));
+  EXPECT_FALSE(QoiCodec::isQoiFile("sprite.png"));
+}
+
+TEST(QoiCodecTest, encodingAnEmptyImageThrows) {
+  EXPECT_THROW(QoiCodec::encode(RgbaImage()), Exceptions::InvalidOperationException);
+}
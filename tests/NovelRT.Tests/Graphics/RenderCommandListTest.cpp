@@ -0,0 +1,81 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+
+class RenderCommandListTest : public testing::Test {
+protected:
+  std::shared_ptr<RenderingService> _renderer;
+  std::shared_ptr<Texture> _firstTexture;
+  std::shared_ptr<Texture> _secondTexture;
+  RenderCommandList _commands;
+
+  void SetUp() override {
+    _renderer = std::make_shared<RenderingService>(std::make_shared<Windowing::WindowingService>());
+    _firstTexture = _renderer->getTexture();
+    _secondTexture = _renderer->getTexture();
+  }
+};
+
+TEST_F(RenderCommandListTest, consecutiveSpritesWithTheSameStateAreMerged) {
+  _commands.addSprite(1, _firstTexture).uvRect = Maths::GeoVector4F(0.0f, 0.0f, 1.0f, 1.0f);
+  _commands.addSprite(1, _firstTexture).uvRect = Maths::GeoVector4F(1.0f, 0.0f, 1.0f, 1.0f);
+  _commands.addSprite(1, _secondTexture);
+  _commands.addSprite(2, _secondTexture);
+
+  ASSERT_EQ(3u, _commands.getCommands().size());
+  EXPECT_EQ(RenderCommandType::DrawSprites, _commands.getCommands()[0].type);
+  EXPECT_EQ(0u, _commands.getCommands()[0].first);
+  EXPECT_EQ(2u, _commands.getCommands()[0].count);
+  EXPECT_EQ(2u, _commands.getCommands()[1].first);
+  EXPECT_EQ(1u, _commands.getCommands()[1].count);
+  EXPECT_EQ(2u, _commands.getCommands()[2].shaderProgramId);
+  EXPECT_EQ(4u, _commands.getSpriteInstances().size());
+  EXPECT_EQ(1.0f, _commands.getSpriteInstances()[1].uvRect.x);
+}
+
+TEST_F(RenderCommandListTest, consecutiveShapesWithTheSameProgramAreMerged) {
+  _commands.addShapeVertices(1, 6);
+  _commands.addShapeVertices(1, 3);
+  _commands.addShapeVertices(2, 3);
+
+  ASSERT_EQ(2u, _commands.getCommands().size());
+  EXPECT_EQ(RenderCommandType::DrawShapes, _commands.getCommands()[0].type);
+  EXPECT_EQ(9u, _commands.getCommands()[0].count);
+  EXPECT_EQ(9u, _commands.getCommands()[1].first);
+  EXPECT_EQ(3u, _commands.getCommands()[1].count);
+  EXPECT_EQ(12u, _commands.getShapeVertices().size());
+}
+
+TEST_F(RenderCommandListTest, otherCommandsStopMerging) {
+  _commands.addSprite(1, _firstTexture);
+  _commands.addShapeVertices(1, 6);
+  _commands.addSprite(1, _firstTexture);
+  _commands.beginPass(RenderPass::Translucent);
+  _commands.addSprite(1, _firstTexture);
+  _commands.addObject(nullptr);
+
+  ASSERT_EQ(6u, _commands.getCommands().size());
+  EXPECT_EQ(RenderCommandType::DrawSprites, _commands.getCommands()[2].type);
+  EXPECT_EQ(1u, _commands.getCommands()[2].count);
+  EXPECT_EQ(RenderCommandType::BeginPass, _commands.getCommands()[3].type);
+  EXPECT_EQ(RenderPass::Translucent, _commands.getCommands()[3].pass);
+  EXPECT_EQ(2u, _commands.getCommands()[4].first);
+  EXPECT_EQ(RenderCommandType::DrawObject, _commands.getCommands()[5].type);
+}
+
+TEST_F(RenderCommandListTest, clearEmptiesTheListAndReleasesTextures) {
+  _commands.addSprite(1, _firstTexture);
+  _commands.addShapeVertices(1, 6);
+  auto useCount = _firstTexture.use_count();
+
+  _commands.clear();
+
+  EXPECT_TRUE(_commands.getCommands().empty());
+  EXPECT_TRUE(_commands.getSpriteInstances().empty());
+  EXPECT_TRUE(_commands.getShapeVertices().empty());
+  EXPECT_EQ(useCount - 1, _firstTexture.use_count());
+}
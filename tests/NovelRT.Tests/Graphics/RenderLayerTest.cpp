@@ -0,0 +1,66 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+using namespace NovelRT::Maths;
+
+class RenderLayerTest : public testing::Test {
+protected:
+  std::shared_ptr<RenderingService> _renderer;
+
+  void SetUp() override {
+    _renderer = std::make_shared<RenderingService>(std::make_shared<Windowing::WindowingService>());
+  }
+
+  std::unique_ptr<ImageRect> createRect() {
+    return std::make_unique<ImageRect>(Transform(GeoVector2F(100.0f, 100.0f), 0, GeoVector2F(100.0f, 100.0f)), 0, ShaderProgram(), nullptr, _renderer,
+      RGBAConfig(255, 255, 255, 255));
+  }
+};
+
+TEST_F(RenderLayerTest, newLayersAreRetainedAndHaveNotBeenDrawn) {
+  auto layer = _renderer->createRenderLayer(3);
+
+  EXPECT_TRUE(layer->isRetained());
+  EXPECT_EQ(0u, layer->getRebuildCount());
+  EXPECT_EQ(3, layer->layer());
+}
+
+TEST_F(RenderLayerTest, membersOfARetainedLayerAreQueuedInTheLayer) {
+  auto layer = _renderer->createRenderLayer(0);
+  auto rect = createRect();
+  rect->setRenderLayer(layer);
+
+  rect->executeObjectBehaviour();
+
+  EXPECT_EQ(1u, layer->getRenderQueue().getPendingCount());
+  EXPECT_EQ(0u, _renderer->getRenderQueue().getPendingCount());
+}
+
+TEST_F(RenderLayerTest, membersOfALayerThatIsNotRetainedAreQueuedWithEverythingElse) {
+  auto layer = _renderer->createRenderLayer(0);
+  layer->setRetained(false);
+  auto rect = createRect();
+  rect->setRenderLayer(layer);
+
+  rect->executeObjectBehaviour();
+
+  EXPECT_EQ(0u, layer->getRenderQueue().getPendingCount());
+  EXPECT_EQ(1u, _renderer->getRenderQueue().getPendingCount());
+}
+
+TEST_F(RenderLayerTest, objectsLeaveTheirLayerWhenItIsCleared) {
+  auto layer = _renderer->createRenderLayer(0);
+  auto rect = createRect();
+  rect->setRenderLayer(layer);
+  rect->setRenderLayer(nullptr);
+
+  rect->executeObjectBehaviour();
+
+  EXPECT_EQ(nullptr, rect->getRenderLayer());
+  EXPECT_EQ(0u, layer->getRenderQueue().getPendingCount());
+  EXPECT_EQ(1u, _renderer->getRenderQueue().getPendingCount());
+}
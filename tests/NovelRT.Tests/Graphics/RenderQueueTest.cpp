@@ -0,0 +1,334 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+using namespace NovelRT::Maths;
+
+class RenderQueueTest : public testing::Test {
+protected:
+  std::shared_ptr<RenderingService> _renderer;
+
+  void SetUp() override {
+    _renderer = std::make_shared<RenderingService>(std::make_shared<Windowing::WindowingService>());
+  }
+
+  std::unique_ptr<ImageRect> createRect(int32_t layer, GLuint shaderProgramId, RGBAConfig colourTint = RGBAConfig(255, 255, 255, 255),
+    Transform transform = Transform(GeoVector2F::zero(), 0, GeoVector2F::one())) {
+    ShaderProgram program;
+    program.shaderProgramId = shaderProgramId;
+    return std::make_unique<ImageRect>(transform, layer, program, nullptr, _renderer, colourTint);
+  }
+};
+
+TEST(RenderQueueKeyTest, opaqueLayersSortFrontToBack) {
+  EXPECT_LT(RenderQueue::createSortKey(0, false, 1, 1, 0), RenderQueue::createSortKey(10, false, 1, 1, 0));
+  EXPECT_LT(RenderQueue::createSortKey(-10, false, 1, 1, 0), RenderQueue::createSortKey(0, false, 1, 1, 0));
+}
+
+TEST(RenderQueueKeyTest, translucentLayersSortBackToFront) {
+  EXPECT_LT(RenderQueue::createSortKey(10, true, 1, 1, 0), RenderQueue::createSortKey(0, true, 1, 1, 0));
+  EXPECT_LT(RenderQueue::createSortKey(0, true, 1, 1, 0), RenderQueue::createSortKey(-10, true, 1, 1, 0));
+}
+
+TEST(RenderQueueKeyTest, opaqueSortsBeforeTranslucentInTheSameLayer) {
+  EXPECT_LT(RenderQueue::createSortKey(0, false, 2, 2, 5), RenderQueue::createSortKey(0, true, 1, 1, 0));
+}
+
+TEST(RenderQueueKeyTest, translucencyOutweighsLayer) {
+  EXPECT_LT(RenderQueue::createSortKey(1000, false, 1, 1, 0), RenderQueue::createSortKey(-1000, true, 1, 1, 0));
+  EXPECT_LT(RenderQueue::createSortKey(-1000, false, 1, 1, 0), RenderQueue::createSortKey(1000, true, 1, 1, 0));
+}
+
+TEST(RenderQueueKeyTest, stateFieldsRoundTrip) {
+  auto key = RenderQueue::createSortKey(3, true, 7, 42, 9);
+  EXPECT_EQ(7u, RenderQueue::getShaderProgramId(key));
+  EXPECT_EQ(42u, RenderQueue::getTextureId(key));
+  EXPECT_EQ(RenderPass::Translucent, RenderQueue::getRenderPass(key));
+  EXPECT_EQ(RenderPass::Opaque, RenderQueue::getRenderPass(RenderQueue::createSortKey(-3, false, 7, 42, 9)));
+}
+
+TEST(RenderQueueKeyTest, submissionOrderBreaksTies) {
+  EXPECT_LT(RenderQueue::createSortKey(0, false, 1, 1, 0), RenderQueue::createSortKey(0, false, 1, 1, 1));
+}
+
+TEST(RenderQueueKeyTest, sortEntriesMatchesStableSort) {
+  std::vector<RenderQueue::Entry> entries;
+  uint64_t state = 12345;
+  for (uintptr_t i = 0; i < 1000; i++) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    //only a handful of distinct keys, so that the stability of the sort is exercised too.
+    entries.push_back(RenderQueue::Entry{(state >> 60) << 40, reinterpret_cast<RenderObject*>(i + 1)});
+  }
+
+  auto expected = entries;
+  std::stable_sort(expected.begin(), expected.end(), [](auto& left, auto& right) { return left.key < right.key; });
+
+  std::vector<RenderQueue::Entry> scratch;
+  RenderQueue::sortEntries(entries, scratch);
+
+  ASSERT_EQ(expected.size(), entries.size());
+  for (size_t i = 0; i < entries.size(); i++) {
+    EXPECT_EQ(expected[i].key, entries[i].key);
+    EXPECT_EQ(expected[i].object, entries[i].object);
+  }
+}
+
+TEST_F(RenderQueueTest, executeObjectBehaviourQueuesInsteadOfDrawing) {
+  auto rect = createRect(0, 1);
+  rect->executeObjectBehaviour();
+
+  EXPECT_EQ(1u, _renderer->getRenderQueue().getPendingCount());
+
+  _renderer->getRenderQueue().execute();
+  EXPECT_EQ(0u, _renderer->getRenderQueue().getPendingCount());
+  EXPECT_EQ(1u, _renderer->getRenderQueue().getSubmittedCount());
+}
+
+TEST_F(RenderQueueTest, stateChangesAreCountedAfterSorting) {
+  auto first = createRect(0, 1);
+  auto second = createRect(0, 2);
+  auto third = createRect(0, 1);
+  auto fourth = createRect(0, 2);
+
+  first->executeObjectBehaviour();
+  second->executeObjectBehaviour();
+  third->executeObjectBehaviour();
+  fourth->executeObjectBehaviour();
+  _renderer->getRenderQueue().execute();
+
+  EXPECT_EQ(4u, _renderer->getRenderQueue().getSubmittedCount());
+  EXPECT_EQ(1u, _renderer->getRenderQueue().getStateChangeCount());
+}
+
+TEST_F(RenderQueueTest, destroyedObjectsAreNotDrawn) {
+  auto first = createRect(0, 1);
+  auto second = createRect(0, 1);
+
+  first->executeObjectBehaviour();
+  second->executeObjectBehaviour();
+  second.reset();
+  _renderer->getRenderQueue().execute();
+
+  EXPECT_EQ(1u, _renderer->getRenderQueue().getSubmittedCount());
+}
+
+TEST_F(RenderQueueTest, passesStartOnceEachWithOpaqueFirst) {
+  auto translucent = createRect(0, 1, RGBAConfig(255, 255, 255, 128));
+  auto opaque = createRect(5, 1);
+  auto secondOpaque = createRect(3, 1);
+
+  RenderQueue queue;
+  std::vector<RenderPass> passes;
+  queue.PassStarted += [&passes](RenderPass pass) { passes.push_back(pass); };
+
+  queue.submit(translucent.get(), 0, true, 1, 0);
+  queue.submit(opaque.get(), 5, false, 1, 0);
+  queue.submit(secondOpaque.get(), 3, false, 1, 0);
+  queue.execute();
+
+  ASSERT_EQ(2u, passes.size());
+  EXPECT_EQ(RenderPass::Opaque, passes[0]);
+  EXPECT_EQ(RenderPass::Translucent, passes[1]);
+}
+
+TEST_F(RenderQueueTest, emptyPassesAreNotStarted) {
+  auto translucent = createRect(0, 1, RGBAConfig(255, 255, 255, 128));
+
+  RenderQueue queue;
+  std::vector<RenderPass> passes;
+  queue.PassStarted += [&passes](RenderPass pass) { passes.push_back(pass); };
+
+  queue.submit(translucent.get(), 0, true, 1, 0);
+  queue.execute();
+
+  ASSERT_EQ(1u, passes.size());
+  EXPECT_EQ(RenderPass::Translucent, passes[0]);
+}
+
+TEST_F(RenderQueueTest, overdrawIsMeasuredPerPassWithinTheView) {
+  SpatialIndex index;
+  RenderQueue queue;
+
+  //Covers the whole view and then some, a quarter of the view, a quarter of the view and nothing at all.
+  auto background = createRect(10, 1, RGBAConfig(255, 255, 255, 255), Transform(GeoVector2F::zero(), 0, GeoVector2F(200.0f, 200.0f)));
+  auto corner = createRect(5, 1, RGBAConfig(255, 255, 255, 255), Transform(GeoVector2F(50.0f, 50.0f), 0, GeoVector2F(100.0f, 100.0f)));
+  auto overlay = createRect(0, 1, RGBAConfig(255, 255, 255, 128), Transform(GeoVector2F::zero(), 0, GeoVector2F(50.0f, 50.0f)));
+  auto offscreen = createRect(0, 1, RGBAConfig(255, 255, 255, 255), Transform(GeoVector2F(1000.0f, 1000.0f), 0, GeoVector2F(10.0f, 10.0f)));
+
+  for (auto rect : { background.get(), corner.get(), overlay.get(), offscreen.get() }) {
+    index.update(rect, rect->transform().getAABB());
+    queue.submit(rect, rect->layer(), rect == overlay.get(), 1, 0);
+  }
+
+  index.cull(GeoBounds(GeoVector2F::zero(), GeoVector2F(100.0f, 100.0f), 0.0f));
+  queue.execute(&index);
+
+  EXPECT_EQ(3u, queue.getSubmittedCount());
+  EXPECT_EQ(1u, queue.getCulledCount());
+  EXPECT_FLOAT_EQ(1.25f, queue.getOpaqueOverdraw());
+  EXPECT_FLOAT_EQ(0.25f, queue.getTranslucentOverdraw());
+}
+
+TEST_F(RenderQueueTest, identicalSubmissionsMatchTheLastOnes) {
+  auto first = createRect(0, 1);
+  auto second = createRect(1, 2);
+  RenderQueue queue;
+
+  queue.submit(first.get(), 0, false, 1, 0);
+  queue.submit(second.get(), 1, false, 2, 0);
+  EXPECT_FALSE(queue.matchesLastSubmissions());
+  queue.clear();
+
+  queue.submit(first.get(), 0, false, 1, 0);
+  queue.submit(second.get(), 1, false, 2, 0);
+  EXPECT_TRUE(queue.matchesLastSubmissions());
+  queue.execute();
+
+  queue.submit(first.get(), 0, false, 1, 0);
+  EXPECT_FALSE(queue.matchesLastSubmissions());
+  queue.submit(second.get(), 1, false, 2, 0);
+  EXPECT_TRUE(queue.matchesLastSubmissions());
+}
+
+TEST_F(RenderQueueTest, changedSubmissionsDoNotMatchTheLastOnes) {
+  auto first = createRect(0, 1);
+  auto second = createRect(1, 2);
+  RenderQueue queue;
+
+  auto submitBoth = [&](int32_t secondLayer) {
+    queue.submit(first.get(), 0, false, 1, 0);
+    queue.submit(second.get(), secondLayer, false, 2, 0);
+  };
+
+  submitBoth(1);
+  queue.clear();
+
+  //A missing object.
+  queue.submit(first.get(), 0, false, 1, 0);
+  EXPECT_FALSE(queue.matchesLastSubmissions());
+  queue.clear();
+  submitBoth(1);
+  queue.clear();
+
+  //A different sort key.
+  submitBoth(2);
+  EXPECT_FALSE(queue.matchesLastSubmissions());
+  queue.clear();
+
+  //A hidden object.
+  second->setActive(false);
+  submitBoth(2);
+  EXPECT_FALSE(queue.matchesLastSubmissions());
+  queue.clear();
+
+  //A cancelled object, even one that was cancelled between executions.
+  submitBoth(2);
+  EXPECT_TRUE(queue.matchesLastSubmissions());
+  queue.clear();
+  queue.cancel(second.get());
+  submitBoth(2);
+  EXPECT_FALSE(queue.matchesLastSubmissions());
+}
+
+TEST_F(RenderQueueTest, recordingAcrossWorkersMatchesRecordingOnOneThread) {
+  std::vector<std::shared_ptr<Texture>> textures = { _renderer->getTexture(), _renderer->getTexture() };
+  std::vector<std::unique_ptr<ImageRect>> rects;
+  for (int32_t i = 0; i < 2000; i++) {
+    ShaderProgram program;
+    program.shaderProgramId = static_cast<GLuint>(1 + (i % 3));
+    rects.push_back(std::make_unique<ImageRect>(Transform(GeoVector2F(static_cast<float>(i), 0.0f), 0, GeoVector2F::one()), i % 7, program,
+      nullptr, _renderer, textures[i % 2], RGBAConfig(255, 255, 255, 255)));
+    rects.back()->executeObjectBehaviour();
+  }
+
+  _renderer->getRenderQueue().clear();
+  _renderer->getTransformStore().update();
+
+  RenderWorkerPool pool(3);
+  SpriteBatch serialBatch(std::make_unique<RecordingSpriteBatchBackend>());
+  SpriteBatch parallelBatch(std::make_unique<RecordingSpriteBatchBackend>());
+  RenderQueue serialQueue(&serialBatch, &_renderer->getShapeBatch());
+  RenderQueue parallelQueue(&parallelBatch, &_renderer->getShapeBatch(), &pool);
+
+  std::vector<RenderPass> passes;
+  parallelQueue.PassStarted += [&passes](RenderPass pass) { passes.push_back(pass); };
+
+  for (size_t i = 0; i < rects.size(); i++) {
+    auto rect = rects[i].get();
+    auto shaderProgramId = static_cast<GLuint>(1 + (i % 3));
+    serialQueue.submit(rect, rect->layer(), i % 5 == 0, shaderProgramId, static_cast<GLuint>(i % 2));
+    parallelQueue.submit(rect, rect->layer(), i % 5 == 0, shaderProgramId, static_cast<GLuint>(i % 2));
+  }
+
+  serialQueue.record();
+  parallelQueue.record();
+
+  EXPECT_EQ(1u, serialQueue.getRecordedListCount());
+  EXPECT_EQ(4u, parallelQueue.getRecordedListCount());
+  EXPECT_EQ(serialQueue.getSubmittedCount(), parallelQueue.getSubmittedCount());
+  EXPECT_EQ(serialQueue.getStateChangeCount(), parallelQueue.getStateChangeCount());
+
+  serialQueue.replay();
+  parallelQueue.replay();
+  serialBatch.flush();
+  parallelBatch.flush();
+
+  ASSERT_EQ(2u, passes.size());
+  EXPECT_EQ(RenderPass::Opaque, passes[0]);
+  EXPECT_EQ(RenderPass::Translucent, passes[1]);
+
+  auto serialBackend = static_cast<RecordingSpriteBatchBackend*>(serialBatch.getBackend());
+  auto parallelBackend = static_cast<RecordingSpriteBatchBackend*>(parallelBatch.getBackend());
+  ASSERT_EQ(rects.size(), parallelBackend->getRecordedInstances().size());
+  ASSERT_EQ(serialBackend->getRecordedGroups().size(), parallelBackend->getRecordedGroups().size());
+  for (size_t i = 0; i < rects.size(); i++) {
+    EXPECT_EQ(serialBackend->getRecordedInstances()[i].transform, parallelBackend->getRecordedInstances()[i].transform);
+  }
+}
+
+TEST_F(RenderQueueTest, objectsDrawThemselvesWithoutBatches) {
+  auto rect = createRect(0, 1);
+  RenderQueue queue;
+
+  queue.submit(rect.get(), 0, false, 1, 0);
+  queue.record();
+
+  ASSERT_EQ(1u, queue.getRecordedListCount());
+  const auto& commands = queue.getCommandList(0).getCommands();
+  ASSERT_EQ(2u, commands.size());
+  EXPECT_EQ(RenderCommandType::BeginPass, commands[0].type);
+  EXPECT_EQ(RenderCommandType::DrawObject, commands[1].type);
+  EXPECT_EQ(rect.get(), commands[1].object);
+
+  queue.replay();
+  EXPECT_EQ(0u, queue.getRecordedListCount());
+  EXPECT_TRUE(queue.getCommandList(0).getCommands().empty());
+}
+
+TEST_F(RenderQueueTest, culledAndHiddenObjectsRecordNoSprites) {
+  SpatialIndex index;
+  SpriteBatch batch(std::make_unique<RecordingSpriteBatchBackend>());
+  RenderQueue queue(&batch, &_renderer->getShapeBatch());
+
+  auto texture = _renderer->getTexture();
+  ShaderProgram program;
+  program.shaderProgramId = 1;
+  auto visible = std::make_unique<ImageRect>(Transform(GeoVector2F::zero(), 0, GeoVector2F(10.0f, 10.0f)), 0, program, nullptr, _renderer, texture, RGBAConfig(255, 255, 255, 255));
+  auto hidden = std::make_unique<ImageRect>(Transform(GeoVector2F::zero(), 0, GeoVector2F(10.0f, 10.0f)), 0, program, nullptr, _renderer, texture, RGBAConfig(255, 255, 255, 255));
+  auto offscreen = std::make_unique<ImageRect>(Transform(GeoVector2F(1000.0f, 1000.0f), 0, GeoVector2F(10.0f, 10.0f)), 0, program, nullptr, _renderer, texture, RGBAConfig(255, 255, 255, 255));
+  hidden->setActive(false);
+
+  for (auto rect : { visible.get(), hidden.get(), offscreen.get() }) {
+    index.update(rect, rect->transform().getAABB());
+    queue.submit(rect, 0, false, 1, 0);
+  }
+
+  index.cull(GeoBounds(GeoVector2F::zero(), GeoVector2F(100.0f, 100.0f), 0.0f));
+  queue.record(&index);
+
+  EXPECT_EQ(1u, queue.getCulledCount());
+  EXPECT_EQ(1u, queue.getCommandList(0).getSpriteInstances().size());
+}
@@ -0,0 +1,51 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+
+TEST(RenderWorkerPoolTest, everyTaskRunsExactlyOnce) {
+  RenderWorkerPool pool(3);
+  std::vector<std::atomic<uint32_t>> runs(1000);
+
+  pool.run(runs.size(), [&runs](size_t index) { runs[index]++; });
+
+  for (auto& count : runs) {
+    EXPECT_EQ(1u, count.load());
+  }
+}
+
+TEST(RenderWorkerPoolTest, tasksRunOnTheCallingThreadWithoutWorkers) {
+  RenderWorkerPool pool(0);
+  std::vector<std::thread::id> threads;
+
+  pool.run(5, [&threads](size_t) { threads.push_back(std::this_thread::get_id()); });
+
+  ASSERT_EQ(5u, threads.size());
+  for (auto thread : threads) {
+    EXPECT_EQ(std::this_thread::get_id(), thread);
+  }
+}
+
+TEST(RenderWorkerPoolTest, poolCanBeRunRepeatedly) {
+  RenderWorkerPool pool(2);
+  std::atomic<uint64_t> total(0);
+
+  //Runs come back to back, as they do every frame, so a worker that is slow to go back to sleep must not miss the next one.
+  for (uint64_t run = 0; run < 200; run++) {
+    pool.run(8, [&total](size_t index) { total += index; });
+  }
+
+  EXPECT_EQ(200u * 28u, total.load());
+}
+
+TEST(RenderWorkerPoolTest, runningNothingDoesNothing) {
+  RenderWorkerPool pool(2);
+  auto hasRun = false;
+
+  pool.run(0, [&hasRun](size_t) { hasRun = true; });
+
+  EXPECT_FALSE(hasRun);
+}
@@ -0,0 +1,70 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+
+class ScreenTransitionTest : public testing::Test {
+protected:
+  std::unique_ptr<ScreenTransition> _transition;
+
+  void SetUp() override {
+    _transition = std::make_unique<ScreenTransition>(std::make_shared<GLStateCache>());
+  }
+};
+
+TEST_F(ScreenTransitionTest, startCapturesTheOutgoingFrameFirst) {
+  EXPECT_FALSE(_transition->isActive());
+
+  _transition->start(ScreenTransitionEffect::Fade, Timing::Timestamp::fromSeconds(1.0));
+
+  EXPECT_TRUE(_transition->isActive());
+  EXPECT_EQ(ScreenTransitionState::CapturingOutgoing, _transition->getState());
+  EXPECT_EQ(ScreenTransitionEffect::Fade, _transition->getEffect());
+  EXPECT_EQ(0.0f, _transition->getProgress());
+}
+
+TEST_F(ScreenTransitionTest, updateMovesProgressOnAndFinishesAtTheEnd) {
+  auto finishedCount = 0;
+  _transition->Finished += [&] { finishedCount++; };
+  _transition->start(ScreenTransitionEffect::Crossfade, Timing::Timestamp::fromSeconds(2.0));
+
+  _transition->update(Timing::Timestamp::fromSeconds(0.5));
+  EXPECT_FLOAT_EQ(0.25f, _transition->getProgress());
+  EXPECT_EQ(0, finishedCount);
+
+  _transition->update(Timing::Timestamp::fromSeconds(1.5));
+  EXPECT_FALSE(_transition->isActive());
+  EXPECT_EQ(1.0f, _transition->getProgress());
+  EXPECT_EQ(1, finishedCount);
+
+  _transition->update(Timing::Timestamp::fromSeconds(1.0));
+  _transition->finish();
+  EXPECT_EQ(1, finishedCount);
+}
+
+TEST_F(ScreenTransitionTest, progressSetByHandIsClampedAndDoesNotFinish) {
+  _transition->start(ScreenTransitionEffect::Blur, Timing::Timestamp::fromSeconds(1.0));
+
+  _transition->setProgress(2.0f);
+  EXPECT_EQ(1.0f, _transition->getProgress());
+  EXPECT_TRUE(_transition->isActive());
+
+  _transition->setProgress(-1.0f);
+  EXPECT_EQ(0.0f, _transition->getProgress());
+}
+
+TEST_F(ScreenTransitionTest, maskWipeNeedsAMask) {
+  EXPECT_THROW(_transition->start(ScreenTransitionEffect::MaskWipe, Timing::Timestamp::fromSeconds(1.0)), Exceptions::InvalidOperationException);
+  EXPECT_FALSE(_transition->isActive());
+}
+
+TEST_F(ScreenTransitionTest, settingsAreKeptWithinTheirLimits) {
+  _transition->setMaxBlurLevel(100.0f);
+  EXPECT_EQ(static_cast<float>(ScreenTransition::MaxBlurLevelLimit), _transition->getMaxBlurLevel());
+
+  _transition->setSoftness(-1.0f);
+  EXPECT_EQ(0.0f, _transition->getSoftness());
+}
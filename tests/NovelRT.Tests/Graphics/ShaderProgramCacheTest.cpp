@@ -0,0 +1,41 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+
+TEST(ShaderProgramCacheTest, hashIsStable) {
+  //FNV-1a has published test vectors, so a change here means every cached binary would silently stop matching.
+  EXPECT_EQ(14695981039346656037ull, ShaderProgramCache::hash(""));
+  EXPECT_EQ(0xAF63DC4C8601EC8Cull, ShaderProgramCache::hash("a"));
+  EXPECT_EQ(0x85944171F73967E8ull, ShaderProgramCache::hash("foobar"));
+}
+
+TEST(ShaderProgramCacheTest, hashCanBeChained) {
+  EXPECT_EQ(ShaderProgramCache::hash("foobar"), ShaderProgramCache::hash("bar", ShaderProgramCache::hash("foo")));
+}
+
+TEST(ShaderProgramCacheTest, definesAreInsertedAfterTheVersionDirective) {
+  auto source = std::string("// header\n#version 300 es\nvoid main() {}\n");
+  auto result = ShaderProgramCache::applyDefines(source, {"FIRST", "SECOND 2"});
+
+  EXPECT_EQ("// header\n#version 300 es\n#define FIRST\n#define SECOND 2\nvoid main() {}\n", result);
+}
+
+TEST(ShaderProgramCacheTest, definesGoFirstWithoutAVersionDirective) {
+  EXPECT_EQ("#define FIRST\nvoid main() {}\n", ShaderProgramCache::applyDefines("void main() {}\n", {"FIRST"}));
+}
+
+TEST(ShaderProgramCacheTest, noDefinesLeavesTheSourceAlone) {
+  auto source = std::string("#version 300 es\nvoid main() {}\n");
+
+  EXPECT_EQ(source, ShaderProgramCache::applyDefines(source, {}));
+}
+
+TEST(ShaderProgramCacheTest, variantsHashDifferently) {
+  auto source = std::string("#version 300 es\nvoid main() {}\n");
+
+  EXPECT_NE(ShaderProgramCache::hash(source), ShaderProgramCache::hash(ShaderProgramCache::applyDefines(source, {"VARIANT"})));
+}
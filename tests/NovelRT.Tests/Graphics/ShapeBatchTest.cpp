@@ -0,0 +1,78 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+using namespace NovelRT::Maths;
+
+static const GLuint BASIC_PROGRAM = 1;
+static const GLuint CUSTOM_PROGRAM = 2;
+static const std::array<uint8_t, 4> RED = { 255, 0, 0, 255 };
+
+class ShapeBatchTest : public testing::Test {
+protected:
+  std::unique_ptr<ShapeBatch> _batch;
+
+  void SetUp() override {
+    _batch = std::make_unique<ShapeBatch>(std::make_shared<GLStateCache>());
+  }
+};
+
+TEST_F(ShapeBatchTest, flushOnEmptyBatchDoesNotDraw) {
+  _batch->flush();
+  EXPECT_EQ(0u, _batch->getDrawCallCount());
+  EXPECT_EQ(0u, _batch->getVertexCount());
+}
+
+TEST_F(ShapeBatchTest, shapesSharingAProgramFormOneRun) {
+  for (int i = 0; i < 100; i++) {
+    _batch->submitQuad(BASIC_PROGRAM, GeoMatrix4x4F::getDefaultIdentity(), RED);
+  }
+
+  EXPECT_EQ(600u, _batch->getPendingVertices().size());
+  EXPECT_EQ(1u, _batch->getPendingRunCount());
+}
+
+TEST_F(ShapeBatchTest, changingProgramStartsANewRunWithoutReordering) {
+  _batch->submitQuad(BASIC_PROGRAM, GeoMatrix4x4F::getDefaultIdentity(), RED);
+  _batch->submitQuad(CUSTOM_PROGRAM, GeoMatrix4x4F::getDefaultIdentity(), RED);
+  _batch->submitQuad(BASIC_PROGRAM, GeoMatrix4x4F::getDefaultIdentity(), RED);
+
+  EXPECT_EQ(3u, _batch->getPendingRunCount());
+  EXPECT_EQ(18u, _batch->getPendingVertices().size());
+}
+
+TEST_F(ShapeBatchTest, quadCornersAreMovedByTheModelMatrix) {
+  auto matrix = GeoMatrix4x4F::getDefaultIdentity();
+  matrix.x.x = 4.0f;
+  matrix.y.y = 2.0f;
+  matrix.w = GeoVector4F(10.0f, 20.0f, 3.0f, 1.0f);
+  _batch->submitQuad(BASIC_PROGRAM, matrix, RED);
+
+  const auto& vertices = _batch->getPendingVertices();
+  ASSERT_EQ(6u, vertices.size());
+  EXPECT_EQ(GeoVector3F(8.0f, 19.0f, 3.0f), vertices[0].position);
+  EXPECT_EQ(GeoVector3F(12.0f, 21.0f, 3.0f), vertices[2].position);
+  EXPECT_EQ(GeoVector3F(8.0f, 21.0f, 3.0f), vertices[5].position);
+  EXPECT_EQ(RED, vertices[4].colour);
+}
+
+TEST_F(ShapeBatchTest, submittedVerticesTakeTheGivenDepth) {
+  std::vector<ShapeVertex> triangle = {
+    ShapeVertex{GeoVector3F(0.0f, 0.0f, 0.0f), RED},
+    ShapeVertex{GeoVector3F(1.0f, 0.0f, 0.0f), RED},
+    ShapeVertex{GeoVector3F(0.0f, 1.0f, 0.0f), RED}
+  };
+  _batch->submit(BASIC_PROGRAM, triangle, 7.0f);
+
+  const auto& vertices = _batch->getPendingVertices();
+  ASSERT_EQ(3u, vertices.size());
+  EXPECT_EQ(GeoVector3F(1.0f, 0.0f, 7.0f), vertices[1].position);
+}
+
+TEST(ShapeVertexTest, packColourClampsEachChannel) {
+  std::array<uint8_t, 4> expected = { 0, 128, 255, 255 };
+  EXPECT_EQ(expected, ShapeVertex::packColour(RGBAConfig(-20, 128, 300, 255)));
+}
@@ -0,0 +1,80 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+
+struct PackedRect {
+  uint32_t x;
+  uint32_t y;
+  uint32_t width;
+  uint32_t height;
+};
+
+static bool overlaps(const PackedRect& a, const PackedRect& b) {
+  return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+TEST(SkylinePackerTest, firstRectangleGoesInTheTopLeft) {
+  SkylinePacker packer(64, 64);
+  uint32_t x = 99;
+  uint32_t y = 99;
+
+  EXPECT_TRUE(packer.tryPack(10, 10, x, y));
+  EXPECT_EQ(0u, x);
+  EXPECT_EQ(0u, y);
+}
+
+TEST(SkylinePackerTest, rectanglesFillARowBeforeStartingTheNext) {
+  SkylinePacker packer(32, 32);
+  uint32_t x = 0;
+  uint32_t y = 0;
+
+  EXPECT_TRUE(packer.tryPack(16, 8, x, y));
+  EXPECT_TRUE(packer.tryPack(16, 8, x, y));
+  EXPECT_EQ(16u, x);
+  EXPECT_EQ(0u, y);
+
+  EXPECT_TRUE(packer.tryPack(16, 8, x, y));
+  EXPECT_EQ(0u, x);
+  EXPECT_EQ(8u, y);
+}
+
+TEST(SkylinePackerTest, rectanglesThatDoNotFitAreRejected) {
+  SkylinePacker packer(32, 32);
+  uint32_t x = 0;
+  uint32_t y = 0;
+
+  EXPECT_FALSE(packer.tryPack(33, 1, x, y));
+  EXPECT_FALSE(packer.tryPack(1, 33, x, y));
+  EXPECT_TRUE(packer.tryPack(32, 32, x, y));
+  EXPECT_FALSE(packer.tryPack(1, 1, x, y));
+}
+
+TEST(SkylinePackerTest, packedRectanglesNeverOverlapOrLeaveThePage) {
+  SkylinePacker packer(256, 256);
+  std::vector<PackedRect> packed;
+
+  uint32_t state = 7;
+  for (int32_t i = 0; i < 500; i++) {
+    state = state * 1103515245u + 12345u;
+    auto width = 4 + ((state >> 16) % 20);
+    auto height = 4 + ((state >> 8) % 24);
+
+    uint32_t x = 0;
+    uint32_t y = 0;
+    if (!packer.tryPack(width, height, x, y)) continue;
+
+    PackedRect rect{x, y, width, height};
+    EXPECT_LE(x + width, 256u);
+    EXPECT_LE(y + height, 256u);
+    for (auto& other : packed) {
+      EXPECT_FALSE(overlaps(rect, other));
+    }
+    packed.push_back(rect);
+  }
+
+  EXPECT_GT(packed.size(), 100u);
+}
@@ -0,0 +1,104 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+using namespace NovelRT::Maths;
+
+static const GeoBounds VIEW = GeoBounds(GeoVector2F(960.0f, 540.0f), GeoVector2F(1920.0f, 1080.0f), 0.0f);
+
+class SpatialIndexTest : public testing::Test {
+protected:
+  std::shared_ptr<RenderingService> _renderer;
+
+  void SetUp() override {
+    _renderer = std::make_shared<RenderingService>(std::make_shared<Windowing::WindowingService>());
+  }
+
+  std::unique_ptr<ImageRect> createRect(GeoVector2F position, GeoVector2F scale = GeoVector2F(100.0f, 100.0f)) {
+    auto rect = std::make_unique<ImageRect>(Transform(position, 0, scale), 0, ShaderProgram(), nullptr, _renderer, RGBAConfig(255, 255, 255, 255));
+    rect->executeObjectBehaviour();
+    return rect;
+  }
+
+  SpatialIndex& index() {
+    return _renderer->getSpatialIndex();
+  }
+};
+
+TEST_F(SpatialIndexTest, objectsAreIndexedWhenFirstExecuted) {
+  auto rect = createRect(GeoVector2F(100.0f, 100.0f));
+  EXPECT_EQ(1u, index().getObjectCount());
+}
+
+TEST_F(SpatialIndexTest, objectsOutsideTheViewAreCulled) {
+  auto inside = createRect(GeoVector2F(100.0f, 100.0f));
+  auto outside = createRect(GeoVector2F(-1000.0f, 100.0f));
+
+  index().cull(VIEW);
+
+  EXPECT_TRUE(index().isVisible(inside.get()));
+  EXPECT_FALSE(index().isVisible(outside.get()));
+  EXPECT_EQ(1u, index().getLastVisibleCount());
+}
+
+TEST_F(SpatialIndexTest, objectsOverlappingTheEdgeOfTheViewAreVisible) {
+  auto rect = createRect(GeoVector2F(-40.0f, 540.0f));
+
+  index().cull(VIEW);
+
+  EXPECT_TRUE(index().isVisible(rect.get()));
+}
+
+TEST_F(SpatialIndexTest, movedObjectsAreReindexed) {
+  auto rect = createRect(GeoVector2F(-1000.0f, 100.0f));
+  rect->transform().position = GeoVector2F(500.0f, 500.0f);
+  rect->executeObjectBehaviour();
+
+  index().cull(VIEW);
+
+  EXPECT_TRUE(index().isVisible(rect.get()));
+  EXPECT_EQ(1u, index().getObjectCount());
+}
+
+TEST_F(SpatialIndexTest, objectsBeyondTheTreeAreStillTracked) {
+  auto farAway = createRect(GeoVector2F(100000.0f, 100000.0f));
+  auto huge = createRect(GeoVector2F(960.0f, 540.0f), GeoVector2F(4000.0f, 4000.0f));
+
+  EXPECT_EQ(2u, index().getUnindexedObjectCount());
+
+  index().cull(VIEW);
+
+  EXPECT_FALSE(index().isVisible(farAway.get()));
+  EXPECT_TRUE(index().isVisible(huge.get()));
+}
+
+TEST_F(SpatialIndexTest, destroyedObjectsAreRemoved) {
+  auto rect = createRect(GeoVector2F(100.0f, 100.0f));
+  rect.reset();
+
+  EXPECT_EQ(0u, index().getObjectCount());
+}
+
+TEST_F(SpatialIndexTest, renderQueueSkipsCulledObjects) {
+  auto inside = createRect(GeoVector2F(100.0f, 100.0f));
+  auto outside = createRect(GeoVector2F(-1000.0f, 100.0f));
+
+  index().cull(VIEW);
+  _renderer->getRenderQueue().execute(&index());
+
+  EXPECT_EQ(1u, _renderer->getRenderQueue().getSubmittedCount());
+  EXPECT_EQ(1u, _renderer->getRenderQueue().getCulledCount());
+}
+
+TEST(CameraVisibleBoundsTest, defaultOrthographicCameraSeesTheVirtualCanvas) {
+  auto camera = Camera::createDefaultOrthographicProjection(GeoVector2F(1280.0f, 720.0f));
+  auto bounds = camera->getVisibleBounds();
+
+  EXPECT_NEAR(960.0f, bounds.position.x, 0.01f);
+  EXPECT_NEAR(540.0f, bounds.position.y, 0.01f);
+  EXPECT_NEAR(1920.0f, bounds.size.x, 0.01f);
+  EXPECT_NEAR(1080.0f, bounds.size.y, 0.01f);
+}
@@ -0,0 +1,123 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+
+namespace {
+  RgbaImage createImage(uint32_t width, uint32_t height, uint8_t value) {
+    RgbaImage image(width, height);
+    std::fill(image.pixels.begin(), image.pixels.end(), value);
+    return image;
+  }
+}
+
+TEST(SpriteAtlasBuilderTest, transparentBordersAreTrimmed) {
+  RgbaImage image(10, 8);
+  for (uint32_t y = 2; y < 5; y++) {
+    for (uint32_t x = 3; x < 7; x++) {
+      std::fill_n(image.getPixel(x, y), RgbaImage::BytesPerPixel, static_cast<uint8_t>(255));
+    }
+  }
+
+  SpriteAtlasBuilder builder(64, 1, true);
+  builder.addImage("frame", std::move(image));
+  builder.build();
+
+  auto& region = builder.getRegions().at(0);
+  EXPECT_EQ(3u, region.trimX);
+  EXPECT_EQ(2u, region.trimY);
+  EXPECT_EQ(4u, region.width);
+  EXPECT_EQ(3u, region.height);
+  EXPECT_EQ(10u, region.sourceWidth);
+  EXPECT_EQ(8u, region.sourceHeight);
+}
+
+TEST(SpriteAtlasBuilderTest, untrimmedImagesKeepTheirFullSize) {
+  SpriteAtlasBuilder builder(64, 1, false);
+  builder.addImage("frame", RgbaImage(10, 8));
+  builder.build();
+
+  auto& region = builder.getRegions().at(0);
+  EXPECT_EQ(0u, region.trimX);
+  EXPECT_EQ(0u, region.trimY);
+  EXPECT_EQ(10u, region.width);
+  EXPECT_EQ(8u, region.height);
+}
+
+TEST(SpriteAtlasBuilderTest, imagesAreCopiedIntoTheirRegionWithAPaddedGutter) {
+  SpriteAtlasBuilder builder(64, 2, true);
+  builder.addImage("a", createImage(8, 8, 200));
+  builder.addImage("b", createImage(8, 8, 100));
+  builder.build();
+
+  ASSERT_EQ(1u, builder.getPages().size());
+  auto& page = builder.getPages()[0];
+  auto& regions = builder.getRegions();
+
+  EXPECT_GE(regions[0].x, 2u);
+  EXPECT_GE(regions[0].y, 2u);
+  EXPECT_EQ(200, page.getPixel(regions[0].x, regions[0].y)[0]);
+  EXPECT_EQ(100, page.getPixel(regions[1].x + 7, regions[1].y + 7)[0]);
+
+  auto& first = regions[0];
+  auto& second = regions[1];
+  auto horizontalGap = first.x < second.x ? second.x - (first.x + first.width) : first.x - (second.x + second.width);
+  auto verticalGap = first.y < second.y ? second.y - (first.y + first.height) : first.y - (second.y + second.height);
+  EXPECT_TRUE(horizontalGap >= 2u || verticalGap >= 2u);
+}
+
+TEST(SpriteAtlasBuilderTest, imagesThatDoNotFitOnOnePageSpillOntoMore) {
+  SpriteAtlasBuilder builder(32, 0, true);
+  for (int32_t i = 0; i < 5; i++) {
+    builder.addImage(std::to_string(i), createImage(16, 16, 255));
+  }
+
+  builder.build();
+
+  EXPECT_EQ(2u, builder.getPages().size());
+  EXPECT_EQ(1u, builder.getRegions()[4].page);
+}
+
+TEST(SpriteAtlasBuilderTest, imagesLargerThanAPageThrow) {
+  SpriteAtlasBuilder builder(32, 2, true);
+  builder.addImage("huge", createImage(31, 31, 255));
+
+  EXPECT_THROW(builder.build(), Exceptions::InvalidOperationException);
+}
+
+TEST(SpriteAtlasBuilderTest, manifestsRoundTrip) {
+  SpriteAtlasBuilder builder(64, 1, true);
+  builder.addImage("idle/0-0", createImage(8, 4, 255));
+  builder.addImage("name with spaces", createImage(4, 8, 255));
+  builder.build();
+
+  std::stringstream stream;
+  builder.writeManifest(stream, std::vector<std::string> { "atlas_0.png" });
+
+  std::vector<std::string> pageFiles;
+  std::vector<SpriteAtlasRegion> regions;
+  ASSERT_TRUE(SpriteAtlasBuilder::tryReadManifest(stream, pageFiles, regions));
+
+  ASSERT_EQ(1u, pageFiles.size());
+  EXPECT_EQ("atlas_0.png", pageFiles[0]);
+  ASSERT_EQ(2u, regions.size());
+  for (size_t i = 0; i < regions.size(); i++) {
+    auto& expected = builder.getRegions()[i];
+    EXPECT_EQ(expected.name, regions[i].name);
+    EXPECT_EQ(expected.x, regions[i].x);
+    EXPECT_EQ(expected.y, regions[i].y);
+    EXPECT_EQ(expected.width, regions[i].width);
+    EXPECT_EQ(expected.height, regions[i].height);
+  }
+}
+
+TEST(SpriteAtlasBuilderTest, malformedManifestsAreRejected) {
+  std::stringstream stream("NovelRTSpriteAtlas 1\npages 1\n\"atlas_0.png\"\nregions 1\n\"frame\" 3 0 0 1 1 0 0 1 1\n");
+  std::vector<std::string> pageFiles;
+  std::vector<SpriteAtlasRegion> regions;
+
+  EXPECT_FALSE(SpriteAtlasBuilder::tryReadManifest(stream, pageFiles, regions));
+}
@@ -0,0 +1,123 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+using namespace NovelRT::Maths;
+
+static const GLuint TEXTURED_PROGRAM = 1;
+static const GLuint FONT_PROGRAM = 2;
+
+SpriteInstanceData createInstance(float x) {
+  SpriteInstanceData instance;
+  instance.transform = GeoMatrix4x4F::getDefaultIdentity();
+  instance.transform.w.x = x;
+  instance.uvRect = GeoVector4F(0.0f, 0.0f, 1.0f, 1.0f);
+  instance.colourTint = GeoVector4F(1.0f, 1.0f, 1.0f, 1.0f);
+  return instance;
+}
+
+class SpriteBatchTest : public testing::Test {
+protected:
+  std::shared_ptr<RenderingService> _renderer;
+  std::unique_ptr<SpriteBatch> _batch;
+  RecordingSpriteBatchBackend* _backend;
+  std::shared_ptr<Texture> _firstTexture;
+  std::shared_ptr<Texture> _secondTexture;
+
+  void SetUp() override {
+    _renderer = std::make_shared<RenderingService>(std::make_shared<Windowing::WindowingService>());
+    _batch = std::make_unique<SpriteBatch>(std::make_unique<RecordingSpriteBatchBackend>());
+    _backend = static_cast<RecordingSpriteBatchBackend*>(_batch->getBackend());
+    _firstTexture = _renderer->getTexture();
+    _secondTexture = _renderer->getTexture();
+  }
+};
+
+TEST_F(SpriteBatchTest, flushOnEmptyBatchDoesNotSubmit) {
+  _batch->flush();
+  EXPECT_EQ(0u, _backend->getSubmissionCount());
+  EXPECT_EQ(0u, _batch->getDrawCallCount());
+}
+
+TEST_F(SpriteBatchTest, spritesSharingProgramAndTextureProduceOneDrawCall) {
+  for (int i = 0; i < 300; i++) {
+    _batch->submit(TEXTURED_PROGRAM, _firstTexture, createInstance(static_cast<float>(i)));
+  }
+
+  _batch->flush();
+
+  EXPECT_EQ(1u, _backend->getDrawCallCount());
+  EXPECT_EQ(300u, _backend->getRecordedGroups()[0].instanceCount);
+  EXPECT_EQ(300u, _batch->getSpriteCount());
+  EXPECT_EQ(1u, _batch->getDrawCallCount());
+}
+
+TEST_F(SpriteBatchTest, spritesAreGroupedByTexture) {
+  _batch->submit(TEXTURED_PROGRAM, _firstTexture, createInstance(0.0f));
+  _batch->submit(TEXTURED_PROGRAM, _secondTexture, createInstance(1.0f));
+  _batch->submit(TEXTURED_PROGRAM, _firstTexture, createInstance(2.0f));
+
+  _batch->flush();
+
+  auto& groups = _backend->getRecordedGroups();
+  ASSERT_EQ(2u, groups.size());
+  EXPECT_EQ(_firstTexture, groups[0].texture);
+  EXPECT_EQ(2u, groups[0].instanceCount);
+  EXPECT_EQ(_secondTexture, groups[1].texture);
+  EXPECT_EQ(1u, groups[1].instanceCount);
+}
+
+TEST_F(SpriteBatchTest, spritesAreGroupedByShaderProgram) {
+  _batch->submit(TEXTURED_PROGRAM, _firstTexture, createInstance(0.0f));
+  _batch->submit(FONT_PROGRAM, _firstTexture, createInstance(1.0f));
+
+  _batch->flush();
+
+  auto& groups = _backend->getRecordedGroups();
+  ASSERT_EQ(2u, groups.size());
+  EXPECT_EQ(TEXTURED_PROGRAM, groups[0].shaderProgramId);
+  EXPECT_EQ(FONT_PROGRAM, groups[1].shaderProgramId);
+}
+
+TEST_F(SpriteBatchTest, groupInstancesAreContiguousAndKeepSubmissionOrder) {
+  _batch->submit(TEXTURED_PROGRAM, _firstTexture, createInstance(0.0f));
+  _batch->submit(TEXTURED_PROGRAM, _secondTexture, createInstance(1.0f));
+  _batch->submit(TEXTURED_PROGRAM, _firstTexture, createInstance(2.0f));
+
+  _batch->flush();
+
+  auto& groups = _backend->getRecordedGroups();
+  auto& instances = _backend->getRecordedInstances();
+  ASSERT_EQ(3u, instances.size());
+  EXPECT_EQ(0.0f, instances[groups[0].firstInstance].transform.w.x);
+  EXPECT_EQ(2.0f, instances[groups[0].firstInstance + 1].transform.w.x);
+  EXPECT_EQ(1.0f, instances[groups[1].firstInstance].transform.w.x);
+}
+
+TEST_F(SpriteBatchTest, flushEmptiesTheBatch) {
+  _batch->submit(TEXTURED_PROGRAM, _firstTexture, createInstance(0.0f));
+  _batch->flush();
+
+  EXPECT_EQ(0u, _batch->getPendingSpriteCount());
+  EXPECT_EQ(0u, _batch->getPendingGroupCount());
+
+  _batch->flush();
+  EXPECT_EQ(1u, _backend->getSubmissionCount());
+}
+
+TEST_F(SpriteBatchTest, statisticsAccumulateUntilReset) {
+  _batch->submit(TEXTURED_PROGRAM, _firstTexture, createInstance(0.0f));
+  _batch->flush();
+  _batch->submit(TEXTURED_PROGRAM, _secondTexture, createInstance(0.0f));
+  _batch->flush();
+
+  EXPECT_EQ(2u, _batch->getDrawCallCount());
+  EXPECT_EQ(2u, _batch->getSpriteCount());
+
+  _batch->resetStatistics();
+  EXPECT_EQ(0u, _batch->getDrawCallCount());
+  EXPECT_EQ(0u, _batch->getSpriteCount());
+}
@@ -0,0 +1,128 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+
+namespace {
+  RgbaImage createGradient(uint32_t width, uint32_t height) {
+    RgbaImage image(width, height);
+    for (uint32_t y = 0; y < height; y++) {
+      for (uint32_t x = 0; x < width; x++) {
+        auto pixel = image.getPixel(x, y);
+        pixel[0] = static_cast<uint8_t>(x * 255 / width);
+        pixel[1] = static_cast<uint8_t>(y * 255 / height);
+        pixel[2] = 64;
+        pixel[3] = static_cast<uint8_t>(x % 2 == 0 ? 255 : 128);
+      }
+    }
+
+    return image;
+  }
+
+  std::string getTestFile(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+  }
+
+  std::string writeTestFile(const std::string& name, const std::vector<uint8_t>& bytes) {
+    auto file = getTestFile(name);
+    std::ofstream stream(file, std::ios::binary | std::ios::trunc);
+    stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return file;
+  }
+}
+
+TEST(TextureContainerTest, mipChainHalvesEachLevelDownToOnePixel) {
+  auto levels = TextureContainer::generateMipChain(createGradient(8, 3));
+
+  ASSERT_EQ(4u, levels.size());
+  EXPECT_EQ(8u, levels[0].width);
+  EXPECT_EQ(3u, levels[0].height);
+  EXPECT_EQ(4u, levels[1].width);
+  EXPECT_EQ(1u, levels[1].height);
+  EXPECT_EQ(2u, levels[2].width);
+  EXPECT_EQ(1u, levels[3].width);
+  EXPECT_EQ(1u, levels[3].height);
+}
+
+TEST(TextureContainerTest, mipChainAveragesColourByAlpha) {
+  RgbaImage image(2, 2);
+  image.getPixel(0, 0)[0] = 200;
+  image.getPixel(0, 0)[3] = 255;
+  image.getPixel(1, 1)[2] = 255; //a transparent pixel, whose blue should not show up in the average
+
+  auto levels = TextureContainer::generateMipChain(image);
+
+  ASSERT_EQ(2u, levels.size());
+  auto pixel = levels[1].getPixel(0, 0);
+  EXPECT_EQ(200, pixel[0]);
+  EXPECT_EQ(0, pixel[2]);
+  EXPECT_EQ(64, pixel[3]);
+}
+
+TEST(TextureContainerTest, rgba8ContainerRoundTripsEveryLevel) {
+  auto image = createGradient(16, 8);
+  auto file = getTestFile("NovelRTTextureContainerTest_rgba8.nrtex");
+  TextureContainer::encodeFile(file, image, TextureContainerFormat::Rgba8);
+
+  TextureContainer container(file);
+  auto expectedLevels = TextureContainer::generateMipChain(image);
+
+  EXPECT_EQ(TextureContainerFormat::Rgba8, container.getFormat());
+  EXPECT_EQ(16u, container.getWidth());
+  EXPECT_EQ(8u, container.getHeight());
+  ASSERT_EQ(expectedLevels.size(), container.getLevels().size());
+
+  for (size_t i = 0; i < expectedLevels.size(); i++) {
+    auto& level = container.getLevels()[i];
+    EXPECT_EQ(expectedLevels[i].width, level.width);
+    EXPECT_EQ(expectedLevels[i].height, level.height);
+    ASSERT_EQ(expectedLevels[i].pixels.size(), level.size);
+    EXPECT_EQ(0, std::memcmp(expectedLevels[i].pixels.data(), level.data, level.size));
+  }
+}
+
+TEST(TextureContainerTest, etc2ContainerLevelsHaveTheirCompressedSizes) {
+  auto file = writeTestFile("NovelRTTextureContainerTest_etc2.nrtex", TextureContainer::encode(createGradient(9, 6), TextureContainerFormat::Etc2Rgba8));
+  TextureContainer container(file);
+
+  EXPECT_EQ(TextureContainerFormat::Etc2Rgba8, container.getFormat());
+  ASSERT_EQ(4u, container.getLevels().size());
+  for (auto& level : container.getLevels()) {
+    EXPECT_EQ(Etc2Encoder::getEncodedSize(level.width, level.height, true), level.size);
+  }
+}
+
+TEST(TextureContainerTest, containerWithoutMipmapsHoldsOneLevel) {
+  auto file = writeTestFile("NovelRTTextureContainerTest_single.nrtex", TextureContainer::encode(createGradient(9, 6), TextureContainerFormat::Etc2Rgb8, false));
+  TextureContainer container(file);
+
+  ASSERT_EQ(1u, container.getLevels().size());
+  EXPECT_EQ(Etc2Encoder::getEncodedSize(9, 6, false), container.getLevels()[0].size);
+}
+
+TEST(TextureContainerTest, malformedFilesThrowIOException) {
+  auto bytes = TextureContainer::encode(createGradient(8, 8), TextureContainerFormat::Rgba8);
+
+  auto truncated = bytes;
+  truncated.resize(truncated.size() - 1);
+  EXPECT_THROW(TextureContainer container(writeTestFile("NovelRTTextureContainerTest_truncated.nrtex", truncated)), Exceptions::IOException);
+
+  auto wrongMagic = bytes;
+  wrongMagic[0] ^= 0xFF;
+  EXPECT_THROW(TextureContainer container(writeTestFile("NovelRTTextureContainerTest_magic.nrtex", wrongMagic)), Exceptions::IOException);
+
+  EXPECT_THROW(TextureContainer container(writeTestFile("NovelRTTextureContainerTest_tiny.nrtex", std::vector<uint8_t>(4, 0))), Exceptions::IOException);
+}
+
+TEST(TextureContainerTest, emptyImagesCannotBeEncoded) {
+  EXPECT_THROW(TextureContainer::encode(RgbaImage(), TextureContainerFormat::Rgba8), Exceptions::InvalidOperationException);
+}
+
+TEST(TextureContainerTest, containerFilesAreRecognisedByExtension) {
+  EXPECT_TRUE(TextureContainer::isContainerFile("Images/background.nrtex"));
+  EXPECT_FALSE(TextureContainer::isContainerFile("Images/background.png"));
+  EXPECT_FALSE(TextureContainer::isContainerFile("nrtex"));
+}
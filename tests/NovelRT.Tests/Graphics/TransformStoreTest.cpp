@@ -0,0 +1,130 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Graphics;
+
+static void expectModelMatrix(const Maths::GeoMatrix4x4F& matrix, Maths::GeoVector2F position, float rotation, Maths::GeoVector2F scale, float layer) {
+  auto radians = static_cast<double>(rotation) * 3.14159265358979323846 / 180.0;
+  auto sine = static_cast<float>(std::sin(radians));
+  auto cosine = static_cast<float>(std::cos(radians));
+  auto tolerance = 1e-5f * std::max(1.0f, std::max(std::fabs(scale.x), std::fabs(scale.y)));
+
+  EXPECT_NEAR(cosine * scale.x, matrix.x.x, tolerance);
+  EXPECT_NEAR(sine * scale.x, matrix.x.y, tolerance);
+  EXPECT_EQ(0.0f, matrix.x.z);
+  EXPECT_EQ(0.0f, matrix.x.w);
+  EXPECT_NEAR(-sine * scale.y, matrix.y.x, tolerance);
+  EXPECT_NEAR(cosine * scale.y, matrix.y.y, tolerance);
+  EXPECT_EQ(0.0f, matrix.y.z);
+  EXPECT_EQ(0.0f, matrix.y.w);
+  EXPECT_EQ(Maths::GeoVector4F(0.0f, 0.0f, 1.0f, 0.0f), matrix.z);
+  EXPECT_EQ(Maths::GeoVector4F(position.x, position.y, layer, 1.0f), matrix.w);
+}
+
+TEST(TransformStoreTest, newSlotsHoldTheIdentityMatrix) {
+  TransformStore store;
+  auto handle = store.allocate();
+
+  EXPECT_EQ(Maths::GeoMatrix4x4F::getDefaultIdentity(), store.getModelMatrix(handle));
+  EXPECT_EQ(0u, store.update());
+}
+
+TEST(TransformStoreTest, updateRebuildsEveryDirtySlot) {
+  TransformStore store;
+  std::vector<uint32_t> handles;
+  //Enough slots to run the widest SIMD kernel several times and still leave a scalar tail.
+  for (uint32_t i = 0; i < 203; i++) {
+    handles.push_back(store.allocate());
+  }
+
+  for (uint32_t i = 0; i < handles.size(); i++) {
+    auto value = static_cast<float>(i);
+    store.set(handles[i], Maths::GeoVector2F(value, -value), value * 7.3f - 700.0f, Maths::GeoVector2F(1.0f + value, 2.0f), value / 10.0f);
+  }
+
+  EXPECT_EQ(handles.size(), store.update());
+  EXPECT_EQ(handles.size(), store.getLastUpdateCount());
+
+  for (uint32_t i = 0; i < handles.size(); i++) {
+    auto value = static_cast<float>(i);
+    expectModelMatrix(store.getModelMatrix(handles[i]), Maths::GeoVector2F(value, -value), value * 7.3f - 700.0f, Maths::GeoVector2F(1.0f + value, 2.0f), value / 10.0f);
+  }
+}
+
+TEST(TransformStoreTest, updateOnlyRebuildsSlotsThatChanged) {
+  TransformStore store;
+  for (uint32_t i = 0; i < 100; i++) {
+    store.set(store.allocate(), Maths::GeoVector2F(1.0f, 2.0f), 30.0f, Maths::GeoVector2F(3.0f, 4.0f), 1.0f);
+  }
+
+  EXPECT_EQ(100u, store.update());
+  EXPECT_EQ(0u, store.update());
+
+  store.set(70, Maths::GeoVector2F(5.0f, 6.0f), 90.0f, Maths::GeoVector2F(7.0f, 8.0f), 2.0f);
+  EXPECT_EQ(1u, store.update());
+  expectModelMatrix(store.getModelMatrix(70), Maths::GeoVector2F(5.0f, 6.0f), 90.0f, Maths::GeoVector2F(7.0f, 8.0f), 2.0f);
+  expectModelMatrix(store.getModelMatrix(69), Maths::GeoVector2F(1.0f, 2.0f), 30.0f, Maths::GeoVector2F(3.0f, 4.0f), 1.0f);
+}
+
+TEST(TransformStoreTest, getModelMatrixRebuildsADirtySlotOnItsOwn) {
+  TransformStore store;
+  auto handle = store.allocate();
+  store.set(handle, Maths::GeoVector2F(10.0f, 20.0f), -135.0f, Maths::GeoVector2F(2.0f, 3.0f), 4.0f);
+
+  expectModelMatrix(store.getModelMatrix(handle), Maths::GeoVector2F(10.0f, 20.0f), -135.0f, Maths::GeoVector2F(2.0f, 3.0f), 4.0f);
+  EXPECT_EQ(0u, store.update());
+}
+
+TEST(TransformStoreTest, quarterTurnsAreExact) {
+  TransformStore store;
+  auto handle = store.allocate();
+
+  for (auto rotation : { -270.0f, -180.0f, -90.0f, 0.0f, 90.0f, 180.0f, 270.0f, 360.0f }) {
+    store.set(handle, Maths::GeoVector2F::zero(), rotation, Maths::GeoVector2F::one(), 0.0f);
+    const auto& matrix = store.getModelMatrix(handle);
+    auto quarterTurns = static_cast<int32_t>(rotation / 90.0f);
+    auto sine = static_cast<float>((quarterTurns % 2 == 0) ? 0 : ((quarterTurns + 4) % 4 == 1 ? 1 : -1));
+    auto cosine = static_cast<float>((quarterTurns % 2 != 0) ? 0 : ((quarterTurns + 4) % 4 == 0 ? 1 : -1));
+
+    EXPECT_EQ(cosine, matrix.x.x);
+    EXPECT_EQ(sine, matrix.x.y);
+  }
+}
+
+TEST(TransformStoreTest, releasedSlotsAreReusedAndNoLongerRebuilt) {
+  TransformStore store;
+  auto first = store.allocate();
+  auto second = store.allocate();
+  store.set(first, Maths::GeoVector2F(1.0f, 1.0f), 45.0f, Maths::GeoVector2F::one(), 0.0f);
+  store.release(first);
+
+  EXPECT_EQ(0u, store.update());
+  EXPECT_EQ(first, store.allocate());
+  EXPECT_NE(first, second);
+  EXPECT_EQ(2u, store.getCapacity());
+  EXPECT_EQ(Maths::GeoMatrix4x4F::getDefaultIdentity(), store.getModelMatrix(first));
+}
+
+TEST(TransformStoreTest, updateAcrossWorkersMatchesUpdateOnOneThread) {
+  TransformStore serialStore;
+  TransformStore parallelStore;
+  RenderWorkerPool pool(3);
+
+  //Enough slots for every thread to get a share.
+  auto count = TransformStore::MinimumHandlesPerTask * 4 + 13;
+  for (size_t i = 0; i < count; i++) {
+    auto value = static_cast<float>(i);
+    serialStore.set(serialStore.allocate(), Maths::GeoVector2F(value, 1.0f), value * 0.37f, Maths::GeoVector2F(2.0f, value), 3.0f);
+    parallelStore.set(parallelStore.allocate(), Maths::GeoVector2F(value, 1.0f), value * 0.37f, Maths::GeoVector2F(2.0f, value), 3.0f);
+  }
+
+  EXPECT_EQ(count, serialStore.update());
+  EXPECT_EQ(count, parallelStore.update(&pool));
+
+  for (uint32_t handle = 0; handle < count; handle++) {
+    EXPECT_EQ(serialStore.getModelMatrix(handle), parallelStore.getModelMatrix(handle));
+  }
+}
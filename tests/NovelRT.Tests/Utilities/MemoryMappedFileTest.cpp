@@ -0,0 +1,41 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Utilities;
+
+namespace {
+  std::string writeTestFile(const std::string& name, const std::string& contents) {
+    auto file = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream stream(file, std::ios::binary | std::ios::trunc);
+    stream << contents;
+    return file;
+  }
+}
+
+TEST(MemoryMappedFileTest, mappedFileMatchesContentsOnDisk) {
+  auto file = writeTestFile("NovelRTMemoryMappedFileTest_contents.bin", "NovelRT");
+  MemoryMappedFile mappedFile(file);
+
+  ASSERT_EQ(7u, mappedFile.getSize());
+  ASSERT_NE(nullptr, mappedFile.getData());
+  EXPECT_EQ("NovelRT", std::string(reinterpret_cast<const char*>(mappedFile.getData()), mappedFile.getSize()));
+  EXPECT_EQ(file, mappedFile.getFile());
+}
+
+TEST(MemoryMappedFileTest, emptyFileIsNotMapped) {
+  auto file = writeTestFile("NovelRTMemoryMappedFileTest_empty.bin", "");
+  MemoryMappedFile mappedFile(file);
+
+  EXPECT_EQ(0u, mappedFile.getSize());
+  EXPECT_EQ(nullptr, mappedFile.getData());
+}
+
+TEST(MemoryMappedFileTest, missingFileThrowsFileNotFoundException) {
+  auto file = (std::filesystem::temp_directory_path() / "NovelRTMemoryMappedFileTest_missing.bin").string();
+  std::filesystem::remove(file);
+
+  EXPECT_THROW(MemoryMappedFile mappedFile(file), Exceptions::FileNotFoundException);
+}
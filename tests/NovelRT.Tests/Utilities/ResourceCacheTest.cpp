@@ -0,0 +1,65 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT License (MIT). See LICENCE.md in the repository root for more information.
+
+#include <gtest/gtest.h>
+#include <NovelRT.h>
+
+using namespace NovelRT;
+using namespace NovelRT::Utilities;
+
+TEST(ResourceCacheTest, cachedResourcesAreReturnedAsHits) {
+  ResourceCache<std::string, int32_t> cache;
+  auto resource = std::make_shared<int32_t>(5);
+  cache.insert("a", resource);
+
+  EXPECT_EQ(resource, cache.tryGet("a"));
+  EXPECT_EQ(1u, cache.getHitCount());
+  EXPECT_EQ(0u, cache.getMissCount());
+}
+
+TEST(ResourceCacheTest, unknownKeysAreMisses) {
+  ResourceCache<std::string, int32_t> cache;
+
+  EXPECT_EQ(nullptr, cache.tryGet("a"));
+  EXPECT_EQ(0u, cache.getHitCount());
+  EXPECT_EQ(1u, cache.getMissCount());
+}
+
+TEST(ResourceCacheTest, destroyedResourcesAreMissesAndTheirEntryIsDropped) {
+  ResourceCache<std::string, int32_t> cache;
+  auto resource = std::make_shared<int32_t>(5);
+  cache.insert("a", resource);
+  resource.reset();
+
+  EXPECT_EQ(nullptr, cache.tryGet("a"));
+  EXPECT_EQ(1u, cache.getMissCount());
+  EXPECT_EQ(0u, cache.getCount());
+}
+
+TEST(ResourceCacheTest, removeIfExpiredLeavesLiveEntriesAlone) {
+  ResourceCache<std::string, int32_t> cache;
+  auto resource = std::make_shared<int32_t>(5);
+  cache.insert("a", resource);
+
+  cache.removeIfExpired("a");
+  EXPECT_EQ(1u, cache.getCount());
+
+  resource.reset();
+  cache.removeIfExpired("a");
+  EXPECT_EQ(0u, cache.getCount());
+}
+
+TEST(ResourceCacheTest, expiredEntriesAreSweptAsNewOnesAreAdded) {
+  ResourceCache<int32_t, int32_t> cache;
+  for (int32_t i = 0; i < 100; i++) {
+    cache.insert(i, std::make_shared<int32_t>(i));
+  }
+
+  std::vector<std::shared_ptr<int32_t>> live;
+  for (int32_t i = 0; i < 1000; i++) {
+    live.push_back(std::make_shared<int32_t>(i));
+    cache.insert(1000 + i, live.back());
+  }
+
+  EXPECT_LT(cache.getCount(), live.size() + 100);
+  EXPECT_GE(cache.getCount(), live.size());
+}
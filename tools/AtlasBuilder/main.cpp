@@ -0,0 +1,96 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+//Packs a set of PNG files into sprite atlas pages ahead of time, so that games do not have to pack them on every launch.
+//The output is <output>.atlas plus one <output>_<page>.png per page, and can be loaded with RenderingService::loadSpriteAtlas.
+//Each image is named by its path as given on the command line, with forward slashes.
+
+static void printUsage() {
+  std::cout << "Usage: AtlasBuilder [--page-size <pixels>] [--padding <pixels>] [--no-trim] <output> <image.png>..." << std::endl;
+}
+
+static bool tryParseSize(const char* text, uint32_t& value) {
+  try {
+    auto parsed = std::stoul(text);
+    if (parsed > std::numeric_limits<uint32_t>::max()) return false;
+
+    value = static_cast<uint32_t>(parsed);
+    return true;
+  }
+  catch (const std::exception&) {
+    return false;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  auto pageSize = NovelRT::Graphics::SpriteAtlasBuilder::DefaultPageSize;
+  auto padding = NovelRT::Graphics::SpriteAtlasBuilder::DefaultPadding;
+  auto shouldTrim = true;
+  std::vector<std::string> positionalArguments;
+
+  for (int i = 1; i < argc; i++) {
+    std::string argument = argv[i];
+
+    if (argument == "--page-size" && i + 1 < argc) {
+      if (!tryParseSize(argv[++i], pageSize) || pageSize == 0) {
+        printUsage();
+        return 1;
+      }
+    }
+    else if (argument == "--padding" && i + 1 < argc) {
+      if (!tryParseSize(argv[++i], padding)) {
+        printUsage();
+        return 1;
+      }
+    }
+    else if (argument == "--no-trim") {
+      shouldTrim = false;
+    }
+    else {
+      positionalArguments.push_back(argument);
+    }
+  }
+
+  if (positionalArguments.size() < 2) {
+    printUsage();
+    return 1;
+  }
+
+  auto outputPath = std::filesystem::path(positionalArguments[0]);
+  auto builder = NovelRT::Graphics::SpriteAtlasBuilder(pageSize, padding, shouldTrim);
+
+  try {
+    for (size_t i = 1; i < positionalArguments.size(); i++) {
+      auto imagePath = std::filesystem::path(positionalArguments[i]);
+      builder.addImage(imagePath.generic_string(), NovelRT::Graphics::PngCodec::decodeFile(imagePath.string()));
+    }
+
+    builder.build();
+
+    std::vector<std::string> pageFiles;
+    for (size_t i = 0; i < builder.getPages().size(); i++) {
+      auto pageFile = outputPath.filename().string() + "_" + std::to_string(i) + ".png";
+      NovelRT::Graphics::PngCodec::encodeFile((outputPath.parent_path() / pageFile).string(), builder.getPages()[i]);
+      pageFiles.push_back(pageFile);
+    }
+
+    auto manifestPath = outputPath;
+    manifestPath += ".atlas";
+    std::ofstream manifest(manifestPath);
+    if (!manifest) {
+      std::cerr << "Could not open " << manifestPath.string() << " for writing." << std::endl;
+      return 1;
+    }
+
+    builder.writeManifest(manifest, pageFiles);
+    std::cout << "Packed " << builder.getRegions().size() << " images into " << pageFiles.size() << " pages." << std::endl;
+  }
+  catch (const std::exception& exception) {
+    std::cerr << exception.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,101 @@
+// Copyright © Matt Jones and Contributors. Licensed under the MIT Licence (MIT). See LICENCE.md in the repository root for more information.
+
+#include <NovelRT.h>
+
+//Converts a PNG file into a texture container (.nrtex) holding a full mip chain, compressed as ETC2 unless told otherwise.
+//RenderingService::getTexture loads .nrtex files directly, without decoding anything.
+//Given a .qoi output instead, it writes the image losslessly as QOI, which decodes much faster than the PNG it came from.
+
+static void printUsage() {
+  std::cout << "Usage: TextureConverter [--format <rgba8|etc2|etc2-alpha>] [--no-mipmaps] <input.png> <output.nrtex|output.qoi>" << std::endl;
+  std::cout << "Without --format, images with any transparency use etc2-alpha and everything else uses etc2." << std::endl;
+}
+
+static bool tryParseFormat(const std::string& text, NovelRT::Graphics::TextureContainerFormat& format) {
+  if (text == "rgba8") {
+    format = NovelRT::Graphics::TextureContainerFormat::Rgba8;
+  }
+  else if (text == "etc2") {
+    format = NovelRT::Graphics::TextureContainerFormat::Etc2Rgb8;
+  }
+  else if (text == "etc2-alpha") {
+    format = NovelRT::Graphics::TextureContainerFormat::Etc2Rgba8;
+  }
+  else {
+    return false;
+  }
+
+  return true;
+}
+
+static bool isOpaque(const NovelRT::Graphics::RgbaImage& image) {
+  for (size_t i = 3; i < image.pixels.size(); i += NovelRT::Graphics::RgbaImage::BytesPerPixel) {
+    if (image.pixels[i] != 255) return false;
+  }
+
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  auto hasFormat = false;
+  auto format = NovelRT::Graphics::TextureContainerFormat::Etc2Rgba8;
+  auto shouldGenerateMipmaps = true;
+  std::vector<std::string> positionalArguments;
+
+  for (int i = 1; i < argc; i++) {
+    std::string argument = argv[i];
+
+    if (argument == "--format" && i + 1 < argc) {
+      if (!tryParseFormat(argv[++i], format)) {
+        printUsage();
+        return 1;
+      }
+
+      hasFormat = true;
+    }
+    else if (argument == "--no-mipmaps") {
+      shouldGenerateMipmaps = false;
+    }
+    else {
+      positionalArguments.push_back(argument);
+    }
+  }
+
+  if (positionalArguments.size() != 2) {
+    printUsage();
+    return 1;
+  }
+
+  try {
+    auto image = NovelRT::Graphics::PngCodec::decodeFile(positionalArguments[0]);
+    if (NovelRT::Graphics::QoiCodec::isQoiFile(positionalArguments[1])) {
+      NovelRT::Graphics::QoiCodec::encodeFile(positionalArguments[1], image);
+      std::cout << "Wrote " << positionalArguments[1] << "." << std::endl;
+      return 0;
+    }
+
+    if (!hasFormat) {
+      format = isOpaque(image) ? NovelRT::Graphics::TextureContainerFormat::Etc2Rgb8 : NovelRT::Graphics::TextureContainerFormat::Etc2Rgba8;
+    }
+
+    auto bytes = NovelRT::Graphics::TextureContainer::encode(image, format, shouldGenerateMipmaps);
+    std::ofstream output(positionalArguments[1], std::ios::out | std::ios::binary | std::ios::trunc);
+    output.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!output) {
+      std::cerr << "Could not write " << positionalArguments[1] << "." << std::endl;
+      return 1;
+    }
+
+    //A PNG loaded the usual way takes up its RGBA8 size plus a third again for its mipmaps.
+    auto uncompressedSize = image.pixels.size() * 4 / 3;
+    std::cout << "Wrote " << positionalArguments[1] << ": " << bytes.size() << " bytes, "
+      << (bytes.size() * 100 / uncompressedSize) << "% of the same texture loaded from PNG." << std::endl;
+  }
+  catch (const std::exception& exception) {
+    std::cerr << exception.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}